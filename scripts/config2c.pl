@@ -140,18 +140,78 @@ foreach my $p (@pdb) {
         "$subarea{sc}, $subarea{pol}, $subarea{apol}, 0\}";
 }
 
+# The names are packed into 32-bit integers, and a multiplier (seed)
+# is searched for such that each name has its own slot in a table of
+# at least twice the size, as in hash_make_perfect() in classifier.c.
+sub name_pack {
+    my @c = unpack("C*", $_[0]);
+    (scalar @c > 0 && scalar @c <= 4) or die "Name '$_[0]' can't be packed";
+    my $packed = 0;
+    $packed |= $c[$_] << (8 * $_) foreach (0 .. $#c);
+    return $packed;
+}
+
+# 32-bit product, split to avoid precision loss
+sub mul32 {
+    my ($a, $b) = @_;
+    return ($a * ($b & 0xFFFF) + ((($a * ($b >> 16)) & 0xFFFF) << 16)) & 0xFFFFFFFF;
+}
+
+# the same function as perfect_slot() in classifier.c
+sub perfect_slot {
+    my ($packed, $seed, $n_slots) = @_;
+    return (mul32($packed, $seed) >> 16) & ($n_slots - 1);
+}
+
+# Returns the seed, and references to the slots and keys of the table
+sub perfect_hash {
+    my @packed = map { name_pack($_) } @_;
+    my $n_slots = 8;
+    $n_slots *= 2 while (2 * scalar @packed > $n_slots);
+    for (my $grow = 0; $grow < 4; ++$grow, $n_slots *= 2) {
+        SEED: for (my $k = 0; $k < 4096; ++$k) {
+            my $seed = (0x9E3779B1 + 2 * $k) & 0xFFFFFFFF;
+            my @slots = (0) x $n_slots;
+            my @keys = (0) x $n_slots;
+            for (my $i = 0; $i < scalar @packed; ++$i) {
+                my $j = perfect_slot($packed[$i], $seed, $n_slots);
+                next SEED if ($keys[$j] != 0);
+                $keys[$j] = $packed[$i];
+                $slots[$j] = $i + 1;
+            }
+            return ($seed, \@slots, \@keys);
+        }
+    }
+    die "No perfect hash found";
+}
+
+# prints the arrays of a table and returns the initializer of the struct
+sub print_hash {
+    my ($name, @names) = @_;
+    my ($seed, $slots, $keys) = perfect_hash(@names);
+    print "static int $name\_slot[] = {";
+    print "$_, " foreach (@$slots);
+    print "};\n";
+    print "static uint32_t $name\_key[] = {";
+    printf("0x%x, ", $_) foreach (@$keys);
+    print "};\n";
+    return sprintf("{%d, %s_slot, %s_key, 0x%08xu}", scalar @$slots, $name, $name, $seed);
+}
+
 my @res_array = sort keys %residues;
 print "#include \"classifier.h\"\n\n";
 print "/* Autogenerated code from the script config2c.pl */\n\n";
 print "static const char *$prefix\_residue_name[] = {";
 print "\"$_\", "foreach (@res_array);
 print "};\n";
+my $res_hash = print_hash("$prefix\_residue", @res_array);
 
 foreach my $res (@res_array) {
-    my @atom_names = keys %{$atoms{$res}};
+    my @atom_names = sort keys %{$atoms{$res}};
     print "static const char *$prefix\_$res\_atom_name[] = {";
     print "\"$_\", " foreach (@atom_names);
     print "};\n";
+    my $atom_hash = print_hash("$prefix\_$res\_atom", @atom_names);
     print "static double $prefix\_$res\_atom_radius[] = {";
     print $types{$atoms{$res}{$_}}{radius},", " foreach (@atom_names);
     print "};\n";
@@ -165,10 +225,11 @@ foreach my $res (@res_array) {
     print "    (double*) $prefix\_$res\_atom_radius,\n";
     print "    (freesasa_atom_class*) $prefix\_$res\_atom_class,\n";
     if (exists $rsa{$res}) {
-        print " $rsa{$res},";
+        print " $rsa{$res},\n";
     } else {
-        print " {NULL, 0, 0, 0, 0, 0},";
+        print " {NULL, 0, 0, 0, 0, 0},\n";
     }
+    print "    $atom_hash,";
     print"\n};\n\n"
 }
 print "static struct classifier_residue *$prefix\_residue_cfg[] = {\n    ";
@@ -183,4 +244,6 @@ print "    $n_residues,";
 print "    (char**) $prefix\_residue_name,\n";
 print "    \"$name\",\n";
 print "    (struct classifier_residue **) $prefix\_residue_cfg,\n";
+print "    $res_hash,\n";
+print "    NULL,\n";
 print "};\n\n";
@@ -0,0 +1,198 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freesasa_internal.h"
+
+/* size of the first block, each new block is twice as large as the
+   previous one, up to ARENA_MAX_BLOCK */
+#define ARENA_FIRST_BLOCK 65536
+#define ARENA_MAX_BLOCK (1 << 24)
+
+/* alignment of freesasa_arena_alloc() */
+union arena_align {
+    void *p;
+    double d;
+    long l;
+};
+#define ARENA_ALIGN sizeof(union arena_align)
+
+struct arena_block {
+    struct arena_block *next;
+    size_t used;
+    size_t size;
+    union arena_align data[1]; /* size bytes */
+};
+
+struct freesasa_arena {
+    struct arena_block *first;
+    struct arena_block *current; /* blocks after this one are empty */
+    size_t next_size;
+};
+
+freesasa_arena *
+freesasa_arena_new(void)
+{
+    freesasa_arena *arena = malloc(sizeof(freesasa_arena));
+
+    if (arena == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    arena->first = arena->current = NULL;
+    arena->next_size = ARENA_FIRST_BLOCK;
+
+    return arena;
+}
+
+void freesasa_arena_free(freesasa_arena *arena)
+{
+    struct arena_block *block, *next;
+
+    if (arena != NULL) {
+        for (block = arena->first; block != NULL; block = next) {
+            next = block->next;
+            free(block);
+        }
+        free(arena);
+    }
+}
+
+void freesasa_arena_reset(freesasa_arena *arena)
+{
+    struct arena_block *block;
+
+    assert(arena);
+
+    for (block = arena->first; block != NULL; block = block->next) {
+        block->used = 0;
+    }
+    arena->current = arena->first;
+}
+
+size_t
+freesasa_arena_size(const freesasa_arena *arena)
+{
+    const struct arena_block *block;
+    size_t size = 0;
+
+    assert(arena);
+
+    for (block = arena->first; block != NULL; block = block->next) {
+        size += block->size;
+    }
+
+    return size;
+}
+
+/* Allocates size bytes at an offset that is a multiple of align in the
+   current block, or in a later block if it doesn't fit. */
+static void *
+arena_alloc(freesasa_arena *arena,
+            size_t size,
+            size_t align)
+{
+    struct arena_block *block = arena->current, *new_block;
+    size_t offset, block_size;
+
+    /* blocks that are left after a reset are reused first */
+    for (; block != NULL; block = block->next) {
+        offset = (block->used + align - 1) / align * align;
+        if (offset <= block->size && size <= block->size - offset) {
+            block->used = offset + size;
+            arena->current = block;
+            return (char *)block->data + offset;
+        }
+        if (block->next == NULL) break;
+    }
+
+    block_size = arena->next_size;
+    while (block_size < size) block_size *= 2;
+    if (arena->next_size < ARENA_MAX_BLOCK) arena->next_size *= 2;
+
+    new_block = malloc(offsetof(struct arena_block, data) + block_size);
+    if (new_block == NULL) {
+        mem_fail();
+        return NULL;
+    }
+    new_block->next = NULL;
+    new_block->used = size;
+    new_block->size = block_size;
+
+    if (block == NULL) {
+        arena->first = new_block;
+    } else {
+        block->next = new_block;
+    }
+    arena->current = new_block;
+
+    return new_block->data;
+}
+
+void *
+freesasa_arena_alloc(freesasa_arena *arena,
+                     size_t size)
+{
+    assert(arena);
+
+    return arena_alloc(arena, size, ARENA_ALIGN);
+}
+
+char *
+freesasa_arena_strndup(freesasa_arena *arena,
+                       const char *str,
+                       size_t length)
+{
+    char *copy;
+
+    assert(arena);
+    assert(str);
+
+    copy = arena_alloc(arena, length + 1, 1);
+    if (copy != NULL) {
+        memcpy(copy, str, length);
+        copy[length] = '\0';
+    }
+
+    return copy;
+}
+
+char *
+freesasa_arena_strdup(freesasa_arena *arena,
+                      const char *str)
+{
+    assert(str);
+
+    return freesasa_arena_strndup(arena, str, strlen(str));
+}
+
+void freesasa_arena_adopt(freesasa_arena *arena,
+                          freesasa_arena *other)
+{
+    struct arena_block *last;
+
+    assert(arena);
+    assert(other);
+    assert(arena != other);
+
+    /* the blocks are appended at the end, and the current block of
+       other becomes current, so that the blocks after it are empty */
+    if (other->first != NULL) {
+        if (arena->first == NULL) {
+            arena->first = other->first;
+        } else {
+            for (last = arena->first; last->next != NULL; last = last->next)
+                ;
+            last->next = other->first;
+        }
+        arena->current = other->current;
+        if (other->next_size > arena->next_size) arena->next_size = other->next_size;
+    }
+    free(other);
+}
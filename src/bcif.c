@@ -0,0 +1,1340 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freesasa_internal.h"
+#include "pdb.h"
+
+/* nested MessagePack containers deeper than this are treated as invalid */
+#define MP_MAX_DEPTH 32
+
+/* longer chains of encodings are treated as invalid */
+#define BCIF_MAX_ENCODINGS 16
+
+/* text values longer than this are truncated (longer than any of the fields used) */
+#define BCIF_STRL 31
+
+/* BinaryCIF data types */
+#define BCIF_INT8 1
+#define BCIF_INT16 2
+#define BCIF_INT32 3
+#define BCIF_UINT8 4
+#define BCIF_UINT16 5
+#define BCIF_UINT32 6
+#define BCIF_FLOAT32 32
+#define BCIF_FLOAT64 33
+
+/* values of the mask of a column */
+#define BCIF_MASK_PRESENT 0
+#define BCIF_MASK_DOT 1      /* "." in mmCIF */
+#define BCIF_MASK_QUESTION 2 /* "?" in mmCIF */
+
+enum mp_type {
+    MP_NIL,
+    MP_BOOL,
+    MP_INT,
+    MP_FLOAT,
+    MP_STR,
+    MP_BIN,
+    MP_ARRAY,
+    MP_MAP,
+    MP_EXT
+};
+
+/* The header of a MessagePack value in the input buffer */
+struct mp_header {
+    enum mp_type type;
+    uint64_t length;              /* bytes for MP_STR, MP_BIN and MP_EXT, elements for MP_ARRAY and MP_MAP */
+    int64_t i;                    /* MP_INT and MP_BOOL */
+    double f;                     /* MP_FLOAT */
+    const unsigned char *payload; /* first byte or element of the contents, or next value */
+};
+
+/* A decoded array of numbers, either integers or floating point */
+struct bcif_array {
+    size_t n;
+    int32_t *i; /* NULL if floating point */
+    double *f;  /* NULL if integers */
+};
+
+/* A decoded column of _atom_site */
+struct bcif_column {
+    int present;
+    struct bcif_array values;  /* numbers, or indices in strings */
+    struct bcif_array offsets; /* of each string in strings, n = 0 if not a string column */
+    struct bcif_array mask;    /* n = 0 if no values are masked */
+    const char *strings;
+    size_t strings_length;
+};
+
+/* The columns used, same as atom_site_columns in the CIF reader of the CLI */
+enum bcif_column_id {
+    BCIF_GROUP_PDB,
+    BCIF_AUTH_ASYM_ID,
+    BCIF_AUTH_SEQ_ID,
+    BCIF_PDBX_PDB_INS_CODE,
+    BCIF_AUTH_COMP_ID,
+    BCIF_AUTH_ATOM_ID,
+    BCIF_LABEL_ALT_ID,
+    BCIF_TYPE_SYMBOL,
+    BCIF_CARTN_X,
+    BCIF_CARTN_Y,
+    BCIF_CARTN_Z,
+    BCIF_PDBX_PDB_MODEL_NUM,
+    BCIF_N_COLUMNS
+};
+
+static const char *bcif_column_names[BCIF_N_COLUMNS] = {
+    "group_PDB",
+    "auth_asym_id",
+    "auth_seq_id",
+    "pdbx_PDB_ins_code",
+    "auth_comp_id",
+    "auth_atom_id",
+    "label_alt_id",
+    "type_symbol",
+    "Cartn_x",
+    "Cartn_y",
+    "Cartn_z",
+    "pdbx_PDB_model_num",
+};
+
+/* text used for optional columns that are missing */
+static const char *bcif_column_default[BCIF_N_COLUMNS] = {
+    NULL, NULL, NULL, "?", NULL, NULL, ".", NULL, NULL, NULL, NULL, "1"};
+
+/* The decoded _atom_site category */
+struct bcif_atom_site {
+    size_t n_rows;
+    struct bcif_column column[BCIF_N_COLUMNS];
+    int *model; /* model number of each row */
+};
+
+static uint64_t
+mp_big_endian(const unsigned char *p, int n)
+{
+    uint64_t v = 0;
+    int k;
+
+    for (k = 0; k < n; ++k) {
+        v = v << 8 | p[k];
+    }
+
+    return v;
+}
+
+/* Reads the header of the value at p, returns FREESASA_FAIL if invalid or truncated */
+static int
+mp_read_header(const unsigned char *p,
+               const unsigned char *end,
+               struct mp_header *h)
+{
+    unsigned char c;
+    uint64_t u;
+    uint32_t u32;
+    float f32;
+    int n_length = 0, n_number = 0, is_signed = 0;
+
+    if (p == NULL || p >= end) return FREESASA_FAIL;
+
+    c = *p++;
+    h->length = 0;
+    h->i = 0;
+    h->f = 0;
+
+    if (c <= 0x7f) {
+        h->type = MP_INT;
+        h->i = c;
+    } else if (c >= 0xe0) {
+        h->type = MP_INT;
+        h->i = (int)c - 0x100;
+    } else if ((c & 0xf0) == 0x80) {
+        h->type = MP_MAP;
+        h->length = c & 0x0f;
+    } else if ((c & 0xf0) == 0x90) {
+        h->type = MP_ARRAY;
+        h->length = c & 0x0f;
+    } else if ((c & 0xe0) == 0xa0) {
+        h->type = MP_STR;
+        h->length = c & 0x1f;
+    } else {
+        switch (c) {
+        case 0xc0:
+            h->type = MP_NIL;
+            break;
+        case 0xc2:
+        case 0xc3:
+            h->type = MP_BOOL;
+            h->i = c == 0xc3;
+            break;
+        case 0xc4:
+        case 0xc5:
+        case 0xc6:
+            h->type = MP_BIN;
+            n_length = 1 << (c - 0xc4);
+            break;
+        case 0xc7:
+        case 0xc8:
+        case 0xc9:
+            /* the length is followed by a type byte, which is part of the payload here */
+            h->type = MP_EXT;
+            n_length = 1 << (c - 0xc7);
+            break;
+        case 0xca:
+        case 0xcb:
+            h->type = MP_FLOAT;
+            n_number = c == 0xca ? 4 : 8;
+            break;
+        case 0xcc:
+        case 0xcd:
+        case 0xce:
+        case 0xcf:
+            h->type = MP_INT;
+            n_number = 1 << (c - 0xcc);
+            break;
+        case 0xd0:
+        case 0xd1:
+        case 0xd2:
+        case 0xd3:
+            h->type = MP_INT;
+            n_number = 1 << (c - 0xd0);
+            is_signed = 1;
+            break;
+        case 0xd4:
+        case 0xd5:
+        case 0xd6:
+        case 0xd7:
+        case 0xd8:
+            h->type = MP_EXT;
+            h->length = 1 + (1 << (c - 0xd4));
+            break;
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
+            h->type = MP_STR;
+            n_length = 1 << (c - 0xd9);
+            break;
+        case 0xdc:
+        case 0xdd:
+            h->type = MP_ARRAY;
+            n_length = c == 0xdc ? 2 : 4;
+            break;
+        case 0xde:
+        case 0xdf:
+            h->type = MP_MAP;
+            n_length = c == 0xde ? 2 : 4;
+            break;
+        default:
+            return FREESASA_FAIL;
+        }
+    }
+
+    if (end - p < n_length + n_number) return FREESASA_FAIL;
+
+    if (n_length) {
+        h->length = mp_big_endian(p, n_length);
+        if (h->type == MP_EXT) ++h->length;
+        p += n_length;
+    }
+
+    if (n_number) {
+        u = mp_big_endian(p, n_number);
+        p += n_number;
+        if (h->type == MP_FLOAT && n_number == 4) {
+            u32 = (uint32_t)u;
+            memcpy(&f32, &u32, sizeof f32);
+            h->f = f32;
+        } else if (h->type == MP_FLOAT) {
+            memcpy(&h->f, &u, sizeof h->f);
+        } else if (is_signed) {
+            /* sign-extend */
+            if (n_number < 8 && (u >> (8 * n_number - 1))) u |= ~(uint64_t)0 << (8 * n_number);
+            h->i = (int64_t)u;
+        } else {
+            h->i = (int64_t)u;
+        }
+    }
+
+    if ((h->type == MP_STR || h->type == MP_BIN || h->type == MP_EXT) &&
+        h->length > (uint64_t)(end - p)) {
+        return FREESASA_FAIL;
+    }
+
+    h->payload = p;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Returns the position after the value at p, or NULL if invalid */
+static const unsigned char *
+mp_skip(const unsigned char *p,
+        const unsigned char *end,
+        int depth)
+{
+    struct mp_header h;
+    uint64_t k, n;
+
+    if (depth > MP_MAX_DEPTH || mp_read_header(p, end, &h)) return NULL;
+
+    switch (h.type) {
+    case MP_STR:
+    case MP_BIN:
+    case MP_EXT:
+        return h.payload + h.length;
+    case MP_ARRAY:
+    case MP_MAP:
+        n = h.type == MP_MAP ? 2 * h.length : h.length;
+        p = h.payload;
+        for (k = 0; k < n && p != NULL; ++k) {
+            p = mp_skip(p, end, depth + 1);
+        }
+        return p;
+    default:
+        return h.payload;
+    }
+}
+
+/* Returns the value for a key in the map at p, or NULL if not found */
+static const unsigned char *
+mp_map_get(const unsigned char *p,
+           const unsigned char *end,
+           const char *key)
+{
+    struct mp_header h, k;
+    size_t length = strlen(key);
+    uint64_t i;
+
+    if (mp_read_header(p, end, &h) || h.type != MP_MAP) return NULL;
+
+    p = h.payload;
+    for (i = 0; i < h.length; ++i) {
+        if (mp_read_header(p, end, &k)) return NULL;
+        if (k.type == MP_STR && k.length == length &&
+            memcmp(k.payload, key, length) == 0) {
+            return k.payload + k.length;
+        }
+        p = mp_skip(mp_skip(p, end, 0), end, 0);
+    }
+
+    return NULL;
+}
+
+static int
+mp_get_int(const unsigned char *p,
+           const unsigned char *end,
+           int64_t *value)
+{
+    struct mp_header h;
+
+    if (mp_read_header(p, end, &h)) return FREESASA_FAIL;
+    if (h.type == MP_INT || h.type == MP_BOOL) {
+        *value = h.i;
+    } else if (h.type == MP_FLOAT && h.f == (double)(int64_t)h.f) {
+        *value = (int64_t)h.f;
+    } else {
+        return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+mp_get_double(const unsigned char *p,
+              const unsigned char *end,
+              double *value)
+{
+    struct mp_header h;
+
+    if (mp_read_header(p, end, &h)) return FREESASA_FAIL;
+    if (h.type == MP_FLOAT) {
+        *value = h.f;
+    } else if (h.type == MP_INT) {
+        *value = (double)h.i;
+    } else {
+        return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Strings and binary data, data points into the input buffer */
+static int
+mp_get_bytes(const unsigned char *p,
+             const unsigned char *end,
+             enum mp_type type,
+             const unsigned char **data,
+             size_t *size)
+{
+    struct mp_header h;
+
+    if (mp_read_header(p, end, &h) || h.type != type) return FREESASA_FAIL;
+    *data = h.payload;
+    *size = (size_t)h.length;
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+mp_get_array(const unsigned char *p,
+             const unsigned char *end,
+             uint64_t *n,
+             const unsigned char **first)
+{
+    struct mp_header h;
+
+    if (mp_read_header(p, end, &h) || h.type != MP_ARRAY) return FREESASA_FAIL;
+    *n = h.length;
+    *first = h.payload;
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+mp_str_eq(const unsigned char *p,
+          const unsigned char *end,
+          const char *str)
+{
+    const unsigned char *s;
+    size_t length;
+
+    if (mp_get_bytes(p, end, MP_STR, &s, &length)) return 0;
+
+    return length == strlen(str) && memcmp(s, str, length) == 0;
+}
+
+static void
+bcif_array_free(struct bcif_array *a)
+{
+    free(a->i);
+    free(a->f);
+    a->i = NULL;
+    a->f = NULL;
+    a->n = 0;
+}
+
+static int
+bcif_array_alloc(struct bcif_array *a,
+                 size_t n,
+                 int floating_point)
+{
+    a->n = n;
+    a->i = NULL;
+    a->f = NULL;
+
+    if (n > ((size_t)-1) / sizeof(double)) return fail_msg("invalid BinaryCIF input, array too large");
+
+    /* avoid malloc(0) */
+    if (floating_point) {
+        a->f = malloc(sizeof(double) * (n ? n : 1));
+        if (a->f == NULL) return mem_fail();
+    } else {
+        a->i = malloc(sizeof(int32_t) * (n ? n : 1));
+        if (a->i == NULL) return mem_fail();
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Little-endian bytes to numbers */
+static int
+bcif_byte_array(struct bcif_array *out,
+                const unsigned char *data,
+                size_t size,
+                int64_t type)
+{
+    size_t width, k, j;
+    uint64_t u;
+    uint32_t u32;
+    float f32;
+
+    switch (type) {
+    case BCIF_INT8:
+    case BCIF_UINT8:
+        width = 1;
+        break;
+    case BCIF_INT16:
+    case BCIF_UINT16:
+        width = 2;
+        break;
+    case BCIF_INT32:
+    case BCIF_UINT32:
+    case BCIF_FLOAT32:
+        width = 4;
+        break;
+    case BCIF_FLOAT64:
+        width = 8;
+        break;
+    default:
+        return fail_msg("unsupported BinaryCIF data type %d", (int)type);
+    }
+
+    if (size % width != 0) return fail_msg("invalid BinaryCIF input, size of byte array");
+    if (bcif_array_alloc(out, size / width, type == BCIF_FLOAT32 || type == BCIF_FLOAT64)) {
+        return FREESASA_FAIL;
+    }
+
+    for (k = 0; k < out->n; ++k) {
+        u = 0;
+        for (j = width; j-- > 0;) {
+            u = u << 8 | data[k * width + j];
+        }
+        switch (type) {
+        case BCIF_INT8:
+            out->i[k] = (int8_t)u;
+            break;
+        case BCIF_INT16:
+            out->i[k] = (int16_t)u;
+            break;
+        case BCIF_INT32:
+        case BCIF_UINT32:
+            out->i[k] = (int32_t)(uint32_t)u;
+            break;
+        case BCIF_UINT8:
+        case BCIF_UINT16:
+            out->i[k] = (int32_t)u;
+            break;
+        case BCIF_FLOAT32:
+            u32 = (uint32_t)u;
+            memcpy(&f32, &u32, sizeof f32);
+            out->f[k] = f32;
+            break;
+        case BCIF_FLOAT64:
+            memcpy(&out->f[k], &u, sizeof(double));
+            break;
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Integers divided by a factor. Kept in double precision, so that
+   values match those parsed from mmCIF text. */
+static int
+bcif_fixed_point(struct bcif_array *out,
+                 const struct bcif_array *in,
+                 const unsigned char *encoding,
+                 const unsigned char *end)
+{
+    double factor;
+    size_t k;
+
+    if (mp_get_double(mp_map_get(encoding, end, "factor"), end, &factor) || factor == 0) {
+        return fail_msg("invalid BinaryCIF FixedPoint encoding");
+    }
+    if (bcif_array_alloc(out, in->n, 1)) return FREESASA_FAIL;
+    for (k = 0; k < in->n; ++k) {
+        out->f[k] = in->i[k] / factor;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+bcif_interval_quantization(struct bcif_array *out,
+                           const struct bcif_array *in,
+                           const unsigned char *encoding,
+                           const unsigned char *end)
+{
+    double min, max, delta;
+    int64_t n_steps;
+    size_t k;
+
+    if (mp_get_double(mp_map_get(encoding, end, "min"), end, &min) ||
+        mp_get_double(mp_map_get(encoding, end, "max"), end, &max) ||
+        mp_get_int(mp_map_get(encoding, end, "numSteps"), end, &n_steps) ||
+        n_steps < 2) {
+        return fail_msg("invalid BinaryCIF IntervalQuantization encoding");
+    }
+    delta = (max - min) / (n_steps - 1);
+    if (bcif_array_alloc(out, in->n, 1)) return FREESASA_FAIL;
+    for (k = 0; k < in->n; ++k) {
+        out->f[k] = min + delta * in->i[k];
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* pairs of values and counts */
+static int
+bcif_run_length(struct bcif_array *out,
+                const struct bcif_array *in,
+                const unsigned char *encoding,
+                const unsigned char *end)
+{
+    int64_t src_size;
+    size_t k, j, n = 0;
+
+    if (mp_get_int(mp_map_get(encoding, end, "srcSize"), end, &src_size) ||
+        src_size < 0 || src_size > INT32_MAX || in->n % 2 != 0) {
+        return fail_msg("invalid BinaryCIF RunLength encoding");
+    }
+    if (bcif_array_alloc(out, (size_t)src_size, 0)) return FREESASA_FAIL;
+    for (k = 0; k < in->n; k += 2) {
+        if (in->i[k + 1] < 0 || (size_t)in->i[k + 1] > out->n - n) {
+            bcif_array_free(out);
+            return fail_msg("invalid BinaryCIF RunLength encoding");
+        }
+        for (j = 0; j < (size_t)in->i[k + 1]; ++j) {
+            out->i[n++] = in->i[k];
+        }
+    }
+    if (n != out->n) {
+        bcif_array_free(out);
+        return fail_msg("invalid BinaryCIF RunLength encoding");
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+bcif_delta(struct bcif_array *out,
+           const struct bcif_array *in,
+           const unsigned char *encoding,
+           const unsigned char *end)
+{
+    int64_t origin;
+    uint32_t sum;
+    size_t k;
+
+    if (mp_get_int(mp_map_get(encoding, end, "origin"), end, &origin)) {
+        return fail_msg("invalid BinaryCIF Delta encoding");
+    }
+    if (bcif_array_alloc(out, in->n, 0)) return FREESASA_FAIL;
+    /* unsigned, to wrap around instead of overflowing like the 32 bit arrays of the encoder */
+    sum = (uint32_t)origin;
+    for (k = 0; k < in->n; ++k) {
+        sum += (uint32_t)in->i[k];
+        out->i[k] = (int32_t)sum;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* values that don't fit in 1 or 2 bytes are stored as sums of several elements */
+static int
+bcif_integer_packing(struct bcif_array *out,
+                     const struct bcif_array *in,
+                     const unsigned char *encoding,
+                     const unsigned char *end)
+{
+    int64_t byte_count, is_unsigned, src_size;
+    int32_t upper, lower, t, value;
+    size_t k = 0, n = 0;
+
+    if (mp_get_int(mp_map_get(encoding, end, "byteCount"), end, &byte_count) ||
+        mp_get_int(mp_map_get(encoding, end, "isUnsigned"), end, &is_unsigned) ||
+        mp_get_int(mp_map_get(encoding, end, "srcSize"), end, &src_size) ||
+        (byte_count != 1 && byte_count != 2) || src_size < 0 || src_size > INT32_MAX) {
+        return fail_msg("invalid BinaryCIF IntegerPacking encoding");
+    }
+
+    if (is_unsigned) {
+        upper = byte_count == 1 ? 0xff : 0xffff;
+        lower = -1; /* no lower limit */
+    } else {
+        upper = byte_count == 1 ? 0x7f : 0x7fff;
+        lower = -upper - 1;
+    }
+
+    if (bcif_array_alloc(out, (size_t)src_size, 0)) return FREESASA_FAIL;
+    while (k < in->n) {
+        value = 0;
+        t = in->i[k];
+        while ((t == upper || t == lower) && k + 1 < in->n) {
+            value += t;
+            t = in->i[++k];
+        }
+        if (n == out->n) {
+            bcif_array_free(out);
+            return fail_msg("invalid BinaryCIF IntegerPacking encoding");
+        }
+        out->i[n++] = value + t;
+        ++k;
+    }
+    if (n != out->n) {
+        bcif_array_free(out);
+        return fail_msg("invalid BinaryCIF IntegerPacking encoding");
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Decodes binary data by applying the inverse of a list of encodings, last to first */
+static int
+bcif_decode(struct bcif_array *out,
+            const unsigned char *data,
+            size_t size,
+            const unsigned char *encodings,
+            const unsigned char *end)
+{
+    const unsigned char *encoding[BCIF_MAX_ENCODINGS], *p, *kind;
+    struct bcif_array a, b;
+    uint64_t n, k;
+    int64_t type;
+    int ret;
+
+    if (mp_get_array(encodings, end, &n, &p) || n == 0 || n > BCIF_MAX_ENCODINGS) {
+        return fail_msg("invalid BinaryCIF encoding");
+    }
+    for (k = 0; k < n; ++k) {
+        encoding[k] = p;
+        p = mp_skip(p, end, 0);
+        if (p == NULL) return fail_msg("invalid BinaryCIF encoding");
+    }
+
+    /* the last encoding is from numbers to bytes */
+    kind = mp_map_get(encoding[n - 1], end, "kind");
+    if (!mp_str_eq(kind, end, "ByteArray") ||
+        mp_get_int(mp_map_get(encoding[n - 1], end, "type"), end, &type)) {
+        return fail_msg("invalid BinaryCIF encoding, data should be a ByteArray");
+    }
+    if (bcif_byte_array(&a, data, size, type)) return FREESASA_FAIL;
+
+    for (k = n - 1; k-- > 0;) {
+        kind = mp_map_get(encoding[k], end, "kind");
+        if (a.i == NULL) {
+            ret = fail_msg("invalid BinaryCIF encoding, floating point input to integer decoding");
+        } else if (mp_str_eq(kind, end, "FixedPoint")) {
+            ret = bcif_fixed_point(&b, &a, encoding[k], end);
+        } else if (mp_str_eq(kind, end, "IntervalQuantization")) {
+            ret = bcif_interval_quantization(&b, &a, encoding[k], end);
+        } else if (mp_str_eq(kind, end, "RunLength")) {
+            ret = bcif_run_length(&b, &a, encoding[k], end);
+        } else if (mp_str_eq(kind, end, "Delta")) {
+            ret = bcif_delta(&b, &a, encoding[k], end);
+        } else if (mp_str_eq(kind, end, "IntegerPacking")) {
+            ret = bcif_integer_packing(&b, &a, encoding[k], end);
+        } else {
+            ret = fail_msg("unsupported BinaryCIF encoding");
+        }
+        bcif_array_free(&a);
+        if (ret == FREESASA_FAIL) return FREESASA_FAIL;
+        a = b;
+    }
+
+    *out = a;
+
+    return FREESASA_SUCCESS;
+}
+
+/* Decodes a map with the keys "data" and "encoding" */
+static int
+bcif_decode_data(struct bcif_array *out,
+                 const unsigned char *map,
+                 const unsigned char *end)
+{
+    const unsigned char *data;
+    size_t size;
+
+    if (mp_get_bytes(mp_map_get(map, end, "data"), end, MP_BIN, &data, &size)) {
+        return fail_msg("invalid BinaryCIF input, missing data");
+    }
+
+    return bcif_decode(out, data, size, mp_map_get(map, end, "encoding"), end);
+}
+
+/* Indices in a table of strings, the encoding has the strings and their offsets */
+static int
+bcif_decode_strings(struct bcif_column *column,
+                    const unsigned char *data,
+                    size_t size,
+                    const unsigned char *encoding,
+                    const unsigned char *end)
+{
+    const unsigned char *offsets, *strings;
+    size_t offsets_size, k;
+    int32_t *o;
+
+    if (mp_get_bytes(mp_map_get(encoding, end, "stringData"), end, MP_STR, &strings, &column->strings_length) ||
+        mp_get_bytes(mp_map_get(encoding, end, "offsets"), end, MP_BIN, &offsets, &offsets_size)) {
+        return fail_msg("invalid BinaryCIF StringArray encoding");
+    }
+    column->strings = (const char *)strings;
+
+    if (bcif_decode(&column->offsets, offsets, offsets_size,
+                    mp_map_get(encoding, end, "offsetEncoding"), end) ||
+        bcif_decode(&column->values, data, size,
+                    mp_map_get(encoding, end, "dataEncoding"), end)) {
+        return FREESASA_FAIL;
+    }
+
+    o = column->offsets.i;
+    if (o == NULL || column->values.i == NULL || column->offsets.n == 0 || o[0] < 0) {
+        return fail_msg("invalid BinaryCIF StringArray encoding");
+    }
+    for (k = 1; k < column->offsets.n; ++k) {
+        if (o[k] < o[k - 1] || (size_t)o[k] > column->strings_length) {
+            return fail_msg("invalid BinaryCIF StringArray encoding");
+        }
+    }
+    for (k = 0; k < column->values.n; ++k) {
+        if (column->values.i[k] < -1 || column->values.i[k] >= (int32_t)column->offsets.n - 1) {
+            return fail_msg("invalid BinaryCIF StringArray encoding");
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+bcif_decode_column(struct bcif_column *column,
+                   const unsigned char *p,
+                   const unsigned char *end,
+                   size_t n_rows)
+{
+    const unsigned char *map, *encodings, *first, *mask, *data;
+    struct mp_header h;
+    uint64_t n;
+    size_t size;
+
+    map = mp_map_get(p, end, "data");
+    encodings = mp_map_get(map, end, "encoding");
+    if (mp_get_array(encodings, end, &n, &first) || n == 0) {
+        return fail_msg("invalid BinaryCIF column");
+    }
+
+    column->present = 1;
+    if (mp_str_eq(mp_map_get(first, end, "kind"), end, "StringArray")) {
+        if (n != 1 || mp_get_bytes(mp_map_get(map, end, "data"), end, MP_BIN, &data, &size)) {
+            return fail_msg("invalid BinaryCIF StringArray encoding");
+        }
+        if (bcif_decode_strings(column, data, size, first, end)) return FREESASA_FAIL;
+    } else if (bcif_decode_data(&column->values, map, end)) {
+        return FREESASA_FAIL;
+    }
+
+    mask = mp_map_get(p, end, "mask");
+    if (mask != NULL && mp_read_header(mask, end, &h) == FREESASA_SUCCESS && h.type != MP_NIL) {
+        if (bcif_decode_data(&column->mask, mask, end)) return FREESASA_FAIL;
+        if (column->mask.i == NULL || column->mask.n != n_rows) {
+            return fail_msg("invalid BinaryCIF column mask");
+        }
+    }
+
+    if (column->values.n != n_rows) {
+        return fail_msg("invalid BinaryCIF column, wrong number of rows");
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* The text of a value as it would be in mmCIF (without quotes) */
+static const char *
+bcif_column_text(const struct bcif_atom_site *site,
+                 enum bcif_column_id id,
+                 size_t row,
+                 char *buf)
+{
+    const struct bcif_column *column = &site->column[id];
+    size_t begin, length;
+    int32_t index;
+
+    if (!column->present) return bcif_column_default[id];
+
+    if (column->mask.n > 0) {
+        if (column->mask.i[row] == BCIF_MASK_DOT) return ".";
+        if (column->mask.i[row] == BCIF_MASK_QUESTION) return "?";
+    }
+
+    if (column->offsets.n > 0) {
+        index = column->values.i[row];
+        if (index < 0) return "?";
+        begin = column->offsets.i[index];
+        length = column->offsets.i[index + 1] - begin;
+        if (length > BCIF_STRL) length = BCIF_STRL;
+        memcpy(buf, column->strings + begin, length);
+        buf[length] = '\0';
+    } else if (column->values.i != NULL) {
+        snprintf(buf, BCIF_STRL + 1, "%d", (int)column->values.i[row]);
+    } else {
+        snprintf(buf, BCIF_STRL + 1, "%g", column->values.f[row]);
+    }
+
+    return buf;
+}
+
+static double
+bcif_column_double(const struct bcif_atom_site *site,
+                   enum bcif_column_id id,
+                   size_t row)
+{
+    const struct bcif_column *column = &site->column[id];
+    char buf[BCIF_STRL + 1];
+
+    if (column->offsets.n > 0) return atof(bcif_column_text(site, id, row, buf));
+    if (column->values.f != NULL) return column->values.f[row];
+
+    return column->values.i[row];
+}
+
+static void
+bcif_atom_site_free(struct bcif_atom_site *site)
+{
+    int c;
+
+    for (c = 0; c < BCIF_N_COLUMNS; ++c) {
+        bcif_array_free(&site->column[c].values);
+        bcif_array_free(&site->column[c].offsets);
+        bcif_array_free(&site->column[c].mask);
+    }
+    free(site->model);
+    site->model = NULL;
+}
+
+/* Finds the _atom_site category of the first data block and decodes the columns used */
+static int
+bcif_atom_site_read(struct bcif_atom_site *site,
+                    const struct pdb_buffer *buffer)
+{
+    const unsigned char *begin = (const unsigned char *)buffer->data,
+                        *end = begin + buffer->size, *p, *category = NULL, *name;
+    char buf[BCIF_STRL + 1];
+    uint64_t n, k;
+    int64_t row_count;
+    size_t row;
+    int c;
+
+    memset(site, 0, sizeof(*site));
+
+    if (mp_get_array(mp_map_get(begin, end, "dataBlocks"), end, &n, &p) || n == 0 ||
+        mp_get_array(mp_map_get(p, end, "categories"), end, &n, &p)) {
+        return fail_msg("input is not valid BinaryCIF");
+    }
+    for (k = 0; k < n && p != NULL; ++k) {
+        name = mp_map_get(p, end, "name");
+        if (mp_str_eq(name, end, "_atom_site") || mp_str_eq(name, end, "atom_site")) {
+            category = p;
+            break;
+        }
+        p = mp_skip(p, end, 0);
+    }
+    if (category == NULL) return fail_msg("BinaryCIF input has no _atom_site category");
+
+    if (mp_get_int(mp_map_get(category, end, "rowCount"), end, &row_count) ||
+        row_count < 0 || row_count > INT32_MAX ||
+        mp_get_array(mp_map_get(category, end, "columns"), end, &n, &p)) {
+        return fail_msg("invalid BinaryCIF _atom_site category");
+    }
+    site->n_rows = (size_t)row_count;
+
+    /* only the columns that are used are decoded, the rest are skipped */
+    for (k = 0; k < n && p != NULL; ++k) {
+        name = mp_map_get(p, end, "name");
+        for (c = 0; c < BCIF_N_COLUMNS; ++c) {
+            if (!site->column[c].present && mp_str_eq(name, end, bcif_column_names[c])) {
+                if (bcif_decode_column(&site->column[c], p, end, site->n_rows)) goto cleanup;
+                break;
+            }
+        }
+        p = mp_skip(p, end, 0);
+    }
+    if (p == NULL) {
+        fail_msg("invalid BinaryCIF _atom_site category");
+        goto cleanup;
+    }
+
+    for (c = 0; c < BCIF_N_COLUMNS; ++c) {
+        if (!site->column[c].present && bcif_column_default[c] == NULL) {
+            fail_msg("BinaryCIF input has no column _atom_site.%s", bcif_column_names[c]);
+            goto cleanup;
+        }
+    }
+
+    site->model = malloc(sizeof(int) * (site->n_rows ? site->n_rows : 1));
+    if (site->model == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    for (row = 0; row < site->n_rows; ++row) {
+        if (site->column[BCIF_PDBX_PDB_MODEL_NUM].values.i != NULL &&
+            site->column[BCIF_PDBX_PDB_MODEL_NUM].offsets.n == 0 &&
+            site->column[BCIF_PDBX_PDB_MODEL_NUM].mask.n == 0) {
+            site->model[row] = site->column[BCIF_PDBX_PDB_MODEL_NUM].values.i[row];
+        } else {
+            site->model[row] = atoi(bcif_column_text(site, BCIF_PDBX_PDB_MODEL_NUM, row, buf));
+        }
+    }
+
+    return FREESASA_SUCCESS;
+
+cleanup:
+    bcif_atom_site_free(site);
+    return FREESASA_FAIL;
+}
+
+/**
+    Builds a structure from the atoms of a model (or all models if
+    all_models is set) and optionally only one chain. Atoms are
+    selected as in the mmCIF reader of the CLI.
+ */
+static freesasa_structure *
+bcif_structure(const struct bcif_atom_site *site,
+               int all_models,
+               int model,
+               const char *chain,
+               const freesasa_classifier *classifier,
+               int options)
+{
+    char group[BCIF_STRL + 1], asym[BCIF_STRL + 1], seq[BCIF_STRL + 1], ins[BCIF_STRL + 1],
+        comp[BCIF_STRL + 1], name[BCIF_STRL + 1], alt[BCIF_STRL + 1], symbol[BCIF_STRL + 1];
+    const char *group_PDB, *auth_asym_id, *label_alt_id, *type_symbol;
+    char prev_alt = '.';
+    size_t row;
+    freesasa_structure *structure = freesasa_structure_new();
+
+    if (structure == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    for (row = 0; row < site->n_rows; ++row) {
+        group_PDB = bcif_column_text(site, BCIF_GROUP_PDB, row, group);
+        if (strcmp(group_PDB, "ATOM") != 0 && !(options & FREESASA_INCLUDE_HETATM)) continue;
+
+        if (!all_models && site->model[row] != model) continue;
+        auth_asym_id = bcif_column_text(site, BCIF_AUTH_ASYM_ID, row, asym);
+        if (chain != NULL && strcmp(auth_asym_id, chain) != 0) continue;
+
+        type_symbol = bcif_column_text(site, BCIF_TYPE_SYMBOL, row, symbol);
+        if (!(options & FREESASA_INCLUDE_HYDROGEN) && strcmp(type_symbol, "H") == 0) continue;
+
+        /* pick the first alternative conformation for an atom */
+        label_alt_id = bcif_column_text(site, BCIF_LABEL_ALT_ID, row, alt);
+        if ((label_alt_id[0] != '.' && prev_alt == '.') || label_alt_id[0] == '.') {
+            prev_alt = label_alt_id[0];
+        } else if (label_alt_id[0] != '.' && label_alt_id[0] != prev_alt) {
+            continue;
+        }
+
+        {
+            freesasa_cif_atom atom = {
+                group_PDB,
+                auth_asym_id[0],
+                bcif_column_text(site, BCIF_AUTH_SEQ_ID, row, seq),
+                bcif_column_text(site, BCIF_PDBX_PDB_INS_CODE, row, ins),
+                bcif_column_text(site, BCIF_AUTH_COMP_ID, row, comp),
+                bcif_column_text(site, BCIF_AUTH_ATOM_ID, row, name),
+                label_alt_id,
+                type_symbol,
+                bcif_column_double(site, BCIF_CARTN_X, row),
+                bcif_column_double(site, BCIF_CARTN_Y, row),
+                bcif_column_double(site, BCIF_CARTN_Z, row)};
+
+            if (freesasa_structure_add_cif_atom(structure, &atom, classifier, options) == FREESASA_FAIL) {
+                freesasa_structure_free(structure);
+                fail_msg("");
+                return NULL;
+            }
+        }
+    }
+
+    return structure;
+}
+
+static struct pdb_buffer *
+bcif_read(FILE *input,
+          struct bcif_atom_site *site)
+{
+    struct pdb_buffer *buffer = freesasa_pdb_buffer_new(input);
+
+    if (buffer == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+    if (bcif_atom_site_read(site, buffer)) {
+        freesasa_pdb_buffer_free(buffer);
+        return NULL;
+    }
+
+    return buffer;
+}
+
+freesasa_structure *
+freesasa_structure_from_bcif(FILE *input,
+                             const freesasa_classifier *classifier,
+                             int options)
+{
+    struct bcif_atom_site site;
+    struct pdb_buffer *buffer;
+    freesasa_structure *structure = NULL;
+    size_t row;
+    int model;
+
+    assert(input);
+
+    buffer = bcif_read(input, &site);
+    if (buffer == NULL) return NULL;
+
+    /* the lowest model number, unless all models are joined */
+    model = site.n_rows > 0 ? site.model[0] : 0;
+    for (row = 1; row < site.n_rows; ++row) {
+        if (site.model[row] < model) model = site.model[row];
+    }
+
+    structure = bcif_structure(&site, options & FREESASA_JOIN_MODELS, model, NULL,
+                               classifier, options);
+    if (structure != NULL && freesasa_structure_n(structure) == 0) {
+        fail_msg("input had no valid atom sites");
+        freesasa_structure_free(structure);
+        structure = NULL;
+    }
+
+    bcif_atom_site_free(&site);
+    freesasa_pdb_buffer_free(buffer);
+
+    return structure;
+}
+
+static int
+bcif_compare_chains(const void *a, const void *b)
+{
+    return strcmp((const char *)a, (const char *)b);
+}
+
+/* Adds the names of the chains in a model, sorted, chains has room for n_rows names */
+static int
+bcif_model_chains(const struct bcif_atom_site *site,
+                  int model,
+                  char (*chains)[BCIF_STRL + 1])
+{
+    char buf[BCIF_STRL + 1], prev[BCIF_STRL + 1] = "";
+    const char *name;
+    size_t row;
+    int n = 0, i, found;
+
+    for (row = 0; row < site->n_rows; ++row) {
+        if (site->model[row] != model) continue;
+        name = bcif_column_text(site, BCIF_AUTH_ASYM_ID, row, buf);
+        /* chains are mostly contiguous */
+        if (n > 0 && strcmp(name, prev) == 0) continue;
+        strcpy(prev, name);
+        found = 0;
+        for (i = 0; i < n && !found; ++i) {
+            found = strcmp(chains[i], name) == 0;
+        }
+        if (!found) strcpy(chains[n++], name);
+    }
+    qsort(chains, n, sizeof(chains[0]), bcif_compare_chains);
+
+    return n;
+}
+
+freesasa_structure **
+freesasa_structure_array_bcif(FILE *input,
+                              int *n,
+                              const freesasa_classifier *classifier,
+                              int options)
+{
+    struct bcif_atom_site site;
+    struct pdb_buffer *buffer;
+    freesasa_structure **ss = NULL, **ssb, *s;
+    char(*chains)[BCIF_STRL + 1] = NULL;
+    int *models = NULL;
+    int n_models = 0, n_chains, n_alloc = 0, i, j, k;
+    size_t row;
+
+    assert(input);
+    assert(n);
+
+    *n = 0;
+
+    if (!(options & FREESASA_SEPARATE_MODELS ||
+          options & FREESASA_SEPARATE_CHAINS)) {
+        fail_msg("options need to specify at least one of FREESASA_SEPARATE_CHAINS "
+                 "and FREESASA_SEPARATE_MODELS");
+        return NULL;
+    }
+
+    buffer = bcif_read(input, &site);
+    if (buffer == NULL) return NULL;
+
+    /* models in the order they appear */
+    models = malloc(sizeof(int) * (site.n_rows ? site.n_rows : 1));
+    chains = malloc(sizeof(chains[0]) * (site.n_rows ? site.n_rows : 1));
+    if (models == NULL || chains == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    for (row = 0; row < site.n_rows; ++row) {
+        if (n_models > 0 && site.model[row] == models[n_models - 1]) continue;
+        for (i = 0; i < n_models && models[i] != site.model[row]; ++i)
+            ;
+        if (i == n_models) models[n_models++] = site.model[row];
+    }
+
+    /* only keep first model if option not provided */
+    if (!(options & FREESASA_SEPARATE_MODELS) && n_models > 1) n_models = 1;
+
+    for (i = 0; i < n_models; ++i) {
+        n_chains = (options & FREESASA_SEPARATE_CHAINS) ? bcif_model_chains(&site, models[i], chains) : 1;
+        for (j = 0; j < n_chains; ++j) {
+            s = bcif_structure(&site, 0, models[i],
+                               (options & FREESASA_SEPARATE_CHAINS) ? chains[j] : NULL,
+                               classifier, options);
+            if (s == NULL) goto cleanup;
+            /* chains that only have excluded atoms */
+            if (freesasa_structure_n(s) == 0) {
+                freesasa_structure_free(s);
+                continue;
+            }
+            freesasa_structure_set_model(s, i + 1);
+            if (*n == n_alloc) {
+                n_alloc = n_alloc ? 2 * n_alloc : 16;
+                ssb = ss;
+                ss = realloc(ss, sizeof(freesasa_structure *) * n_alloc);
+                if (ss == NULL) {
+                    ss = ssb;
+                    freesasa_structure_free(s);
+                    mem_fail();
+                    goto cleanup;
+                }
+            }
+            ss[(*n)++] = s;
+        }
+    }
+
+    if (*n == 0) {
+        fail_msg("input had no valid atom sites");
+        goto cleanup;
+    }
+
+    free(models);
+    free(chains);
+    bcif_atom_site_free(&site);
+    freesasa_pdb_buffer_free(buffer);
+
+    return ss;
+
+cleanup:
+    for (k = 0; k < *n; ++k) {
+        freesasa_structure_free(ss[k]);
+    }
+    free(ss);
+    free(models);
+    free(chains);
+    bcif_atom_site_free(&site);
+    freesasa_pdb_buffer_free(buffer);
+    *n = 0;
+
+    return NULL;
+}
+
+#if USE_CHECK
+#include <check.h>
+
+START_TEST(test_mp_header)
+{
+    struct mp_header h;
+    const unsigned char fixint[] = {0x05}, negint[] = {0xff}, int16[] = {0xd1, 0xff, 0x38},
+                        uint32[] = {0xce, 0x00, 0x01, 0x00, 0x00}, float64[] = {0xcb, 0x3f, 0xf8, 0, 0, 0, 0, 0, 0},
+                        str[] = {0xa3, 'a', 'b', 'c'}, bin[] = {0xc4, 0x02, 1, 2},
+                        truncated_str[] = {0xa3, 'a'}, truncated_int[] = {0xcd, 0x01}, reserved[] = {0xc1},
+                        map[] = {0x82, 0xa1, 'a', 0x01, 0xa1, 'b', 0x92, 0x02, 0x03};
+    const unsigned char *p;
+    int64_t i;
+
+    ck_assert(mp_read_header(fixint, fixint + 1, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_INT && h.i == 5);
+    ck_assert(mp_read_header(negint, negint + 1, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_INT && h.i == -1);
+    ck_assert(mp_read_header(int16, int16 + 3, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_INT && h.i == -200);
+    ck_assert(mp_read_header(uint32, uint32 + 5, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_INT && h.i == 65536);
+    ck_assert(mp_read_header(float64, float64 + 9, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_FLOAT && h.f == 1.5);
+    ck_assert(mp_read_header(str, str + 4, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_STR && h.length == 3 && h.payload == str + 1);
+    ck_assert(mp_read_header(bin, bin + 4, &h) == FREESASA_SUCCESS);
+    ck_assert(h.type == MP_BIN && h.length == 2 && h.payload == bin + 2);
+
+    ck_assert(mp_read_header(truncated_str, truncated_str + 2, &h) == FREESASA_FAIL);
+    ck_assert(mp_read_header(truncated_int, truncated_int + 2, &h) == FREESASA_FAIL);
+    ck_assert(mp_read_header(reserved, reserved + 1, &h) == FREESASA_FAIL);
+    ck_assert(mp_read_header(NULL, str, &h) == FREESASA_FAIL);
+
+    ck_assert(mp_skip(map, map + sizeof(map), 0) == map + sizeof(map));
+    ck_assert(mp_skip(map, map + sizeof(map) - 1, 0) == NULL);
+    ck_assert(mp_skip(map, map + sizeof(map), MP_MAX_DEPTH) == NULL);
+    ck_assert(mp_get_int(mp_map_get(map, map + sizeof(map), "a"), map + sizeof(map), &i) == FREESASA_SUCCESS);
+    ck_assert(i == 1);
+    ck_assert(mp_map_get(map, map + sizeof(map), "c") == NULL);
+    p = mp_map_get(map, map + sizeof(map), "b");
+    ck_assert(p == map + 6);
+    ck_assert(mp_get_int(p, map + sizeof(map), &i) == FREESASA_FAIL);
+}
+END_TEST
+
+START_TEST(test_bcif_encodings)
+{
+    /* {"byteCount": 1, "isUnsigned": false, "srcSize": 3} */
+    const unsigned char packing[] = {0x83, 0xa9, 'b', 'y', 't', 'e', 'C', 'o', 'u', 'n', 't', 0x01,
+                                     0xaa, 'i', 's', 'U', 'n', 's', 'i', 'g', 'n', 'e', 'd', 0xc2,
+                                     0xa7, 's', 'r', 'c', 'S', 'i', 'z', 'e', 0x03},
+                        /* {"srcSize": 5} */
+        run_length[] = {0x81, 0xa7, 's', 'r', 'c', 'S', 'i', 'z', 'e', 0x05},
+                        /* {"origin": 10} */
+        delta[] = {0x81, 0xa6, 'o', 'r', 'i', 'g', 'i', 'n', 0x0a},
+                        /* {"factor": 1000} */
+        fixed[] = {0x81, 0xa6, 'f', 'a', 'c', 't', 'o', 'r', 0xcd, 0x03, 0xe8},
+                        /* little-endian int16 -2 and 300 */
+        int16[] = {0xfe, 0xff, 0x2c, 0x01};
+    int32_t packed[] = {127, 127, 3, -128, -5, 7}, runs[] = {4, 2, 9, 3}, bad_runs[] = {4, 2, 9, 4};
+    struct bcif_array in, out;
+
+    ck_assert(bcif_byte_array(&out, int16, 4, BCIF_INT16) == FREESASA_SUCCESS);
+    ck_assert(out.n == 2 && out.i[0] == -2 && out.i[1] == 300);
+    bcif_array_free(&out);
+    ck_assert(bcif_byte_array(&out, int16, 4, BCIF_UINT16) == FREESASA_SUCCESS);
+    ck_assert(out.n == 2 && out.i[0] == 65534);
+    bcif_array_free(&out);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert(bcif_byte_array(&out, int16, 3, BCIF_INT16) == FREESASA_FAIL);
+    ck_assert(bcif_byte_array(&out, int16, 4, 7) == FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    in.i = packed;
+    in.f = NULL;
+    in.n = 6;
+    ck_assert(bcif_integer_packing(&out, &in, packing, packing + sizeof(packing)) == FREESASA_SUCCESS);
+    ck_assert(out.n == 3 && out.i[0] == 257 && out.i[1] == -133 && out.i[2] == 7);
+    bcif_array_free(&out);
+
+    in.i = runs;
+    in.n = 4;
+    ck_assert(bcif_run_length(&out, &in, run_length, run_length + sizeof(run_length)) == FREESASA_SUCCESS);
+    ck_assert(out.n == 5 && out.i[0] == 4 && out.i[1] == 4 && out.i[2] == 9 && out.i[4] == 9);
+    bcif_array_free(&out);
+    in.i = bad_runs;
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert(bcif_run_length(&out, &in, run_length, run_length + sizeof(run_length)) == FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    in.i = runs;
+    ck_assert(bcif_delta(&out, &in, delta, delta + sizeof(delta)) == FREESASA_SUCCESS);
+    ck_assert(out.n == 4 && out.i[0] == 14 && out.i[1] == 16 && out.i[2] == 25 && out.i[3] == 28);
+    bcif_array_free(&out);
+
+    ck_assert(bcif_fixed_point(&out, &in, fixed, fixed + sizeof(fixed)) == FREESASA_SUCCESS);
+    ck_assert(out.n == 4 && out.i == NULL && out.f[0] == 0.004 && out.f[2] == 0.009);
+    bcif_array_free(&out);
+}
+END_TEST
+
+TCase *
+test_bcif_static()
+{
+    TCase *tc = tcase_create("bcif.c static");
+    tcase_add_test(tc, test_mp_header);
+    tcase_add_test(tc, test_bcif_encodings);
+
+    return tc;
+}
+
+#endif /* USE_CHECK */
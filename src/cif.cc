@@ -1,112 +1,28 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
 #include <cmath>
-#include <fstream>
-#include <iostream>
+#include <cstring>
+#include <map>
 #include <memory>
-#include <set>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#if USE_THREADS
+#include <thread>
+#endif
 
 #include <gemmi/cif.hpp>
-#include <gemmi/mmcif.hpp>
-
-#define GEMMI_WRITE_IMPLEMENTATION
-#include <gemmi/to_cif.hpp>
-#undef GEMMI_WRITE_IMPLEMENTATION
 
 #include "cif.hh"
 #include "freesasa.h"
+#include "pdb.h"
 
 static std::vector<gemmi::cif::Document> docs;
 
-struct ModelDiscriminator {
-    ModelDiscriminator(const std::string &model_name,
-                       const int model_col = 11)
-        : _model_name(model_name), _model_col(model_col)
-    {
-    }
-
-    bool operator()(const gemmi::cif::Table::Row &site) const
-    {
-        return _model_name != site[_model_col];
-    }
-
-private:
-    const std::string _model_name;
-    int _model_col;
-};
-
-struct ModelSetDiscriminator {
-    ModelSetDiscriminator(const std::set<int> models,
-                          const int model_col = 11)
-        : _models(models), _model_col(model_col)
-    {
-    }
-
-    bool operator()(const gemmi::cif::Table::Row &site) const
-    {
-        return _models.count(std::stoi(site[_model_col])) == 0;
-    }
-
-private:
-    const std::set<int> _models;
-    int _model_col;
-};
-
-struct ChainDiscriminator {
-    ChainDiscriminator(const std::string &model_name, const std::string &chain_name,
-                       const int model_col = 11, const int chain_col = 1)
-        : _model_name(model_name), _chain_name(chain_name),
-          _model_col(model_col), _chain_col(chain_col)
-    {
-    }
-
-    bool operator()(const gemmi::cif::Table::Row &site) const
-    {
-        return _model_name != site[_model_col] || _chain_name != site[_chain_col];
-    }
-
-private:
-    const std::string _model_name, _chain_name;
-    int _model_col, _chain_col;
-};
-
-static std::unique_ptr<std::set<int>>
-get_models(const gemmi::cif::Document &doc)
-{
-    auto models = std::make_unique<std::set<int>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"pdbx_PDB_model_num"})) {
-            models->insert(gemmi::cif::as_int(site[0]));
-        }
-    }
-    return models;
-}
-
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::cif::Document &doc)
-{
-    auto chains = std::make_unique<std::set<std::string>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"auth_asym_id"})) {
-            chains->insert(site[0]);
-        }
-    }
-    return chains;
-}
-
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::Model &model)
-{
-    auto chains = std::make_unique<std::set<std::string>>();
-
-    for (auto &chain : model.chains) {
-        chains->insert(chain.name);
-    }
-
-    return chains;
-}
-
 static const auto atom_site_columns = std::vector<std::string>({
     "group_PDB",
     "auth_asym_id",
@@ -146,41 +62,119 @@ freesasa_atom_from_site(const gemmi::cif::Table::Row &site)
         .Cartn_z = atof(site[10].c_str())};
 }
 
-template <typename T>
-static freesasa_structure *
-structure_from_pred(const gemmi::cif::Document &doc,
-                    const T &discriminator,
-                    const freesasa_classifier *classifier,
-                    int structure_options)
+
+// A row of _atom_site, in the table of one of the blocks of a document
+struct AtomSite {
+    size_t table;
+    int row;
+
+    bool operator<(const AtomSite &other) const
+    {
+        return table < other.table || (table == other.table && row < other.row);
+    }
+};
+
+// The rows of a model, or of each of its chains, in file order
+struct ModelSites {
+    std::string name;
+    int number;
+    std::vector<AtomSite> rows;
+    std::map<std::string, std::vector<AtomSite>> chains;
+};
+
+// The projected _atom_site columns of a document, and the models in order of appearance
+struct DocumentSites {
+    std::vector<gemmi::cif::Table> tables;
+    std::vector<ModelSites> models;
+};
+
+/**
+    Scans _atom_site once and buckets the rows by model, and by chain
+    if by_chain is set. Model and chain labels come in runs, so they
+    are only looked up when they change.
+ */
+static void
+scan_atom_sites(gemmi::cif::Document &doc,
+                DocumentSites &sites,
+                bool by_chain)
 {
-    freesasa_structure *structure = freesasa_structure_new();
-    std::string auth_atom_id;
-    char prevAltId = '.';
+    std::unordered_map<std::string, size_t> model_index;
 
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", atom_site_columns)) {
-            if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
-                continue;
-            }
+    for (auto &block : doc.blocks) {
+        sites.tables.push_back(block.find("_atom_site.", atom_site_columns));
+    }
 
-            if (discriminator(site)) continue;
+    for (size_t t = 0; t < sites.tables.size(); ++t) {
+        auto &table = sites.tables[t];
+        const std::string *model_name = NULL, *chain_name = NULL;
+        std::vector<AtomSite> *model_rows = NULL, *chain_rows = NULL;
+        ModelSites *model = NULL;
 
-            freesasa_cif_atom atom = freesasa_atom_from_site(site);
+        if (!table.ok()) continue;
 
-            if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && std::string(atom.type_symbol) == "H") {
-                continue;
+        for (int row = 0, n_rows = table.length(); row < n_rows; ++row) {
+            auto site = table[row];
+            const std::string &model_col = site[11], &chain_col = site[1];
+
+            if (model == NULL || *model_name != model_col) {
+                auto found = model_index.find(model_col);
+                if (found == model_index.end()) {
+                    int number = gemmi::cif::as_int(model_col);
+                    found = model_index.emplace(model_col, sites.models.size()).first;
+                    sites.models.push_back({model_col, number, {}, {}});
+                }
+                model = &sites.models[found->second];
+                model_name = &found->first;
+                model_rows = &model->rows;
+                chain_rows = NULL;
             }
 
-            // Pick the first alternative conformation for an atom
-            auto currentAltId = site[6][0];
-            if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
-                prevAltId = currentAltId;
-            } else if (currentAltId != '.' && currentAltId != prevAltId) {
+            if (!by_chain) {
+                model_rows->push_back({t, row});
                 continue;
             }
 
-            freesasa_structure_add_cif_atom(structure, &atom, classifier, structure_options);
+            if (chain_rows == NULL || *chain_name != chain_col) {
+                auto chain = model->chains.emplace(chain_col, std::vector<AtomSite>()).first;
+                chain_name = &chain->first;
+                chain_rows = &chain->second;
+            }
+            chain_rows->push_back({t, row});
+        }
+    }
+}
+
+static freesasa_structure *
+structure_from_sites(DocumentSites &sites,
+                     const std::vector<AtomSite> &rows,
+                     const freesasa_classifier *classifier,
+                     int structure_options)
+{
+    freesasa_structure *structure = freesasa_structure_new();
+    char prevAltId = '.';
+
+    for (const auto &ref : rows) {
+        auto site = sites.tables[ref.table][ref.row];
+
+        if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
+            continue;
+        }
+
+        freesasa_cif_atom atom = freesasa_atom_from_site(site);
+
+        if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && std::string(atom.type_symbol) == "H") {
+            continue;
+        }
+
+        // Pick the first alternative conformation for an atom
+        auto currentAltId = site[6][0];
+        if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
+            prevAltId = currentAltId;
+        } else if (currentAltId != '.' && currentAltId != prevAltId) {
+            continue;
         }
+
+        freesasa_structure_add_cif_atom(structure, &atom, classifier, structure_options);
     }
     return structure;
 }
@@ -188,15 +182,31 @@ structure_from_pred(const gemmi::cif::Document &doc,
 static gemmi::cif::Document &
 generate_gemmi_doc(std::FILE *input)
 {
-    docs.emplace_back(gemmi::cif::read_cstream(input, 8192, "cif-input"));
+    // the buffer takes care of decompressing gzip or zstd input
+    struct pdb_buffer *buffer = freesasa_pdb_buffer_new(input);
+    if (buffer == NULL) {
+        throw std::runtime_error("unable to read CIF input");
+    }
+    try {
+        docs.emplace_back(gemmi::cif::read_memory(buffer->data, buffer->size, "cif-input"));
+    } catch (...) {
+        freesasa_pdb_buffer_free(buffer);
+        throw;
+    }
+    freesasa_pdb_buffer_free(buffer);
     auto &doc = docs.back();
 
-    gemmi::Structure gemmi_struct = gemmi::make_structure_from_block(doc.blocks[0]);
+    if (doc.blocks.empty()) {
+        docs.pop_back();
+        throw std::runtime_error("no data block in CIF input");
+    }
 
-    if (gemmi_struct.name.find(".cif") != std::string::npos) {
-        doc.source = gemmi_struct.name;
+    // the structure is named after the first block, as in gemmi::Structure
+    const std::string &name = doc.blocks[0].name;
+    if (name.find(".cif") != std::string::npos) {
+        doc.source = name;
     } else {
-        doc.source = gemmi_struct.name + ".cif";
+        doc.source = name + ".cif";
     }
     transform(doc.source.begin(), doc.source.end(), doc.source.begin(), tolower);
 
@@ -209,40 +219,52 @@ freesasa_structure_from_cif(std::FILE *input,
                             int structure_options)
 {
     auto &doc = generate_gemmi_doc(input);
-
-    const auto models = get_models(doc);
-
-    std::unique_ptr<const ModelSetDiscriminator> discriminator;
-    if (structure_options & FREESASA_JOIN_MODELS) {
-        discriminator = std::make_unique<const ModelSetDiscriminator>(std::move(*models));
-    } else {
-        auto firstModel = models->begin();
-        auto singleModel = std::set<int>{*firstModel};
-        discriminator = std::make_unique<const ModelSetDiscriminator>(singleModel);
+    DocumentSites sites;
+    std::vector<AtomSite> rows;
+    int n_selected = 0;
+
+    scan_atom_sites(doc, sites, false);
+
+    if (!sites.models.empty()) {
+        int first = std::min_element(sites.models.begin(), sites.models.end(),
+                                     [](const ModelSites &a, const ModelSites &b) {
+                                         return a.number < b.number;
+                                     })
+                        ->number;
+        for (const auto &model : sites.models) {
+            if ((structure_options & FREESASA_JOIN_MODELS) || model.number == first) {
+                rows.insert(rows.end(), model.rows.begin(), model.rows.end());
+                ++n_selected;
+            }
+        }
+        // the rows of different models can be interleaved in the file
+        if (n_selected > 1) std::sort(rows.begin(), rows.end());
     }
-    return structure_from_pred(doc, *discriminator, classifier, structure_options);
-}
 
-static freesasa_structure *
-structure_from_model(const gemmi::cif::Document &doc,
-                     const std::string &model_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
-{
-    const ModelDiscriminator discriminator(model_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
-    freesasa_structure *structure = freesasa_structure_new();
+    return structure_from_sites(sites, rows, classifier, structure_options);
 }
 
-static freesasa_structure *
-structure_from_chain(const gemmi::cif::Document doc,
-                     const std::string &model_name,
-                     const std::string &chain_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
+// The rows of a model or chain to be parsed into a structure
+struct ParseJob {
+    const std::vector<AtomSite> *rows;
+    int model;
+};
+
+// Parses jobs first, first + stride, ..., each thread writes to its own elements of ss
+static void
+parse_jobs(DocumentSites &sites,
+           const std::vector<ParseJob> &jobs,
+           std::vector<freesasa_structure *> &ss,
+           size_t first,
+           size_t stride,
+           const freesasa_classifier *classifier,
+           int options)
 {
-    const ChainDiscriminator discriminator(model_name, chain_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
+    for (size_t i = first; i < jobs.size(); i += stride) {
+        const auto &job = jobs[i];
+        ss[i] = structure_from_sites(sites, *job.rows, classifier, options);
+        if (ss[i] != NULL) freesasa_structure_set_model(ss[i], job.model);
+    }
 }
 
 std::vector<freesasa_structure *>
@@ -251,128 +273,145 @@ freesasa_cif_structure_array(std::FILE *input,
                              const freesasa_classifier *classifier,
                              int options)
 {
-    int n_models = 0, n_chains = 0;
-
-    std::vector<freesasa_structure *> ss;
+    int n_models = 0;
+    std::vector<ParseJob> jobs;
+    DocumentSites sites;
 
     auto &doc = generate_gemmi_doc(input);
 
-    gemmi::Structure gemmi_struct = gemmi::make_structure_from_block(doc.blocks[0]);
-
-    const auto models = gemmi_struct.models;
+    scan_atom_sites(doc, sites, options & FREESASA_SEPARATE_CHAINS);
 
-    n_models = models.size();
+    n_models = sites.models.size();
 
     /* only keep first model if option not provided */
-    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
-
-    /* for each model read chains if requested */
-    if (options & FREESASA_SEPARATE_CHAINS) {
-        for (int i = 0; i < n_models; ++i) {
-            auto chain_names = get_chains(models[i]);
-            int n_new_chains = chain_names->size();
-            n_chains += n_new_chains;
-
-            if (n_new_chains == 0) {
-                freesasa_warn("in %s(): no chains found (in model %s)",
-                              __func__, models[i].name.c_str());
-                continue;
+    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = std::min(n_models, 1);
+
+    /* for each model list chains if requested, in alphabetical order */
+    for (int i = 0; i < n_models; ++i) {
+        const auto &model = sites.models[i];
+        if (options & FREESASA_SEPARATE_CHAINS) {
+            for (const auto &chain : model.chains) {
+                jobs.push_back({&chain.second, i + 1});
             }
+        } else {
+            jobs.push_back({&model.rows, i + 1});
+        }
+    }
 
-            ss.reserve(n_new_chains);
-            for (auto &chain_name : *chain_names) {
-                freesasa_structure *structure = structure_from_chain(doc, models[i].name, chain_name, classifier, options);
-                if (freesasa_structure_n(structure) == 0) {
-                    --n_chains;
-                    free(structure);
-                    continue;
-                }
-
-                ss.push_back(std::move(structure));
+    /* the models and chains are independent, parse them in parallel */
+    std::vector<freesasa_structure *> parsed(jobs.size(), NULL);
+#if USE_THREADS
+    size_t n_threads = std::min<size_t>(freesasa_get_parse_threads(), jobs.size());
+    if (n_threads > 1) {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < n_threads; ++t) {
+            threads.emplace_back(parse_jobs, std::ref(sites), std::cref(jobs), std::ref(parsed),
+                                 t, n_threads, classifier, options);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    } else
+#endif
+        parse_jobs(sites, jobs, parsed, 0, 1, classifier, options);
 
-                freesasa_structure_set_model(ss.back(), i + 1);
+    std::vector<freesasa_structure *> ss;
+    if (options & FREESASA_SEPARATE_CHAINS) {
+        ss.reserve(parsed.size());
+        for (auto structure : parsed) {
+            if (structure == NULL || freesasa_structure_n(structure) == 0) {
+                freesasa_structure_free(structure);
+                continue;
             }
+            ss.push_back(structure);
         }
-        if (n_chains == 0)
+        if (ss.size() == 0)
             freesasa_fail("In %s(): No chains in any model in protein: %s.",
-                          __func__, gemmi_struct.name.c_str());
-        *n = n_chains;
+                          __func__, doc.blocks[0].name.c_str());
     } else {
-        ss.reserve(n_models);
-        for (int i = 0; i < n_models; ++i) {
-            ss.emplace_back(
-                structure_from_model(doc, models[i].name, classifier, options));
-            freesasa_structure_set_model(ss.back(), i + 1);
-        }
-        *n = n_models;
+        ss = std::move(parsed);
     }
+    *n = ss.size();
+
     return ss;
 }
 
-struct freesasa_MCRA {
-    freesasa_MCRA(const int model,
-                  const std::string &chain,
-                  const std::string &res_num,
-                  const std::string &residue,
-                  const std::string &atom)
-        : _model(model), _chain(chain), _res_num(res_num), _residue(residue), _atom(atom)
+// Identifies an atom in _atom_site the way it is identified in the result tree
+struct AtomKey {
+    int model;
+    char chain;
+    std::string res_num, res_name, atom_name;
+
+    bool operator==(const AtomKey &other) const
     {
+        return model == other.model && chain == other.chain &&
+               res_num == other.res_num && res_name == other.res_name &&
+               atom_name == other.atom_name;
     }
+};
 
-    int find_row(gemmi::cif::Table &table, int start_idx = 0) const
+struct AtomKeyHash {
+    size_t operator()(const AtomKey &key) const
     {
-        int idx = start_idx, total_rows = table.length();
+        std::hash<std::string> str_hash;
+        size_t h = str_hash(key.atom_name);
+        h = h * 31 + str_hash(key.res_num);
+        h = h * 31 + str_hash(key.res_name);
+        h = h * 31 + (unsigned char)key.chain;
+        return h * 31 + key.model;
+    }
+};
 
-        assert(idx < total_rows);
+// Maps each atom to its first row in _atom_site
+using AtomSiteIndex = std::unordered_map<AtomKey, int, AtomKeyHash>;
 
-        while (idx < total_rows) {
-            if (this->is_row(table[idx])) {
-                return idx;
-            }
-            ++idx;
-        }
+// The values appended to a row of _atom_site in CIF output
+struct AtomSiteResult {
+    double value, radius;
+    bool found;
+};
 
-        freesasa_warn(
-            "In %s(), unable to find row in _atom_site for atom (%d, %s, %s, %s, %s). "
-            "Looping through entire table to double check...",
-            __func__, this->_model, this->_chain.c_str(),
-            this->_res_num.c_str(), this->_residue.c_str(),
-            this->_atom.c_str());
-
-        idx = 0;
-        for (const auto site : table) {
-            if (this->is_row(site)) {
-                return idx;
-            }
-            ++idx;
-        }
-        return FREESASA_FAIL;
+// The residue number as freesasa_structure_add_cif_atom() stores it
+static std::string
+site_residue_number(const gemmi::cif::Table::Row &site)
+{
+    char res_number[PDB_ATOM_RES_NUMBER_STRL + 1];
+
+    if (site[3][0] != '?') {
+        snprintf(res_number, sizeof res_number, "%s%c", site[2].c_str(), site[3][0]);
+    } else {
+        snprintf(res_number, sizeof res_number, "%s", site[2].c_str());
     }
+    return res_number;
+}
 
-private:
-    bool is_row(const gemmi::cif::Table::Row &row) const
-    {
-        int model = std::stoul(row[11]);
-        const std::string &chain = row[1];
-        const std::string &residue = row[4];
-        const std::string &res_num = row[2];
-        const std::string atom = row[5][0] != '"' ? row[5] : row[5].substr(1, row[5].size() - 2);
-
-        if (_model == model) {
-            if (_chain == chain) {
-                if (_res_num == res_num && _residue == residue) {
-                    if (_atom == atom) {
-                        return true;
-                    }
-                }
-            }
+static std::string
+site_atom_name(const gemmi::cif::Table::Row &site)
+{
+    // remove quotation marks if necessary
+    if (site[5][0] == '"') return site[5].substr(1, site[5].size() - 2);
+    return site[5];
+}
+
+static void
+index_atom_sites(gemmi::cif::Table &table, AtomSiteIndex &index)
+{
+    const std::string *model_col = NULL;
+    int model = 0;
+
+    index.clear();
+    index.reserve(table.length());
+
+    for (int row = 0, n_rows = table.length(); row < n_rows; ++row) {
+        auto site = table[row];
+        if (model_col == NULL || *model_col != site[11]) {
+            model_col = &site[11];
+            model = gemmi::cif::as_int(*model_col);
         }
-        return false;
+        index.emplace(AtomKey{model, site[1][0], site_residue_number(site), site[4], site_atom_name(site)},
+                      row);
     }
-
-    const int _model;
-    const std::string &_chain, &_residue, &_res_num, &_atom;
-};
+}
 
 static std::string
 get_cif_filename(std::string filename)
@@ -592,21 +631,21 @@ append_freesasa_result_summary_to_block(gemmi::cif::Block &block, freesasa_node
     return FREESASA_SUCCESS;
 }
 
-static void
-populate_freesasa_result_vectors(gemmi::cif::Table &table, freesasa_node *result,
-                                 std::vector<std::string> &sasa_vals,
-                                 std::vector<std::string> &sasa_radii)
+static int
+populate_freesasa_result_vectors(gemmi::cif::Table &table,
+                                 const AtomSiteIndex &index,
+                                 freesasa_node *result,
+                                 std::vector<AtomSiteResult> &results)
 {
     assert(freesasa_node_type(result) == FREESASA_NODE_RESULT);
 
     assert(table.ok());
 
     freesasa_node *structure, *chain, *residue, *atom;
-    int rowNum{0}, model{0};
+    int model{0};
 
     structure = freesasa_node_children(result);
     while (structure) {
-        rowNum = 0;
         model = freesasa_node_structure_model(structure);
         chain = freesasa_node_children(structure);
         while (chain) {
@@ -615,21 +654,20 @@ populate_freesasa_result_vectors(gemmi::cif::Table &table, freesasa_node *result
                 append_freesasa_rsa_residue_to_block(table.bloc, residue);
                 atom = freesasa_node_children(residue);
                 while (atom) {
-                    auto cName = std::string(1, freesasa_node_atom_chain(atom));
+                    auto cName = freesasa_node_atom_chain(atom);
                     auto rNum = freesasa_node_atom_residue_number(atom);
                     auto rName = freesasa_node_atom_residue_name(atom);
                     auto aName = freesasa_node_name(atom);
                     auto area = freesasa_node_area(atom);
                     auto radius = freesasa_node_atom_radius(atom);
 
-                    rowNum = freesasa_MCRA{model, cName, rNum, rName, aName}.find_row(table, rowNum);
-                    if (rowNum == FREESASA_FAIL)
-                        freesasa_fail(
-                            "In %s(), unable to find freesasa_node atom (%d, %s, %s, %s, %s) in cif %s",
-                            __func__, model, cName.c_str(), rNum, rName, aName, table.bloc.name.c_str());
+                    auto row = index.find(AtomKey{model, cName, rNum, rName, aName});
+                    if (row == index.end())
+                        return freesasa_fail(
+                            "In %s(), unable to find freesasa_node atom (%d, %c, %s, %s, %s) in cif %s",
+                            __func__, model, cName, rNum, rName, aName, table.bloc.name.c_str());
 
-                    sasa_vals[rowNum] = std::to_string(area->total);
-                    sasa_radii[rowNum] = std::to_string(radius);
+                    results[row->second] = {area->total, radius, true};
 
                     atom = freesasa_node_next(atom);
                 }
@@ -639,51 +677,184 @@ populate_freesasa_result_vectors(gemmi::cif::Table &table, freesasa_node *result
         }
         structure = freesasa_node_next(structure);
     }
+    return FREESASA_SUCCESS;
 }
 
 static void
-write_cif_block(std::ostream &out, gemmi::cif::Table &table,
-                std::vector<std::string> &sasa_vals,
-                std::vector<std::string> &sasa_radii)
+write_cif_number(std::FILE *output, double value)
 {
-    auto &loop = *table.get_loop();
+    if (std::isnan(value)) {
+        fputs(".", output);
+    } else if (std::isinf(value)) {
+        fputs("?", output);
+    } else {
+        fprintf(output, "%f", value);
+    }
+}
 
-    unsigned long orig_tag_size = loop.tags.size();
-    unsigned long new_tag_size = orig_tag_size + 2;
+// A text field starts with ';' and ends with a line break and ';'
+static bool
+is_text_field(const std::string &value)
+{
+    size_t len = value.size();
+    return len > 2 && value[0] == ';' && value[len - 2] == '\n' && value[len - 1] == ';';
+}
 
-    // Creates a new table full of empty strings with the correct number of dimensions
-    // Outside vector size is the # of columns, inside vector size is the # of rows.
-    std::vector<std::vector<std::string>> newCols(new_tag_size, {loop.length(), {"Empty"}});
+// Pairs are laid out as by gemmi's CIF writer
+static void
+write_cif_pair(std::FILE *output, const std::string &tag, const std::string &value)
+{
+    fputs(tag.c_str(), output);
+    if (is_text_field(value) || tag.size() + value.size() > 120) {
+        fputc('\n', output);
+    } else {
+        fputc(' ', output);
+    }
+    fprintf(output, "%s\n", value.c_str());
+}
+
+/**
+    Writes a loop row by row from the document, laid out as by gemmi's
+    CIF writer. If results is not NULL, the loop is _atom_site and the
+    SASA and radius of each row are appended.
+ */
+static void
+write_cif_loop(std::FILE *output,
+               const gemmi::cif::Loop &loop,
+               const std::vector<AtomSiteResult> *results)
+{
+    size_t width = loop.width(), n_rows = loop.length();
+
+    if (width == 0 || n_rows == 0) return;
+
+    fputs("loop_", output);
+    for (const auto &tag : loop.tags) {
+        fprintf(output, "\n%s", tag.c_str());
+    }
+    if (results) {
+        fputs("\n_atom_site.FreeSASA_value"
+              "\n_atom_site.FreeSASA_radius",
+              output);
+    }
+
+    for (size_t row = 0; row < n_rows; ++row) {
+        for (size_t col = 0; col < width; ++col) {
+            const std::string &value = loop.values[row * width + col];
+            bool text_field = is_text_field(value);
+            fputc(col == 0 || text_field ? '\n' : ' ', output);
+            fputs(value.c_str(), output);
+            if (text_field) fputc('\n', output);
+        }
+        if (results) {
+            const auto &result = (*results)[row];
+            if (result.found) {
+                fputc(' ', output);
+                write_cif_number(output, result.value);
+                fputc(' ', output);
+                write_cif_number(output, result.radius);
+            } else {
+                fputs(" ? ?", output);
+            }
+        }
+    }
+    fputc('\n', output);
+}
+
+static void
+write_cif_item(std::FILE *output,
+               const gemmi::cif::Item &item,
+               const gemmi::cif::Loop *atom_site,
+               const std::vector<AtomSiteResult> &results)
+{
+    switch (item.type) {
+    case gemmi::cif::ItemType::Pair:
+        write_cif_pair(output, item.pair[0], item.pair[1]);
+        break;
+    case gemmi::cif::ItemType::Loop:
+        write_cif_loop(output, item.loop, &item.loop == atom_site ? &results : NULL);
+        break;
+    case gemmi::cif::ItemType::Frame:
+        fprintf(output, "save_%s\n", item.frame.name.c_str());
+        for (const auto &frame_item : item.frame.items) {
+            write_cif_item(output, frame_item, atom_site, results);
+        }
+        fputs("save_\n", output);
+        break;
+    case gemmi::cif::ItemType::Comment:
+        fprintf(output, "%s\n", item.pair[1].c_str());
+        break;
+    default:
+        break;
+    }
+}
+
+// Loops and pairs from different categories are separated by '#'
+static bool
+is_new_category(const gemmi::cif::Item &prev, const gemmi::cif::Item &item)
+{
+    size_t prev_dot, dot;
 
-    // Copies data from original columns to their respecitve column in the new table filled with empty strings.
-    // Leaving only the new appended columns as empty strings
-    for (unsigned int i = 0; i != orig_tag_size; ++i) {
-        auto iCol = table.bloc.find_loop(loop.tags[i]);
-        std::copy(iCol.begin(), iCol.end(), newCols[i].begin());
+    if (prev.type == gemmi::cif::ItemType::Comment ||
+        item.type == gemmi::cif::ItemType::Comment) {
+        return false;
     }
+    if (prev.type != gemmi::cif::ItemType::Pair ||
+        item.type != gemmi::cif::ItemType::Pair) {
+        return true;
+    }
+
+    prev_dot = prev.pair[0].find('.');
+    if (prev_dot == std::string::npos) return false;
+    dot = item.pair[0].find('.');
+
+    return prev_dot != dot || prev.pair[0].compare(0, prev_dot, item.pair[0], 0, dot) != 0;
+}
 
-    newCols[new_tag_size - 2] = std::move(sasa_vals);
-    newCols[new_tag_size - 1] = std::move(sasa_radii);
+/**
+    Writes the block of a document, streaming the rows of _atom_site
+    with the results appended, instead of adding the columns to the
+    document. The block starts and ends with '#', with one '#' between
+    categories, as in PDBx/mmCIF files.
+ */
+static int
+write_cif_block(std::FILE *output,
+                gemmi::cif::Table &table,
+                const std::vector<AtomSiteResult> &results)
+{
+    const gemmi::cif::Loop *atom_site = table.get_loop();
+    const gemmi::cif::Item *prev = NULL;
 
-    std::vector<std::string> new_tags{
-        "_atom_site.FreeSASA_value",
-        "_atom_site.FreeSASA_radius"};
-    for (auto tag : new_tags)
-        loop.tags.push_back(tag);
+    if (atom_site == NULL) {
+        return freesasa_fail("In %s(), _atom_site in %s is not a loop",
+                             __func__, table.bloc.name.c_str());
+    }
 
-    loop.set_all_values(newCols);
+    fprintf(output, "data_%s\n#\n", table.bloc.name.c_str());
+    for (const auto &item : table.bloc.items) {
+        if (item.type == gemmi::cif::ItemType::Erased) continue;
+        if (prev && is_new_category(*prev, item)) fputs("#\n", output);
+        write_cif_item(output, item, atom_site, results);
+        prev = &item;
+    }
+    fputs("#\n", output);
+
+    fflush(output);
+    if (ferror(output)) {
+        return fail_msg(strerror(errno));
+    }
 
-    gemmi::cif::write_cif_block_to_stream(out, table.bloc);
+    return FREESASA_SUCCESS;
 }
 
 static int
-write_result(std::ostream &out, freesasa_node *root)
+write_result(std::FILE *output, freesasa_node *root)
 {
     freesasa_node *result{freesasa_node_children(root)};
 
-    int prev_doc_idx = -1, doc_idx = 0;
-    bool write = false;
-    std::vector<std::string> sasa_vals, sasa_radii;
+    int doc_idx = 0;
+    bool new_doc = true;
+    std::vector<AtomSiteResult> results;
+    AtomSiteIndex index;
 
     while (result) {
         doc_idx = find_doc_idx(freesasa_node_name(result));
@@ -703,61 +874,44 @@ write_result(std::ostream &out, freesasa_node *root)
         }
 
         auto table = block.find("_atom_site.", atom_site_columns);
-        if (prev_doc_idx != doc_idx) {
-            sasa_vals = std::vector<std::string>{table.length(), "?"};
-            sasa_radii = std::vector<std::string>{table.length(), "?"};
+        if (new_doc) {
+            results.assign(table.length(), AtomSiteResult{0, 0, false});
+            index_atom_sites(table, index);
+            new_doc = false;
         }
 
-        populate_freesasa_result_vectors(table, result, sasa_vals, sasa_radii);
+        if (populate_freesasa_result_vectors(table, index, result, results) == FREESASA_FAIL) {
+            return freesasa_fail("Unable to build CIF output");
+        }
 
-        prev_doc_idx = doc_idx;
         result = freesasa_node_next(result);
 
-        if (!result) {
-            // There is no next result so write out current file.
-            write = true;
-        } else if (find_doc_idx(freesasa_node_name(result)) != prev_doc_idx) {
-            // Next result node is from a new file so write out current file.
-            write = true;
-        } else {
-            // Next result node is from the same doc so do not write current file yet.
-            write = false;
+        // Write the document when the next result is from another file, and release it
+        if (!result || find_doc_idx(freesasa_node_name(result)) != doc_idx) {
+            if (write_cif_block(output, table, results) == FREESASA_FAIL) {
+                return FREESASA_FAIL;
+            }
+            docs.erase(docs.begin() + doc_idx);
+            new_doc = true;
         }
-
-        if (write) write_cif_block(out, table, sasa_vals, sasa_radii);
     }
     return FREESASA_SUCCESS;
 }
 
-int freesasa_export_tree_to_cif(const char *filename,
+int freesasa_export_tree_to_cif(std::FILE *output,
                                 freesasa_node *root)
 {
+    assert(output);
     assert(root);
     assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
     int ret;
 
-    std::streambuf *buf;
-    std::ofstream fout;
-
-    if (filename != NULL) {
-        fout.open(filename);
-        buf = fout.rdbuf();
-    } else {
-        buf = std::cout.rdbuf();
-    }
-
-    std::ostream out(buf);
-
     try {
-        ret = write_result(out, root);
+        ret = write_result(output, root);
     } catch (...) {
         ret = FREESASA_FAIL;
     }
 
-    if (filename != NULL) {
-        fout.close();
-    }
-
     if (ret == FREESASA_FAIL) {
         freesasa_fail("Unable to output CIF file");
     }
@@ -22,8 +22,9 @@ freesasa_cif_structure_array(std::FILE *input,
                              const freesasa_classifier *classifier,
                              int options);
 
-/// If filename is NULL output will be written to stdout
-int freesasa_export_tree_to_cif(const char *filename,
+/// Writes the input documents of the results with the SASA of each
+/// atom added, each document is released once it has been written
+int freesasa_export_tree_to_cif(std::FILE *output,
                                 freesasa_node *root);
 
 #endif /* CIF_HH */
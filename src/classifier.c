@@ -3,6 +3,9 @@
 #endif
 
 #include <assert.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #if HAVE_STRINGS_H
 #include <strings.h>
@@ -24,9 +27,14 @@
 
 static const struct classifier_types empty_types = {0, NULL, NULL, NULL};
 
-static const struct classifier_residue empty_residue = {0, NULL, NULL, NULL, NULL, {NULL, 0, 0, 0, 0, 0}};
+static const struct classifier_residue empty_residue = {0, NULL, NULL, NULL, NULL, {NULL, 0, 0, 0, 0, 0}, {0, NULL, NULL, 0}};
+
+static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL, {0, NULL, NULL, 0}, NULL};
 
-static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL};
+/* number of seeds tried per table size when making a perfect hash,
+   and the number of times the table size is doubled */
+#define PERFECT_HASH_TRIES 4096
+#define PERFECT_HASH_GROW 4
 
 struct classifier_types *
 freesasa_classifier_types_new(void)
@@ -90,6 +98,8 @@ void freesasa_classifier_residue_free(struct classifier_residue *res)
 
         free(res->atom_radius);
         free(res->atom_class);
+        free(res->atom_hash.slot);
+        free(res->atom_hash.key);
 
         free(res);
     }
@@ -109,17 +119,89 @@ freesasa_classifier_new()
 void freesasa_classifier_free(freesasa_classifier *c)
 {
     int i;
-    if (c != NULL) {
+    if (c != NULL && c->file != NULL) {
+        /* read by read_binary() */
+        freesasa_pdb_buffer_free(c->file);
+        free(c);
+    } else if (c != NULL) {
         if (c->residue)
             for (i = 0; i < c->n_residues; ++i)
                 freesasa_classifier_residue_free(c->residue[i]);
         free(c->residue);
         free(c->residue_name);
+        free(c->residue_hash.slot);
+        free(c->residue_hash.key);
         free(c->name);
         free(c);
     }
 }
 
+/* The first word of key, i.e. without leading and trailing
+   whitespace, the length is written to length */
+static const char *
+name_token(const char *key,
+           size_t *length)
+{
+    const char *end;
+
+    while (isspace((unsigned char)*key)) ++key;
+    for (end = key; *end != '\0' && !isspace((unsigned char)*end); ++end)
+        ;
+    *length = end - key;
+
+    return key;
+}
+
+/* 32-bit FNV-1a, config2c.pl has a copy of this function */
+static uint32_t
+name_hash(const char *name,
+          size_t length)
+{
+    uint32_t h = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < length; ++i) {
+        h = (h ^ (unsigned char)name[i]) * 16777619u;
+    }
+
+    return h;
+}
+
+static int
+name_eq(const char *name,
+        const char *token,
+        size_t length)
+{
+    return strncmp(name, token, length) == 0 && name[length] == '\0';
+}
+
+/* The first four characters of a name as an integer, zero-padded */
+static uint32_t
+name_pack(const char *name,
+          size_t length)
+{
+    uint32_t packed = 0;
+    size_t i;
+
+    assert(length <= 4);
+
+    for (i = 0; i < length; ++i) {
+        packed |= (uint32_t)(unsigned char)name[i] << (8 * i);
+    }
+
+    return packed;
+}
+
+/* The slot of a packed name in a perfect hash table,
+   config2c.pl has a copy of this function */
+static uint32_t
+perfect_slot(uint32_t packed,
+             uint32_t seed,
+             int n_slots)
+{
+    return ((uint32_t)(packed * seed) >> 16) & (n_slots - 1);
+}
+
 /* check if array of strings has a string that matches key,
    ignores trailing and leading whitespace */
 static int
@@ -127,33 +209,161 @@ find_string(char **array,
             const char *key,
             int array_size)
 {
-    int n, i, found = 0;
-    char *key_trimmed;
+    size_t length;
+    int i;
 
     if (array == NULL || array_size == 0) return -1;
 
-    n = strlen(key);
-    key_trimmed = malloc(n + 1);
-
-    if (key_trimmed == NULL) return mem_fail();
-
-    /* remove trailing and leading whitespace */
-    sscanf(key, "%s", key_trimmed);
+    key = name_token(key, &length);
 
     for (i = 0; i < array_size; ++i) {
         assert(array[i]);
-        if (strcmp(array[i], key_trimmed) == 0) {
-            found = 1;
-            break;
-        }
+        if (name_eq(array[i], key, length)) return i;
+    }
+
+    return FREESASA_FAIL;
+}
+
+/* same as find_string(), but uses the hash table of the array if
+   there is one */
+static int
+find_name(const struct classifier_hash *hash,
+          char **array,
+          const char *key,
+          int array_size)
+{
+    size_t length;
+    uint32_t j, mask, packed;
+    int i;
+
+    if (hash->n_slots == 0) return find_string(array, key, array_size);
+
+    key = name_token(key, &length);
+
+    if (hash->key != NULL) {
+        if (length == 0 || length > 4) return FREESASA_FAIL;
+        packed = name_pack(key, length);
+        j = perfect_slot(packed, hash->seed, hash->n_slots);
+        return hash->key[j] == packed ? hash->slot[j] - 1 : FREESASA_FAIL;
     }
 
-    free(key_trimmed);
+    mask = hash->n_slots - 1;
+
+    for (j = name_hash(key, length) & mask; (i = hash->slot[j]) != 0; j = (j + 1) & mask) {
+        if (name_eq(array[i - 1], key, length)) return i - 1;
+    }
 
-    if (found) return i;
     return FREESASA_FAIL;
 }
 
+/* Adds the last of the n names in array to the hash table, the
+   table is grown and all names reinserted when it's half full */
+static int
+hash_add(struct classifier_hash *hash,
+         char **array,
+         int n)
+{
+    int i, first = n - 1, n_slots = hash->n_slots, *slot = hash->slot;
+    uint32_t j, mask;
+
+    /* names can't be added to perfect tables, those are rebuilt */
+    if (2 * n > n_slots || hash->key != NULL) {
+        for (n_slots = 8; 2 * n > n_slots; n_slots *= 2)
+            ;
+        slot = calloc(n_slots, sizeof(int));
+        if (slot == NULL) return mem_fail();
+        free(hash->slot);
+        free(hash->key);
+        hash->slot = slot;
+        hash->key = NULL;
+        hash->n_slots = n_slots;
+        first = 0;
+    }
+    mask = n_slots - 1;
+
+    for (i = first; i < n; ++i) {
+        for (j = name_hash(array[i], strlen(array[i])) & mask; slot[j] != 0; j = (j + 1) & mask)
+            ;
+        slot[j] = i + 1;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Replaces the table of the n names in array with a perfect hash
+    table, if one can be found. The table size starts at twice the
+    number of names, and for each size seeds are tried in the same
+    order as in config2c.pl. Returns FREESASA_FAIL if memory
+    allocation fails, else FREESASA_SUCCESS, also if the names can't
+    be packed or no seed is found.
+ */
+static int
+hash_make_perfect(struct classifier_hash *hash,
+                  char **array,
+                  int n)
+{
+    uint32_t *packed, *key = NULL, seed = 0, j;
+    int i, k, grow, n_slots, *slot = NULL, found = 0;
+    size_t length;
+
+    if (n == 0) return FREESASA_SUCCESS;
+
+    packed = malloc(sizeof(uint32_t) * n);
+    if (packed == NULL) return mem_fail();
+
+    for (i = 0; i < n; ++i) {
+        length = strlen(array[i]);
+        if (length == 0 || length > 4) {
+            free(packed);
+            return FREESASA_SUCCESS;
+        }
+        packed[i] = name_pack(array[i], length);
+    }
+
+    for (n_slots = 8; 2 * n > n_slots; n_slots *= 2)
+        ;
+
+    for (grow = 0; grow < PERFECT_HASH_GROW; ++grow, n_slots *= 2) {
+        key = malloc(sizeof(uint32_t) * n_slots);
+        slot = calloc(n_slots, sizeof(int));
+        if (key == NULL || slot == NULL) {
+            free(key);
+            free(slot);
+            free(packed);
+            return mem_fail();
+        }
+        for (k = 0; k < PERFECT_HASH_TRIES && !found; ++k) {
+            seed = 0x9E3779B1u + 2u * k;
+            memset(key, 0, sizeof(uint32_t) * n_slots);
+            for (i = 0; i < n; ++i) {
+                j = perfect_slot(packed[i], seed, n_slots);
+                if (key[j] != 0) break;
+                key[j] = packed[i];
+            }
+            found = (i == n);
+        }
+        if (found) break;
+        free(key);
+        free(slot);
+    }
+    free(packed);
+
+    if (found) {
+        for (i = 0; i < n; ++i) {
+            slot[perfect_slot(name_pack(array[i], strlen(array[i])), seed, n_slots)] = i + 1;
+        }
+        free(hash->slot);
+        free(hash->key);
+        hash->slot = slot;
+        hash->key = key;
+        hash->seed = seed;
+        hash->n_slots = n_slots;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
 /**
    Removes comments and strips leading and trailing
    whitespace. Returns the length of the stripped line on success,
@@ -520,7 +730,7 @@ int freesasa_classifier_add_atom(struct classifier_residue *res,
     double *ar = res->atom_radius;
     freesasa_atom_class *ac = res->atom_class;
 
-    if (find_string(res->atom_name, name, res->n_atoms) >= 0)
+    if (find_name(&res->atom_hash, res->atom_name, name, res->n_atoms) >= 0)
         return freesasa_warn("ignoring duplicate configuration entry for atom '%s %s'",
                              res->name, name);
     n = res->n_atoms + 1;
@@ -539,6 +749,10 @@ int freesasa_classifier_add_atom(struct classifier_residue *res,
     }
     if ((res->atom_name[n - 1] = strdup(name)) == NULL)
         return mem_fail();
+    if (hash_add(&res->atom_hash, res->atom_name, n)) {
+        free(res->atom_name[n - 1]);
+        return FREESASA_FAIL;
+    }
 
     ++res->n_atoms;
     res->atom_radius[n - 1] = radius;
@@ -557,7 +771,7 @@ int freesasa_classifier_add_residue(struct freesasa_classifier *c,
 {
     char **rn = c->residue_name;
     struct classifier_residue **cr = c->residue;
-    int res = find_string(c->residue_name, name, c->n_residues);
+    int res = find_name(&c->residue_hash, c->residue_name, name, c->n_residues);
 
     if (res >= 0) return res;
 
@@ -576,9 +790,14 @@ int freesasa_classifier_add_residue(struct freesasa_classifier *c,
     if ((c->residue[res - 1] = freesasa_classifier_residue_new(name)) == NULL) {
         return mem_fail();
     }
+    c->residue_name[res - 1] = c->residue[res - 1]->name;
+
+    if (hash_add(&c->residue_hash, c->residue_name, res)) {
+        freesasa_classifier_residue_free(c->residue[res - 1]);
+        return FREESASA_FAIL;
+    }
 
     ++c->n_residues;
-    c->residue_name[res - 1] = c->residue[res - 1]->name;
     return res - 1;
 }
 
@@ -699,6 +918,24 @@ read_name(struct freesasa_classifier *classifier,
     return FREESASA_SUCCESS;
 }
 
+/* Replaces the hash tables by perfect ones, when all names are known */
+static int
+make_perfect(struct freesasa_classifier *c)
+{
+    int i;
+
+    if (hash_make_perfect(&c->residue_hash, c->residue_name, c->n_residues)) {
+        return fail_msg("");
+    }
+    for (i = 0; i < c->n_residues; ++i) {
+        if (hash_make_perfect(&c->residue[i]->atom_hash, c->residue[i]->atom_name, c->residue[i]->n_atoms)) {
+            return fail_msg("");
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
 static struct freesasa_classifier *
 read_config(FILE *input)
 {
@@ -720,6 +957,8 @@ read_config(FILE *input)
         goto cleanup;
     if (read_atoms(classifier, types, input, atoms_section))
         goto cleanup;
+    if (make_perfect(classifier))
+        goto cleanup;
 
     freesasa_classifier_types_free(types);
 
@@ -731,67 +970,86 @@ cleanup:
     return NULL;
 }
 
-/**
-    See if an atom_name has been defined for the residue ANY (writes
-    indices to the provided pointers).
- */
-static void
-find_any(const struct freesasa_classifier *c,
-         const char *atom_name,
-         int *res, int *atom)
+const struct classifier_residue *
+freesasa_classifier_template(const freesasa_classifier *classifier,
+                             const char *res_name)
 {
-    *res = find_string(c->residue_name, "ANY", c->n_residues);
-    if (*res >= 0) {
-        *atom = find_string(c->residue[*res]->atom_name,
-                            atom_name,
-                            c->residue[*res]->n_atoms);
-    }
+    int res;
+
+    assert(classifier);
+    assert(res_name);
+
+    res = find_name(&classifier->residue_hash, classifier->residue_name,
+                    res_name, classifier->n_residues);
+
+    return res >= 0 ? classifier->residue[res] : NULL;
 }
-/**
-    Find the residue and atom index of an atom in the supplied
-    configuration. Prints error and returns FREESASA_WARN if not
-    found.
- */
-static int
-find_atom(const struct freesasa_classifier *c,
-          const char *res_name,
-          const char *atom_name,
-          int *res,
-          int *atom)
+
+int freesasa_classifier_template_lookup(const freesasa_classifier *classifier,
+                                        const struct classifier_residue *residue,
+                                        const char *atom_name,
+                                        double *radius,
+                                        freesasa_atom_class *atom_class)
 {
-    const struct classifier_residue *residue;
-    *atom = -1;
-    *res = find_string(c->residue_name, res_name, c->n_residues);
-    if (*res < 0) {
-        find_any(c, atom_name, res, atom);
-    } else {
-        residue = c->residue[*res];
-        *atom = find_string(residue->atom_name, atom_name, residue->n_atoms);
-        if (*atom < 0) {
-            find_any(c, atom_name, res, atom);
+    int atom = -1;
+
+    assert(classifier);
+    assert(atom_name);
+    assert(radius);
+    assert(atom_class);
+
+    if (residue != NULL) {
+        atom = find_name(&residue->atom_hash, residue->atom_name, atom_name, residue->n_atoms);
+    }
+
+    /* see if the atom has been defined for the residue ANY */
+    if (atom < 0) {
+        residue = freesasa_classifier_template(classifier, "ANY");
+        if (residue != NULL) {
+            atom = find_name(&residue->atom_hash, residue->atom_name, atom_name, residue->n_atoms);
         }
     }
-    if (*atom < 0) {
+
+    if (atom < 0) {
+        *radius = -1.0;
+        *atom_class = FREESASA_ATOM_UNKNOWN;
         return FREESASA_WARN;
     }
+
+    *radius = residue->atom_radius[atom];
+    *atom_class = residue->atom_class[atom];
+
     return FREESASA_SUCCESS;
 }
 
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *atom_class,
+                               const freesasa_nodearea **reference)
+{
+    const struct classifier_residue *residue;
+
+    residue = freesasa_classifier_template(classifier, res_name);
+    if (reference) *reference = residue != NULL ? &residue->max_area : NULL;
+
+    return freesasa_classifier_template_lookup(classifier, residue, atom_name,
+                                               radius, atom_class);
+}
+
 double
 freesasa_classifier_radius(const freesasa_classifier *classifier,
                            const char *res_name,
                            const char *atom_name)
 {
-    int res, atom, status;
+    double radius;
+    freesasa_atom_class atom_class;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name,
+                               &radius, &atom_class, NULL);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_radius[atom];
-    return -1.0;
+    return radius;
 }
 
 freesasa_atom_class
@@ -799,16 +1057,13 @@ freesasa_classifier_class(const freesasa_classifier *classifier,
                           const char *res_name,
                           const char *atom_name)
 {
-    int res, atom, status;
+    double radius;
+    freesasa_atom_class atom_class;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name,
+                               &radius, &atom_class, NULL);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_class[atom];
-    return FREESASA_ATOM_UNKNOWN;
+    return atom_class;
 }
 
 const char *
@@ -836,10 +1091,474 @@ freesasa_result_classes(const freesasa_structure *structure,
     return area;
 }
 
+/* A binary classifier is a header followed by sections that start at
+   multiples of 8 bytes from the start of the file, so that the names,
+   radii, classes and hash tables can be used directly from the
+   memory-mapped file. All numbers are in the byte order of the
+   platform that wrote the file. The first byte of the magic can't
+   start a configuration file, which is how the two are told apart. */
+#define BINARY_MAGIC "\211freesasa-radii"
+#define BINARY_VERSION 1
+#define BINARY_BYTE_ORDER 0x0102030405060708ULL
+#define BINARY_ALIGN(size) (((size) + 7) & ~(size_t)7)
+#define BINARY_NO_NAME -1
+
+/* a struct classifier_hash, the slots and keys are stored at
+   first_slot in the slot and key sections */
+struct binary_hash {
+    int64_t n_slots;
+    int64_t first_slot;
+    uint64_t seed;
+    int64_t perfect; /* if the keys are used */
+};
+
+struct binary_residue {
+    int64_t name; /* offset in strings */
+    int64_t n_atoms;
+    int64_t first_atom; /* in the atom sections */
+    int64_t area_name;  /* offset in strings or BINARY_NO_NAME */
+    double area[6];     /* max_area, in the order of freesasa_nodearea */
+    struct binary_hash atom_hash;
+};
+
+enum binary_section {
+    BINARY_RESIDUES,    /* struct binary_residue[n_residues] */
+    BINARY_ATOM_NAME,   /* int64_t[n_atoms], offsets in strings */
+    BINARY_ATOM_RADIUS, /* double[n_atoms] */
+    BINARY_ATOM_CLASS,  /* int32_t[n_atoms] */
+    BINARY_SLOT,        /* int32_t[n_slots], all tables after each other */
+    BINARY_KEY,         /* uint32_t[n_slots] */
+    BINARY_STRINGS,     /* char[strings_size], NUL-terminated strings */
+    BINARY_N_SECTIONS
+};
+
+struct binary_header {
+    char magic[16];
+    uint64_t version;
+    uint64_t byte_order;
+    uint64_t size; /* of the file */
+    int64_t n_residues;
+    int64_t n_atoms; /* of all residues */
+    int64_t n_slots; /* of all tables */
+    int64_t name;    /* offset in strings or BINARY_NO_NAME */
+    int64_t strings_size;
+    struct binary_hash residue_hash;
+    uint64_t offset[BINARY_N_SECTIONS];
+};
+
+/* adds a string to the string section, returns its offset */
+static int64_t
+binary_add_string(char *strings,
+                  int64_t *size,
+                  const char *str)
+{
+    int64_t offset = *size;
+
+    if (str == NULL) return BINARY_NO_NAME;
+    if (strings != NULL) strcpy(strings + offset, str);
+    *size += strlen(str) + 1;
+
+    return offset;
+}
+
+/* copies a hash table to the slot and key sections */
+static void
+binary_add_hash(struct binary_hash *out,
+                int32_t *slot,
+                uint32_t *key,
+                int64_t *n_slots,
+                const struct classifier_hash *hash)
+{
+    int i;
+
+    out->n_slots = hash->n_slots;
+    out->first_slot = *n_slots;
+    out->seed = hash->seed;
+    out->perfect = hash->key != NULL;
+    for (i = 0; i < hash->n_slots; ++i) {
+        slot[*n_slots + i] = hash->slot[i];
+        key[*n_slots + i] = hash->key ? hash->key[i] : 0;
+    }
+    *n_slots += hash->n_slots;
+}
+
+static int
+binary_write_data(FILE *output,
+                  const void *data,
+                  size_t size)
+{
+    static const char padding[8] = {0};
+    size_t n = BINARY_ALIGN(size) - size;
+
+    if (size > 0 && fwrite(data, 1, size, output) != size) return FREESASA_FAIL;
+    if (n > 0 && fwrite(padding, 1, n, output) != n) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_classifier_write_binary(FILE *output,
+                                     const freesasa_classifier *classifier)
+{
+    struct binary_header header;
+    struct binary_residue *residues = NULL;
+    const struct classifier_residue *res;
+    const void *section[BINARY_N_SECTIONS];
+    size_t size[BINARY_N_SECTIONS];
+    int64_t *atom_name = NULL, n_atoms = 0, n_slots, pos;
+    double *radius = NULL;
+    int32_t *atom_class = NULL, *slot = NULL;
+    uint32_t *key = NULL;
+    char *strings = NULL;
+    int i, j, k, pass, ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(classifier);
+
+    memset(&header, 0, sizeof(header));
+
+    n_slots = classifier->residue_hash.n_slots;
+    for (i = 0; i < classifier->n_residues; ++i) {
+        n_atoms += classifier->residue[i]->n_atoms;
+        n_slots += classifier->residue[i]->atom_hash.n_slots;
+    }
+
+    /* allocate at least one element to avoid malloc(0) */
+    residues = malloc(sizeof(struct binary_residue) * (classifier->n_residues + 1));
+    atom_name = malloc(sizeof(int64_t) * (n_atoms + 1));
+    radius = malloc(sizeof(double) * (n_atoms + 1));
+    atom_class = malloc(sizeof(int32_t) * (n_atoms + 1));
+    slot = malloc(sizeof(int32_t) * (n_slots + 1));
+    key = malloc(sizeof(uint32_t) * (n_slots + 1));
+    if (!residues || !atom_name || !radius || !atom_class || !slot || !key) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    /* the first pass finds the size of the strings, the second copies them */
+    for (pass = 0; pass < 2; ++pass) {
+        header.strings_size = 0;
+        header.n_slots = 0;
+        header.name = binary_add_string(strings, &header.strings_size, classifier->name);
+        binary_add_hash(&header.residue_hash, slot, key, &header.n_slots, &classifier->residue_hash);
+        for (i = 0, k = 0; i < classifier->n_residues; ++i) {
+            res = classifier->residue[i];
+            residues[i].name = binary_add_string(strings, &header.strings_size, res->name);
+            residues[i].n_atoms = res->n_atoms;
+            residues[i].first_atom = k;
+            residues[i].area_name = binary_add_string(strings, &header.strings_size, res->max_area.name);
+            residues[i].area[0] = res->max_area.total;
+            residues[i].area[1] = res->max_area.main_chain;
+            residues[i].area[2] = res->max_area.side_chain;
+            residues[i].area[3] = res->max_area.polar;
+            residues[i].area[4] = res->max_area.apolar;
+            residues[i].area[5] = res->max_area.unknown;
+            binary_add_hash(&residues[i].atom_hash, slot, key, &header.n_slots, &res->atom_hash);
+            for (j = 0; j < res->n_atoms; ++j, ++k) {
+                atom_name[k] = binary_add_string(strings, &header.strings_size, res->atom_name[j]);
+                radius[k] = res->atom_radius[j];
+                atom_class[k] = res->atom_class[j];
+            }
+        }
+        if (pass == 0) {
+            strings = malloc(header.strings_size + 1);
+            if (strings == NULL) {
+                mem_fail();
+                goto cleanup;
+            }
+        }
+    }
+
+    section[BINARY_RESIDUES] = residues;
+    size[BINARY_RESIDUES] = sizeof(struct binary_residue) * classifier->n_residues;
+    section[BINARY_ATOM_NAME] = atom_name;
+    size[BINARY_ATOM_NAME] = sizeof(int64_t) * n_atoms;
+    section[BINARY_ATOM_RADIUS] = radius;
+    size[BINARY_ATOM_RADIUS] = sizeof(double) * n_atoms;
+    section[BINARY_ATOM_CLASS] = atom_class;
+    size[BINARY_ATOM_CLASS] = sizeof(int32_t) * n_atoms;
+    section[BINARY_SLOT] = slot;
+    size[BINARY_SLOT] = sizeof(int32_t) * n_slots;
+    section[BINARY_KEY] = key;
+    size[BINARY_KEY] = sizeof(uint32_t) * n_slots;
+    section[BINARY_STRINGS] = strings;
+    size[BINARY_STRINGS] = header.strings_size;
+
+    strcpy(header.magic, BINARY_MAGIC);
+    header.version = BINARY_VERSION;
+    header.byte_order = BINARY_BYTE_ORDER;
+    header.n_residues = classifier->n_residues;
+    header.n_atoms = n_atoms;
+    pos = BINARY_ALIGN(sizeof(header));
+    for (k = 0; k < BINARY_N_SECTIONS; ++k) {
+        header.offset[k] = pos;
+        pos += BINARY_ALIGN(size[k]);
+    }
+    header.size = pos;
+
+    if (binary_write_data(output, &header, sizeof(header))) goto write_error;
+    for (k = 0; k < BINARY_N_SECTIONS; ++k) {
+        if (binary_write_data(output, section[k], size[k])) goto write_error;
+    }
+    fflush(output);
+    if (ferror(output)) goto write_error;
+
+    ret = FREESASA_SUCCESS;
+    goto cleanup;
+
+write_error:
+    fail_msg("could not write binary classifier: %s", strerror(errno));
+
+cleanup:
+    free(residues);
+    free(atom_name);
+    free(radius);
+    free(atom_class);
+    free(slot);
+    free(key);
+    free(strings);
+
+    return ret;
+}
+
+/* checks that a section with n elements of given size fits in the file */
+static int
+binary_section_fits(const struct binary_header *header,
+                    int section,
+                    int64_t n,
+                    size_t element_size)
+{
+    uint64_t offset = header->offset[section];
+
+    return n >= 0 && offset % 8 == 0 && offset <= header->size &&
+           (uint64_t)n <= (header->size - offset) / element_size;
+}
+
+static int
+binary_check_string(const struct binary_header *header,
+                    int64_t offset)
+{
+    return offset >= 0 && offset < header->strings_size;
+}
+
+/* checks that a table has valid slots for n_names names, and an empty
+   slot if linear probing is used */
+static int
+binary_check_hash(const struct binary_header *header,
+                  const int32_t *slot,
+                  const struct binary_hash *hash,
+                  int64_t n_names)
+{
+    int64_t i, n_used = 0;
+
+    if (hash->n_slots < 0 || hash->n_slots > INT32_MAX ||
+        (hash->n_slots & (hash->n_slots - 1)) != 0 ||
+        hash->first_slot < 0 || hash->first_slot > header->n_slots ||
+        hash->n_slots > header->n_slots - hash->first_slot ||
+        hash->seed > UINT32_MAX ||
+        (hash->perfect && hash->n_slots == 0)) {
+        return FREESASA_FAIL;
+    }
+    for (i = 0; i < hash->n_slots; ++i) {
+        if (slot[hash->first_slot + i] < 0 || slot[hash->first_slot + i] > n_names) return FREESASA_FAIL;
+        if (slot[hash->first_slot + i] > 0) ++n_used;
+    }
+    if (!hash->perfect && hash->n_slots > 0 && n_used == hash->n_slots) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+/* checks everything the classifier uses, so that lookups can trust it */
+static int
+binary_check(const char *data,
+             const struct binary_header *h)
+{
+    const struct binary_residue *residues = (const struct binary_residue *)(data + h->offset[BINARY_RESIDUES]);
+    const int64_t *atom_name = (const int64_t *)(data + h->offset[BINARY_ATOM_NAME]);
+    const double *radius = (const double *)(data + h->offset[BINARY_ATOM_RADIUS]);
+    const int32_t *atom_class = (const int32_t *)(data + h->offset[BINARY_ATOM_CLASS]),
+                  *slot = (const int32_t *)(data + h->offset[BINARY_SLOT]);
+    const char *strings = data + h->offset[BINARY_STRINGS];
+    int64_t i, j;
+
+    if (h->n_residues < 0 || h->n_residues > INT32_MAX ||
+        h->n_atoms < 0 || h->n_atoms > INT32_MAX ||
+        h->n_slots < 0 || h->n_slots > INT32_MAX ||
+        h->strings_size <= 0 ||
+        !binary_section_fits(h, BINARY_RESIDUES, h->n_residues, sizeof(struct binary_residue)) ||
+        !binary_section_fits(h, BINARY_ATOM_NAME, h->n_atoms, sizeof(int64_t)) ||
+        !binary_section_fits(h, BINARY_ATOM_RADIUS, h->n_atoms, sizeof(double)) ||
+        !binary_section_fits(h, BINARY_ATOM_CLASS, h->n_atoms, sizeof(int32_t)) ||
+        !binary_section_fits(h, BINARY_SLOT, h->n_slots, sizeof(int32_t)) ||
+        !binary_section_fits(h, BINARY_KEY, h->n_slots, sizeof(uint32_t)) ||
+        !binary_section_fits(h, BINARY_STRINGS, h->strings_size, 1)) {
+        return FREESASA_FAIL;
+    }
+
+    if (strings[h->strings_size - 1] != '\0' ||
+        (h->name != BINARY_NO_NAME && !binary_check_string(h, h->name)) ||
+        binary_check_hash(h, slot, &h->residue_hash, h->n_residues)) {
+        return FREESASA_FAIL;
+    }
+    for (i = 0; i < h->n_residues; ++i) {
+        if (!binary_check_string(h, residues[i].name) ||
+            (residues[i].area_name != BINARY_NO_NAME && !binary_check_string(h, residues[i].area_name)) ||
+            residues[i].n_atoms < 0 || residues[i].first_atom < 0 ||
+            residues[i].first_atom > h->n_atoms ||
+            residues[i].n_atoms > h->n_atoms - residues[i].first_atom ||
+            binary_check_hash(h, slot, &residues[i].atom_hash, residues[i].n_atoms)) {
+            return FREESASA_FAIL;
+        }
+        for (j = 0; j < 6; ++j) {
+            if (!isfinite(residues[i].area[j])) return FREESASA_FAIL;
+        }
+    }
+    for (i = 0; i < h->n_atoms; ++i) {
+        if (!binary_check_string(h, atom_name[i]) ||
+            !isfinite(radius[i]) || radius[i] < 0 ||
+            atom_class[i] < FREESASA_ATOM_APOLAR || atom_class[i] > FREESASA_ATOM_UNKNOWN) {
+            return FREESASA_FAIL;
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+static void
+binary_hash(struct classifier_hash *hash,
+            const char *data,
+            const struct binary_header *h,
+            const struct binary_hash *in)
+{
+    hash->n_slots = (int)in->n_slots;
+    hash->slot = (int *)(data + h->offset[BINARY_SLOT]) + in->first_slot;
+    hash->key = in->perfect ? (uint32_t *)(data + h->offset[BINARY_KEY]) + in->first_slot : NULL;
+    hash->seed = (uint32_t)in->seed;
+}
+
+/* alignment of the parts of a classifier read from a binary file */
+union binary_align {
+    void *p;
+    double d;
+    int64_t l;
+};
+#define BINARY_PART(size) (((size) + sizeof(union binary_align) - 1) / sizeof(union binary_align) * sizeof(union binary_align))
+
+/* The names, radii, classes and tables point into the file, the
+   classifier, residues and name arrays are one allocation */
+static struct freesasa_classifier *
+read_binary(FILE *input)
+{
+    struct pdb_buffer *buffer;
+    struct binary_header header;
+    const struct binary_residue *residues;
+    const int64_t *atom_name;
+    const char *data, *strings;
+    struct freesasa_classifier *c = NULL;
+    struct classifier_residue *res;
+    char **names;
+    int i, j, nr, n;
+
+    /* the arrays in the file are used directly as the arrays of the classifier */
+    assert(sizeof(int) == sizeof(int32_t));
+    assert(sizeof(freesasa_atom_class) == sizeof(int32_t));
+
+    buffer = freesasa_pdb_buffer_new(input);
+    if (buffer == NULL) {
+        fail_msg("problems reading binary classifier");
+        return NULL;
+    }
+    data = buffer->data;
+
+    if (buffer->size < sizeof(header)) goto invalid;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) goto invalid;
+    if (header.byte_order != BINARY_BYTE_ORDER) {
+        fail_msg("binary classifier was written on a platform with different byte order");
+        goto cleanup;
+    }
+    if (header.version != BINARY_VERSION) {
+        fail_msg("binary classifier has version %lu, expected %d",
+                 (unsigned long)header.version, BINARY_VERSION);
+        goto cleanup;
+    }
+    if (header.size != buffer->size || binary_check(data, &header)) goto invalid;
+
+    nr = (int)header.n_residues;
+    n = (int)header.n_atoms;
+    residues = (const struct binary_residue *)(data + header.offset[BINARY_RESIDUES]);
+    atom_name = (const int64_t *)(data + header.offset[BINARY_ATOM_NAME]);
+    strings = data + header.offset[BINARY_STRINGS];
+
+    c = malloc(BINARY_PART(sizeof(struct freesasa_classifier)) +
+               BINARY_PART(sizeof(struct classifier_residue) * nr) +
+               BINARY_PART(sizeof(struct classifier_residue *) * nr) +
+               sizeof(char *) * (nr + n));
+    if (c == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    *c = empty_config;
+    res = (struct classifier_residue *)((char *)c + BINARY_PART(sizeof(struct freesasa_classifier)));
+    c->residue = (struct classifier_residue **)((char *)res + BINARY_PART(sizeof(struct classifier_residue) * nr));
+    c->residue_name = (char **)((char *)c->residue + BINARY_PART(sizeof(struct classifier_residue *) * nr));
+    names = c->residue_name + nr;
+
+    c->n_residues = nr;
+    c->name = header.name == BINARY_NO_NAME ? NULL : (char *)strings + header.name;
+    binary_hash(&c->residue_hash, data, &header, &header.residue_hash);
+
+    for (i = 0; i < nr; ++i) {
+        res[i] = empty_residue;
+        res[i].n_atoms = (int)residues[i].n_atoms;
+        res[i].name = (char *)strings + residues[i].name;
+        res[i].atom_name = names + residues[i].first_atom;
+        res[i].atom_radius = (double *)(data + header.offset[BINARY_ATOM_RADIUS]) + residues[i].first_atom;
+        res[i].atom_class = (freesasa_atom_class *)(data + header.offset[BINARY_ATOM_CLASS]) + residues[i].first_atom;
+        res[i].max_area.name = residues[i].area_name == BINARY_NO_NAME ? NULL : strings + residues[i].area_name;
+        res[i].max_area.total = residues[i].area[0];
+        res[i].max_area.main_chain = residues[i].area[1];
+        res[i].max_area.side_chain = residues[i].area[2];
+        res[i].max_area.polar = residues[i].area[3];
+        res[i].max_area.apolar = residues[i].area[4];
+        res[i].max_area.unknown = residues[i].area[5];
+        binary_hash(&res[i].atom_hash, data, &header, &residues[i].atom_hash);
+        c->residue[i] = &res[i];
+        c->residue_name[i] = res[i].name;
+    }
+    for (j = 0; j < n; ++j) {
+        names[j] = (char *)strings + atom_name[j];
+    }
+
+    c->file = buffer;
+
+    return c;
+
+invalid:
+    fail_msg("invalid binary classifier");
+
+cleanup:
+    free(c);
+    freesasa_pdb_buffer_free(buffer);
+
+    return NULL;
+}
+
 freesasa_classifier *
 freesasa_classifier_from_file(FILE *file)
 {
-    struct freesasa_classifier *classifier = read_config(file);
+    struct freesasa_classifier *classifier;
+    int first;
+
+    assert(file);
+
+    rewind(file);
+    first = getc(file);
+    rewind(file);
+    if (first == (unsigned char)BINARY_MAGIC[0]) {
+        classifier = read_binary(file);
+    } else {
+        classifier = read_config(file);
+    }
 
     if (classifier == NULL) {
         fail_msg("");
@@ -853,11 +1572,12 @@ const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name)
 {
-    int res = find_string(classifier->residue_name, res_name, classifier->n_residues);
+    const struct classifier_residue *residue =
+        freesasa_classifier_template(classifier, res_name);
 
-    if (res < 0) return NULL;
+    if (residue == NULL) return NULL;
 
-    return &classifier->residue[res]->max_area;
+    return &residue->max_area;
 }
 
 const char *
@@ -1,8 +1,12 @@
 #ifndef CLASSIFIER_H
 #define CLASSIFIER_H
 
+#include <stdint.h>
+
 #include "freesasa_internal.h"
 
+struct pdb_buffer;
+
 /**
     This classifier only has the sasa_class() and class2str()
     functions, which returns 1 for protein backbone atoms, and 0
@@ -24,6 +28,30 @@ extern const freesasa_classifier freesasa_residue_classifier;
     generic searching.
 */
 
+/**
+    Hash table of names.
+
+    Each slot holds the index + 1 of a name in the array the table
+    belongs to, or 0 if the slot is empty. The number of slots is a
+    power of two, at least twice the number of names. If there are no
+    slots, the names are searched linearly.
+
+    While a classifier is built, the table uses open addressing and
+    linear probing, with 32-bit FNV-1a as hash function. When all
+    names are known, and none of them is longer than four characters,
+    the table is replaced by a perfect hash: each name is packed into
+    a 32-bit integer, which is stored in key, and is in the slot
+    `((packed * seed) >> 16) & (n_slots - 1)`, which no other name
+    maps to. A lookup is then one comparison of integers. The static
+    classifiers have perfect tables generated by config2c.pl.
+ */
+struct classifier_hash {
+    int n_slots;   /**< Number of slots */
+    int *slot;     /**< The slots */
+    uint32_t *key; /**< Packed name in each slot, NULL if not perfect */
+    uint32_t seed; /**< Multiplier of the perfect hash */
+};
+
 /**
     Struct to store information about the types-section in a user-config.
  */
@@ -44,6 +72,7 @@ struct classifier_residue {
     double *atom_radius;             /**< Atomic radii */
     freesasa_atom_class *atom_class; /**< Classes of atoms */
     freesasa_nodearea max_area;      /**< Maximum area (for RSA) */
+    struct classifier_hash atom_hash; /**< Index of atom_name */
 };
 
 /**
@@ -63,6 +92,9 @@ struct freesasa_classifier {
     char **residue_name; /**< Names of residues */
     char *name;
     struct classifier_residue **residue;
+    struct classifier_hash residue_hash; /**< Index of residue_name */
+    struct pdb_buffer *file; /**< Binary file that the names and
+                                tables point into, or NULL */
 };
 
 /**
@@ -75,6 +107,70 @@ const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name);
 
+/**
+    Look up radius, class and residue reference of an atom at once.
+
+    The atom is looked up in the residue, and then in the residue
+    `ANY`. The reference is that of the residue, if it is in the
+    classifier.
+
+    @param classifier The classifier.
+    @param res_name Residue name.
+    @param atom_name Atom name.
+    @param radius The radius is written here, or -1 if the atom is
+      unknown.
+    @param atom_class The class is written here,
+      ::FREESASA_ATOM_UNKNOWN if the atom is unknown.
+    @param reference The reference of the residue is written here,
+      `NULL` if the residue is unknown. Can be `NULL`.
+
+    @return ::FREESASA_SUCCESS if the atom was found,
+      ::FREESASA_WARN if it's unknown.
+ */
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *atom_class,
+                               const freesasa_nodearea **reference);
+
+/**
+    Find the template of a residue, to look up all its atoms with
+    freesasa_classifier_template_lookup() without looking up the
+    residue for each of them.
+
+    @param classifier The classifier.
+    @param res_name Residue name.
+
+    @return The residue, `NULL` if it's not in the classifier.
+ */
+const struct classifier_residue *
+freesasa_classifier_template(const freesasa_classifier *classifier,
+                             const char *res_name);
+
+/**
+    Look up radius and class of an atom in a residue template, and
+    then in the residue `ANY`.
+
+    @param classifier The classifier the template belongs to.
+    @param residue The template, as returned by
+      freesasa_classifier_template(), `NULL` if the residue is not in
+      the classifier.
+    @param atom_name Atom name.
+    @param radius The radius is written here, or -1 if the atom is
+      unknown.
+    @param atom_class The class is written here,
+      ::FREESASA_ATOM_UNKNOWN if the atom is unknown.
+
+    @return ::FREESASA_SUCCESS if the atom was found,
+      ::FREESASA_WARN if it's unknown.
+ */
+int freesasa_classifier_template_lookup(const freesasa_classifier *classifier,
+                                        const struct classifier_residue *residue,
+                                        const char *atom_name,
+                                        double *radius,
+                                        freesasa_atom_class *atom_class);
+
 /* The functions below are only exposed to allow testing */
 freesasa_classifier *
 freesasa_classifier_new(void);
@@ -3,9 +3,13 @@
 /* Autogenerated code from the script config2c.pl */
 
 static const char *naccess_residue_name[] = {"A", "ALA", "ANY", "ARG", "ASN", "ASP", "C", "CYS", "DA", "DC", "DG", "DI", "DT", "DU", "G", "GLN", "GLU", "GLY", "HIS", "I", "ILE", "LEU", "LYS", "MET", "PHE", "PRO", "SEC", "SER", "T", "THR", "TRP", "TYR", "U", "VAL", };
-static const char *naccess_A_atom_name[] = {"C5", "C8", "N9", "N1", "N7", "N6", "C2", "N3", "C6", "C4", };
-static double naccess_A_atom_radius[] = {1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.80, 1.60, 1.80, 1.80, };
-static int naccess_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static int naccess_residue_slot[] = {0, 0, 6, 10, 3, 7, 0, 0, 0, 0, 0, 0, 9, 0, 17, 0, 0, 0, 0, 0, 0, 0, 1, 34, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 24, 32, 0, 0, 0, 19, 14, 0, 0, 0, 13, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 22, 2, 0, 0, 0, 16, 0, 0, 0, 21, 8, 0, 28, 0, 20, 0, 0, 0, 0, 0, 0, 0, 18, 0, 5, 0, 0, 0, 0, 0, 0, 15, 25, 0, 0, 12, 0, 0, 0, 33, 0, 0, 0, 0, 11, 0, 0, 27, 26, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, };
+static uint32_t naccess_residue_key[] = {0x0, 0x0, 0x505341, 0x4344, 0x594e41, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4144, 0x0, 0x554c47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x41, 0x4c4156, 0x0, 0x0, 0x0, 0x475241, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x505254, 0x0, 0x0, 0x0, 0x54454d, 0x525954, 0x0, 0x0, 0x0, 0x534948, 0x5544, 0x0, 0x0, 0x0, 0x5444, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53594c, 0x0, 0x0, 0x55454c, 0x414c41, 0x0, 0x0, 0x0, 0x4e4c47, 0x0, 0x0, 0x0, 0x454c49, 0x535943, 0x0, 0x524553, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x594c47, 0x0, 0x4e5341, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x47, 0x454850, 0x0, 0x0, 0x4944, 0x0, 0x0, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x4744, 0x0, 0x0, 0x434553, 0x4f5250, 0x0, 0x0, 0x0, 0x0, 0x524854, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, };
+static const char *naccess_A_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N6", "N7", "N9", };
+static int naccess_A_atom_slot[] = {0, 0, 0, 5, 0, 7, 0, 0, 0, 1, 0, 0, 9, 0, 0, 0, 4, 6, 8, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 10, };
+static uint32_t naccess_A_atom_key[] = {0x0, 0x0, 0x0, 0x3843, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x314e, 0x364e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x394e, };
+static double naccess_A_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, };
+static int naccess_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_A_cfg = {
     10,
  "A",
@@ -13,9 +17,12 @@ static struct classifier_residue naccess_A_cfg = {
     (double*) naccess_A_atom_radius,
     (freesasa_atom_class*) naccess_A_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_A_atom_slot, naccess_A_atom_key, 0x9e3779b1u},
 };
 
 static const char *naccess_ALA_atom_name[] = {"CB", };
+static int naccess_ALA_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 0, };
+static uint32_t naccess_ALA_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x4243, 0x0, 0x0, 0x0, };
 static double naccess_ALA_atom_radius[] = {1.87, };
 static int naccess_ALA_atom_class[] = {FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_ALA_cfg = {
@@ -25,11 +32,14 @@ static struct classifier_residue naccess_ALA_cfg = {
     (double*) naccess_ALA_atom_radius,
     (freesasa_atom_class*) naccess_ALA_atom_class,
  {"ALA", 107.89, 43.94, 63.94, 36.71, 71.17, 0},
+    {8, naccess_ALA_atom_slot, naccess_ALA_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_ANY_atom_name[] = {"OXT", "O5'", "C", "P", "N", "CB", "OP1", "C5'", "O", "CA", "C3'", "C4'", "C1'", "C2'", "O4'", "O3'", "OP3", "OP2", "O2'", };
-static double naccess_ANY_atom_radius[] = {1.40, 1.40, 1.76, 1.90, 1.65, 1.87, 1.40, 1.80, 1.40, 1.87, 1.80, 1.80, 1.80, 1.80, 1.40, 1.40, 1.40, 1.40, 1.40, };
-static int naccess_ANY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_ANY_atom_name[] = {"C", "C1'", "C2'", "C3'", "C4'", "C5'", "CA", "CB", "N", "O", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "OXT", "P", };
+static int naccess_ANY_atom_slot[] = {0, 2, 14, 0, 1, 0, 0, 0, 13, 15, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 16, 11, 19, 0, 18, 0, 0, 0, 0, 0, 10, 17, 0, 0, 0, 0, 0, 0, 0, 9, 6, 0, 0, 8, 0, 0, 0, 5, 0, 7, 0, 0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, };
+static uint32_t naccess_ANY_atom_key[] = {0x0, 0x273143, 0x27354f, 0x0, 0x43, 0x0, 0x0, 0x0, 0x27344f, 0x31504f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x27324f, 0x50, 0x0, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x33504f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0x273543, 0x0, 0x0, 0x4243, 0x0, 0x0, 0x0, 0x273443, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, };
+static double naccess_ANY_atom_radius[] = {1.76, 1.80, 1.80, 1.80, 1.80, 1.80, 1.87, 1.87, 1.65, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.90, };
+static int naccess_ANY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_ANY_cfg = {
     19,
  "ANY",
@@ -37,11 +47,14 @@ static struct classifier_residue naccess_ANY_cfg = {
     (double*) naccess_ANY_atom_radius,
     (freesasa_atom_class*) naccess_ANY_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, naccess_ANY_atom_slot, naccess_ANY_atom_key, 0x9e3779cbu},
 };
 
-static const char *naccess_ARG_atom_name[] = {"NH2", "CD", "NE", "CG", "CZ", "NH1", };
-static double naccess_ARG_atom_radius[] = {1.65, 1.87, 1.65, 1.87, 1.76, 1.65, };
-static int naccess_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_ARG_atom_name[] = {"CD", "CG", "CZ", "NE", "NH1", "NH2", };
+static int naccess_ARG_atom_slot[] = {0, 5, 6, 4, 2, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, };
+static uint32_t naccess_ARG_atom_key[] = {0x0, 0x31484e, 0x32484e, 0x454e, 0x4743, 0x0, 0x0, 0x4443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a43, 0x0, 0x0, };
+static double naccess_ARG_atom_radius[] = {1.87, 1.87, 1.76, 1.65, 1.65, 1.65, };
+static int naccess_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ARG_cfg = {
     6,
  "ARG",
@@ -49,10 +62,13 @@ static struct classifier_residue naccess_ARG_cfg = {
     (double*) naccess_ARG_atom_radius,
     (freesasa_atom_class*) naccess_ARG_atom_class,
  {"ARG", 238.33, 41.72, 196.61, 161.10, 77.23, 0},
+    {16, naccess_ARG_atom_slot, naccess_ARG_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_ASN_atom_name[] = {"CG", "OD1", "ND2", };
-static double naccess_ASN_atom_radius[] = {1.76, 1.40, 1.65, };
+static const char *naccess_ASN_atom_name[] = {"CG", "ND2", "OD1", };
+static int naccess_ASN_atom_slot[] = {0, 0, 0, 0, 0, 2, 1, 3, };
+static uint32_t naccess_ASN_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x32444e, 0x4743, 0x31444f, };
+static double naccess_ASN_atom_radius[] = {1.76, 1.65, 1.40, };
 static int naccess_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ASN_cfg = {
     3,
@@ -61,11 +77,14 @@ static struct classifier_residue naccess_ASN_cfg = {
     (double*) naccess_ASN_atom_radius,
     (freesasa_atom_class*) naccess_ASN_atom_class,
  {"ASN", 143.97, 41.03, 102.94, 97.83, 46.14, 0},
+    {8, naccess_ASN_atom_slot, naccess_ASN_atom_key, 0x9e3779b5u},
 };
 
-static const char *naccess_ASP_atom_name[] = {"OD1", "OD2", "CG", };
-static double naccess_ASP_atom_radius[] = {1.40, 1.40, 1.76, };
-static int naccess_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_ASP_atom_name[] = {"CG", "OD1", "OD2", };
+static int naccess_ASP_atom_slot[] = {0, 0, 2, 3, 1, 0, 0, 0, };
+static uint32_t naccess_ASP_atom_key[] = {0x0, 0x0, 0x31444f, 0x32444f, 0x4743, 0x0, 0x0, 0x0, };
+static double naccess_ASP_atom_radius[] = {1.76, 1.40, 1.40, };
+static int naccess_ASP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ASP_cfg = {
     3,
  "ASP",
@@ -73,11 +92,14 @@ static struct classifier_residue naccess_ASP_cfg = {
     (double*) naccess_ASP_atom_radius,
     (freesasa_atom_class*) naccess_ASP_atom_class,
  {"ASP", 140.48, 41.76, 98.72, 91.19, 49.29, 0},
+    {8, naccess_ASP_atom_slot, naccess_ASP_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_C_atom_name[] = {"C6", "C4", "N3", "N4", "C2", "N1", "C5", "O2", };
-static double naccess_C_atom_radius[] = {1.80, 1.80, 1.60, 1.60, 1.80, 1.60, 1.80, 1.40, };
-static int naccess_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_C_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "N4", "O2", };
+static int naccess_C_atom_slot[] = {4, 5, 0, 8, 0, 6, 3, 0, 0, 1, 0, 0, 2, 0, 0, 7, };
+static uint32_t naccess_C_atom_key[] = {0x3643, 0x314e, 0x0, 0x324f, 0x0, 0x334e, 0x3543, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x344e, };
+static double naccess_C_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_C_cfg = {
     8,
  "C",
@@ -85,9 +107,12 @@ static struct classifier_residue naccess_C_cfg = {
     (double*) naccess_C_atom_radius,
     (freesasa_atom_class*) naccess_C_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, naccess_C_atom_slot, naccess_C_atom_key, 0x9e3779b1u},
 };
 
 static const char *naccess_CYS_atom_name[] = {"SG", };
+static int naccess_CYS_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 0, };
+static uint32_t naccess_CYS_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x4753, 0x0, 0x0, 0x0, };
 static double naccess_CYS_atom_radius[] = {1.85, };
 static int naccess_CYS_atom_class[] = {FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_CYS_cfg = {
@@ -97,11 +122,14 @@ static struct classifier_residue naccess_CYS_cfg = {
     (double*) naccess_CYS_atom_radius,
     (freesasa_atom_class*) naccess_CYS_atom_class,
  {"CYS", 134.24, 41.92, 92.33, 36.49, 97.75, 0},
+    {8, naccess_CYS_atom_slot, naccess_CYS_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_DA_atom_name[] = {"N6", "N7", "N3", "C2", "C6", "C4", "C5", "C8", "N1", "N9", };
-static double naccess_DA_atom_radius[] = {1.60, 1.60, 1.60, 1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, };
-static int naccess_DA_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DA_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N6", "N7", "N9", };
+static int naccess_DA_atom_slot[] = {0, 0, 0, 5, 0, 7, 0, 0, 0, 1, 0, 0, 9, 0, 0, 0, 4, 6, 8, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 10, };
+static uint32_t naccess_DA_atom_key[] = {0x0, 0x0, 0x0, 0x3843, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x314e, 0x364e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x394e, };
+static double naccess_DA_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, };
+static int naccess_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DA_cfg = {
     10,
  "DA",
@@ -109,11 +137,14 @@ static struct classifier_residue naccess_DA_cfg = {
     (double*) naccess_DA_atom_radius,
     (freesasa_atom_class*) naccess_DA_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_DA_atom_slot, naccess_DA_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_DC_atom_name[] = {"N1", "C5", "O2", "C6", "C4", "N3", "N4", "C2", };
-static double naccess_DC_atom_radius[] = {1.60, 1.80, 1.40, 1.80, 1.80, 1.60, 1.60, 1.80, };
-static int naccess_DC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DC_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "N4", "O2", };
+static int naccess_DC_atom_slot[] = {4, 5, 0, 8, 0, 6, 3, 0, 0, 1, 0, 0, 2, 0, 0, 7, };
+static uint32_t naccess_DC_atom_key[] = {0x3643, 0x314e, 0x0, 0x324f, 0x0, 0x334e, 0x3543, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x344e, };
+static double naccess_DC_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DC_cfg = {
     8,
  "DC",
@@ -121,11 +152,14 @@ static struct classifier_residue naccess_DC_cfg = {
     (double*) naccess_DC_atom_radius,
     (freesasa_atom_class*) naccess_DC_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, naccess_DC_atom_slot, naccess_DC_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_DG_atom_name[] = {"N1", "N9", "C5", "C8", "O6", "C6", "C4", "N2", "N7", "N3", "C2", };
-static double naccess_DG_atom_radius[] = {1.60, 1.60, 1.80, 1.80, 1.40, 1.80, 1.80, 1.60, 1.60, 1.60, 1.80, };
-static int naccess_DG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DG_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O6", };
+static int naccess_DG_atom_slot[] = {10, 0, 0, 0, 5, 0, 8, 0, 0, 0, 1, 11, 7, 9, 0, 0, 0, 4, 0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, };
+static uint32_t naccess_DG_atom_key[] = {0x394e, 0x0, 0x0, 0x0, 0x3843, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x364f, 0x324e, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, };
+static double naccess_DG_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DG_cfg = {
     11,
  "DG",
@@ -133,11 +167,14 @@ static struct classifier_residue naccess_DG_cfg = {
     (double*) naccess_DG_atom_radius,
     (freesasa_atom_class*) naccess_DG_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_DG_atom_slot, naccess_DG_atom_key, 0x9e3779b7u},
 };
 
-static const char *naccess_DI_atom_name[] = {"N7", "N3", "C2", "O6", "C6", "C4", "C5", "C8", "N1", "N9", };
-static double naccess_DI_atom_radius[] = {1.60, 1.60, 1.80, 1.40, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, };
-static int naccess_DI_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DI_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N7", "N9", "O6", };
+static int naccess_DI_atom_slot[] = {0, 0, 0, 0, 5, 7, 0, 0, 0, 1, 10, 0, 8, 0, 0, 0, 4, 0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 9, };
+static uint32_t naccess_DI_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x364f, 0x0, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x394e, };
+static double naccess_DI_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DI_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DI_cfg = {
     10,
  "DI",
@@ -145,11 +182,14 @@ static struct classifier_residue naccess_DI_cfg = {
     (double*) naccess_DI_atom_radius,
     (freesasa_atom_class*) naccess_DI_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_DI_atom_slot, naccess_DI_atom_key, 0x9e3779b3u},
 };
 
-static const char *naccess_DT_atom_name[] = {"O4", "N1", "O2", "C5", "C4", "C7", "C6", "N3", "C2", };
-static double naccess_DT_atom_radius[] = {1.40, 1.60, 1.40, 1.80, 1.80, 1.80, 1.80, 1.60, 1.80, };
-static int naccess_DT_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DT_atom_name[] = {"C2", "C4", "C5", "C6", "C7", "N1", "N3", "O2", "O4", };
+static int naccess_DT_atom_slot[] = {3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 8, 0, 7, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 9, };
+static uint32_t naccess_DT_atom_key[] = {0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x3743, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3643, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x344f, };
+static double naccess_DT_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_DT_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DT_cfg = {
     9,
  "DT",
@@ -157,11 +197,14 @@ static struct classifier_residue naccess_DT_cfg = {
     (double*) naccess_DT_atom_radius,
     (freesasa_atom_class*) naccess_DT_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_DT_atom_slot, naccess_DT_atom_key, 0x9e3779dfu},
 };
 
-static const char *naccess_DU_atom_name[] = {"C2", "N3", "C6", "C4", "O2", "C5", "O4", "N1", };
-static double naccess_DU_atom_radius[] = {1.80, 1.60, 1.80, 1.80, 1.40, 1.80, 1.40, 1.60, };
-static int naccess_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DU_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "O2", "O4", };
+static int naccess_DU_atom_slot[] = {3, 0, 1, 0, 0, 0, 2, 0, 0, 4, 5, 0, 7, 0, 6, 8, };
+static uint32_t naccess_DU_atom_key[] = {0x3543, 0x0, 0x3243, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x3643, 0x314e, 0x0, 0x324f, 0x0, 0x334e, 0x344f, };
+static double naccess_DU_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DU_cfg = {
     8,
  "DU",
@@ -169,11 +212,14 @@ static struct classifier_residue naccess_DU_cfg = {
     (double*) naccess_DU_atom_radius,
     (freesasa_atom_class*) naccess_DU_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, naccess_DU_atom_slot, naccess_DU_atom_key, 0x9e3779dfu},
 };
 
-static const char *naccess_G_atom_name[] = {"N1", "N9", "C8", "C5", "C4", "O6", "C6", "N3", "C2", "N2", "N7", };
-static double naccess_G_atom_radius[] = {1.60, 1.60, 1.80, 1.80, 1.80, 1.40, 1.80, 1.60, 1.80, 1.60, 1.60, };
-static int naccess_G_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_G_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O6", };
+static int naccess_G_atom_slot[] = {10, 0, 0, 0, 5, 0, 8, 0, 0, 0, 1, 11, 7, 9, 0, 0, 0, 4, 0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, };
+static uint32_t naccess_G_atom_key[] = {0x394e, 0x0, 0x0, 0x0, 0x3843, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x364f, 0x324e, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, };
+static double naccess_G_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_G_cfg = {
     11,
  "G",
@@ -181,11 +227,14 @@ static struct classifier_residue naccess_G_cfg = {
     (double*) naccess_G_atom_radius,
     (freesasa_atom_class*) naccess_G_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_G_atom_slot, naccess_G_atom_key, 0x9e3779b7u},
 };
 
-static const char *naccess_GLN_atom_name[] = {"OE1", "CD", "CG", "NE2", };
-static double naccess_GLN_atom_radius[] = {1.40, 1.76, 1.87, 1.65, };
-static int naccess_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_GLN_atom_name[] = {"CD", "CG", "NE2", "OE1", };
+static int naccess_GLN_atom_slot[] = {1, 0, 3, 0, 0, 2, 4, 0, };
+static uint32_t naccess_GLN_atom_key[] = {0x4443, 0x0, 0x32454e, 0x0, 0x0, 0x4743, 0x31454f, 0x0, };
+static double naccess_GLN_atom_radius[] = {1.76, 1.87, 1.65, 1.40, };
+static int naccess_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_GLN_cfg = {
     4,
  "GLN",
@@ -193,11 +242,14 @@ static struct classifier_residue naccess_GLN_cfg = {
     (double*) naccess_GLN_atom_radius,
     (freesasa_atom_class*) naccess_GLN_atom_class,
  {"GLN", 178.24, 41.72, 136.52, 126.35, 51.89, 0},
+    {8, naccess_GLN_atom_slot, naccess_GLN_atom_key, 0x9e3779b3u},
 };
 
-static const char *naccess_GLU_atom_name[] = {"OE2", "CG", "CD", "OE1", };
-static double naccess_GLU_atom_radius[] = {1.40, 1.87, 1.76, 1.40, };
-static int naccess_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_GLU_atom_name[] = {"CD", "CG", "OE1", "OE2", };
+static int naccess_GLU_atom_slot[] = {1, 4, 0, 0, 0, 2, 3, 0, };
+static uint32_t naccess_GLU_atom_key[] = {0x4443, 0x32454f, 0x0, 0x0, 0x0, 0x4743, 0x31454f, 0x0, };
+static double naccess_GLU_atom_radius[] = {1.76, 1.87, 1.40, 1.40, };
+static int naccess_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_GLU_cfg = {
     4,
  "GLU",
@@ -205,9 +257,12 @@ static struct classifier_residue naccess_GLU_cfg = {
     (double*) naccess_GLU_atom_radius,
     (freesasa_atom_class*) naccess_GLU_atom_class,
  {"GLU", 172.09, 41.72, 130.37, 112.13, 59.96, 0},
+    {8, naccess_GLU_atom_slot, naccess_GLU_atom_key, 0x9e3779b3u},
 };
 
 static const char *naccess_GLY_atom_name[] = {"CA", };
+static int naccess_GLY_atom_slot[] = {0, 0, 1, 0, 0, 0, 0, 0, };
+static uint32_t naccess_GLY_atom_key[] = {0x0, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double naccess_GLY_atom_radius[] = {1.87, };
 static int naccess_GLY_atom_class[] = {FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_GLY_cfg = {
@@ -217,9 +272,12 @@ static struct classifier_residue naccess_GLY_cfg = {
     (double*) naccess_GLY_atom_radius,
     (freesasa_atom_class*) naccess_GLY_atom_class,
  {"GLY", 80.30, 80.30, 0.00, 42.62, 37.69, 0},
+    {8, naccess_GLY_atom_slot, naccess_GLY_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_HIS_atom_name[] = {"CG", "CD2", "CE1", "NE2", "ND1", };
+static const char *naccess_HIS_atom_name[] = {"CD2", "CE1", "CG", "ND1", "NE2", };
+static int naccess_HIS_atom_slot[] = {0, 0, 2, 0, 3, 5, 0, 0, 0, 1, 0, 4, 0, 0, 0, 0, };
+static uint32_t naccess_HIS_atom_key[] = {0x0, 0x0, 0x314543, 0x0, 0x4743, 0x32454e, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x31444e, 0x0, 0x0, 0x0, 0x0, };
 static double naccess_HIS_atom_radius[] = {1.76, 1.76, 1.76, 1.65, 1.65, };
 static int naccess_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_HIS_cfg = {
@@ -229,11 +287,14 @@ static struct classifier_residue naccess_HIS_cfg = {
     (double*) naccess_HIS_atom_radius,
     (freesasa_atom_class*) naccess_HIS_atom_class,
  {"HIS", 182.75, 38.76, 143.99, 85.61, 97.14, 0},
+    {16, naccess_HIS_atom_slot, naccess_HIS_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_I_atom_name[] = {"C4", "O6", "C6", "N3", "C2", "N7", "N1", "N9", "C8", "C5", };
-static double naccess_I_atom_radius[] = {1.80, 1.40, 1.80, 1.60, 1.80, 1.60, 1.60, 1.60, 1.80, 1.80, };
-static int naccess_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_I_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N7", "N9", "O6", };
+static int naccess_I_atom_slot[] = {0, 0, 0, 0, 5, 7, 0, 0, 0, 1, 10, 0, 8, 0, 0, 0, 4, 0, 6, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 9, };
+static uint32_t naccess_I_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x364f, 0x0, 0x374e, 0x0, 0x0, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x394e, };
+static double naccess_I_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_I_cfg = {
     10,
  "I",
@@ -241,9 +302,12 @@ static struct classifier_residue naccess_I_cfg = {
     (double*) naccess_I_atom_radius,
     (freesasa_atom_class*) naccess_I_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_I_atom_slot, naccess_I_atom_key, 0x9e3779b3u},
 };
 
-static const char *naccess_ILE_atom_name[] = {"CG1", "CG2", "CD1", };
+static const char *naccess_ILE_atom_name[] = {"CD1", "CG1", "CG2", };
+static int naccess_ILE_atom_slot[] = {1, 0, 0, 0, 0, 2, 3, 0, };
+static uint32_t naccess_ILE_atom_key[] = {0x314443, 0x0, 0x0, 0x0, 0x0, 0x314743, 0x324743, 0x0, };
 static double naccess_ILE_atom_radius[] = {1.87, 1.87, 1.87, };
 static int naccess_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_ILE_cfg = {
@@ -253,9 +317,12 @@ static struct classifier_residue naccess_ILE_cfg = {
     (double*) naccess_ILE_atom_radius,
     (freesasa_atom_class*) naccess_ILE_atom_class,
  {"ILE", 175.10, 41.16, 133.94, 36.10, 139.00, 0},
+    {8, naccess_ILE_atom_slot, naccess_ILE_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_LEU_atom_name[] = {"CD2", "CG", "CD1", };
+static const char *naccess_LEU_atom_name[] = {"CD1", "CD2", "CG", };
+static int naccess_LEU_atom_slot[] = {1, 2, 0, 0, 3, 0, 0, 0, };
+static uint32_t naccess_LEU_atom_key[] = {0x314443, 0x324443, 0x0, 0x0, 0x4743, 0x0, 0x0, 0x0, };
 static double naccess_LEU_atom_radius[] = {1.87, 1.87, 1.87, };
 static int naccess_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_LEU_cfg = {
@@ -265,11 +332,14 @@ static struct classifier_residue naccess_LEU_cfg = {
     (double*) naccess_LEU_atom_radius,
     (freesasa_atom_class*) naccess_LEU_atom_class,
  {"LEU", 178.40, 39.50, 138.90, 36.45, 141.95, 0},
+    {8, naccess_LEU_atom_slot, naccess_LEU_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_LYS_atom_name[] = {"NZ", "CG", "CE", "CD", };
-static double naccess_LYS_atom_radius[] = {1.50, 1.87, 1.87, 1.87, };
-static int naccess_LYS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_LYS_atom_name[] = {"CD", "CE", "CG", "NZ", };
+static int naccess_LYS_atom_slot[] = {0, 1, 4, 2, 0, 0, 0, 3, };
+static uint32_t naccess_LYS_atom_key[] = {0x0, 0x4443, 0x5a4e, 0x4543, 0x0, 0x0, 0x0, 0x4743, };
+static double naccess_LYS_atom_radius[] = {1.87, 1.87, 1.87, 1.50, };
+static int naccess_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_LYS_cfg = {
     4,
  "LYS",
@@ -277,9 +347,12 @@ static struct classifier_residue naccess_LYS_cfg = {
     (double*) naccess_LYS_atom_radius,
     (freesasa_atom_class*) naccess_LYS_atom_class,
  {"LYS", 200.21, 41.72, 158.49, 84.31, 115.90, 0},
+    {8, naccess_LYS_atom_slot, naccess_LYS_atom_key, 0x9e3779b9u},
 };
 
 static const char *naccess_MET_atom_name[] = {"CE", "CG", "SD", };
+static int naccess_MET_atom_slot[] = {0, 1, 0, 0, 2, 0, 0, 3, };
+static uint32_t naccess_MET_atom_key[] = {0x0, 0x4543, 0x0, 0x0, 0x4743, 0x0, 0x0, 0x4453, };
 static double naccess_MET_atom_radius[] = {1.87, 1.87, 1.85, };
 static int naccess_MET_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_MET_cfg = {
@@ -289,9 +362,12 @@ static struct classifier_residue naccess_MET_cfg = {
     (double*) naccess_MET_atom_radius,
     (freesasa_atom_class*) naccess_MET_atom_class,
  {"MET", 193.72, 41.72, 152.00, 36.45, 157.27, 0},
+    {8, naccess_MET_atom_slot, naccess_MET_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_PHE_atom_name[] = {"CD1", "CZ", "CG", "CD2", "CE2", "CE1", };
+static const char *naccess_PHE_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", };
+static int naccess_PHE_atom_slot[] = {0, 0, 3, 4, 5, 0, 0, 0, 1, 2, 0, 0, 0, 6, 0, 0, };
+static uint32_t naccess_PHE_atom_key[] = {0x0, 0x0, 0x314543, 0x324543, 0x4743, 0x0, 0x0, 0x0, 0x314443, 0x324443, 0x0, 0x0, 0x0, 0x5a43, 0x0, 0x0, };
 static double naccess_PHE_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, };
 static int naccess_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_PHE_cfg = {
@@ -301,9 +377,12 @@ static struct classifier_residue naccess_PHE_cfg = {
     (double*) naccess_PHE_atom_radius,
     (freesasa_atom_class*) naccess_PHE_atom_class,
  {"PHE", 199.40, 38.12, 161.27, 34.25, 165.14, 0},
+    {16, naccess_PHE_atom_slot, naccess_PHE_atom_key, 0x9e3779b1u},
 };
 
 static const char *naccess_PRO_atom_name[] = {"CD", "CG", };
+static int naccess_PRO_atom_slot[] = {0, 0, 0, 0, 2, 0, 0, 1, };
+static uint32_t naccess_PRO_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x4743, 0x0, 0x0, 0x4443, };
 static double naccess_PRO_atom_radius[] = {1.87, 1.87, };
 static int naccess_PRO_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_PRO_cfg = {
@@ -313,9 +392,12 @@ static struct classifier_residue naccess_PRO_cfg = {
     (double*) naccess_PRO_atom_radius,
     (freesasa_atom_class*) naccess_PRO_atom_class,
  {"PRO", 135.84, 27.09, 108.76, 15.17, 120.67, 0},
+    {8, naccess_PRO_atom_slot, naccess_PRO_atom_key, 0x9e3779b1u},
 };
 
 static const char *naccess_SEC_atom_name[] = {"SE", };
+static int naccess_SEC_atom_slot[] = {0, 1, 0, 0, 0, 0, 0, 0, };
+static uint32_t naccess_SEC_atom_key[] = {0x0, 0x4553, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double naccess_SEC_atom_radius[] = {1.80, };
 static int naccess_SEC_atom_class[] = {FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_SEC_cfg = {
@@ -325,9 +407,12 @@ static struct classifier_residue naccess_SEC_cfg = {
     (double*) naccess_SEC_atom_radius,
     (freesasa_atom_class*) naccess_SEC_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, naccess_SEC_atom_slot, naccess_SEC_atom_key, 0x9e3779b1u},
 };
 
 static const char *naccess_SER_atom_name[] = {"OG", };
+static int naccess_SER_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 0, };
+static uint32_t naccess_SER_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x474f, 0x0, };
 static double naccess_SER_atom_radius[] = {1.40, };
 static int naccess_SER_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_SER_cfg = {
@@ -337,11 +422,14 @@ static struct classifier_residue naccess_SER_cfg = {
     (double*) naccess_SER_atom_radius,
     (freesasa_atom_class*) naccess_SER_atom_class,
  {"SER", 116.56, 43.38, 73.18, 68.03, 48.53, 0},
+    {8, naccess_SER_atom_slot, naccess_SER_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_T_atom_name[] = {"C5", "O2", "N1", "O4", "C2", "N3", "C6", "C7", "C4", };
-static double naccess_T_atom_radius[] = {1.80, 1.40, 1.60, 1.40, 1.80, 1.60, 1.80, 1.80, 1.80, };
-static int naccess_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_T_atom_name[] = {"C2", "C4", "C5", "C6", "C7", "N1", "N3", "O2", "O4", };
+static int naccess_T_atom_slot[] = {3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 8, 0, 7, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 9, };
+static uint32_t naccess_T_atom_key[] = {0x3543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x0, 0x3243, 0x3743, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3643, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x344f, };
+static double naccess_T_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_T_cfg = {
     9,
  "T",
@@ -349,11 +437,14 @@ static struct classifier_residue naccess_T_cfg = {
     (double*) naccess_T_atom_radius,
     (freesasa_atom_class*) naccess_T_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, naccess_T_atom_slot, naccess_T_atom_key, 0x9e3779dfu},
 };
 
-static const char *naccess_THR_atom_name[] = {"OG1", "CG2", };
-static double naccess_THR_atom_radius[] = {1.40, 1.87, };
-static int naccess_THR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_THR_atom_name[] = {"CG2", "OG1", };
+static int naccess_THR_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 2, };
+static uint32_t naccess_THR_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324743, 0x31474f, };
+static double naccess_THR_atom_radius[] = {1.87, 1.40, };
+static int naccess_THR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_THR_cfg = {
     2,
  "THR",
@@ -361,9 +452,12 @@ static struct classifier_residue naccess_THR_cfg = {
     (double*) naccess_THR_atom_radius,
     (freesasa_atom_class*) naccess_THR_atom_class,
  {"THR", 139.25, 41.70, 97.55, 63.50, 75.75, 0},
+    {8, naccess_THR_atom_slot, naccess_THR_atom_key, 0x9e3779b1u},
 };
 
-static const char *naccess_TRP_atom_name[] = {"CZ3", "CZ2", "CE2", "CG", "CD1", "CE3", "CD2", "CH2", "NE1", };
+static const char *naccess_TRP_atom_name[] = {"CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "NE1", };
+static int naccess_TRP_atom_slot[] = {1, 0, 0, 0, 8, 0, 5, 0, 4, 0, 0, 0, 0, 7, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 9, 0, 6, 0, };
+static uint32_t naccess_TRP_atom_key[] = {0x314443, 0x0, 0x0, 0x0, 0x335a43, 0x0, 0x4743, 0x0, 0x334543, 0x0, 0x0, 0x0, 0x0, 0x325a43, 0x0, 0x0, 0x0, 0x324543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x31454e, 0x0, 0x324843, 0x0, };
 static double naccess_TRP_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.65, };
 static int naccess_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_TRP_cfg = {
@@ -373,11 +467,14 @@ static struct classifier_residue naccess_TRP_cfg = {
     (double*) naccess_TRP_atom_radius,
     (freesasa_atom_class*) naccess_TRP_atom_class,
  {"TRP", 248.97, 42.38, 206.59, 59.83, 189.14, 0},
+    {32, naccess_TRP_atom_slot, naccess_TRP_atom_key, 0x9e3779b7u},
 };
 
-static const char *naccess_TYR_atom_name[] = {"CE1", "CE2", "CG", "CD2", "OH", "CZ", "CD1", };
-static double naccess_TYR_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.40, 1.76, 1.76, };
-static int naccess_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_TYR_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", "OH", };
+static int naccess_TYR_atom_slot[] = {0, 0, 2, 0, 0, 0, 5, 3, 0, 7, 0, 0, 4, 1, 6, 0, };
+static uint32_t naccess_TYR_atom_key[] = {0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x4743, 0x314543, 0x0, 0x484f, 0x0, 0x0, 0x324543, 0x314443, 0x5a43, 0x0, };
+static double naccess_TYR_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.40, };
+static int naccess_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_TYR_cfg = {
     7,
  "TYR",
@@ -385,11 +482,14 @@ static struct classifier_residue naccess_TYR_cfg = {
     (double*) naccess_TYR_atom_radius,
     (freesasa_atom_class*) naccess_TYR_atom_class,
  {"TYR", 212.23, 38.13, 174.10, 76.34, 135.89, 0},
+    {16, naccess_TYR_atom_slot, naccess_TYR_atom_key, 0x9e3779b5u},
 };
 
-static const char *naccess_U_atom_name[] = {"N3", "C2", "C6", "C4", "O2", "C5", "N1", "O4", };
-static double naccess_U_atom_radius[] = {1.60, 1.80, 1.80, 1.80, 1.40, 1.80, 1.60, 1.40, };
-static int naccess_U_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_U_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "O2", "O4", };
+static int naccess_U_atom_slot[] = {3, 0, 1, 0, 0, 0, 2, 0, 0, 4, 5, 0, 7, 0, 6, 8, };
+static uint32_t naccess_U_atom_key[] = {0x3543, 0x0, 0x3243, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x0, 0x3643, 0x314e, 0x0, 0x324f, 0x0, 0x334e, 0x344f, };
+static double naccess_U_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_U_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_U_cfg = {
     8,
  "U",
@@ -397,9 +497,12 @@ static struct classifier_residue naccess_U_cfg = {
     (double*) naccess_U_atom_radius,
     (freesasa_atom_class*) naccess_U_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, naccess_U_atom_slot, naccess_U_atom_key, 0x9e3779dfu},
 };
 
-static const char *naccess_VAL_atom_name[] = {"CG2", "CG1", };
+static const char *naccess_VAL_atom_name[] = {"CG1", "CG2", };
+static int naccess_VAL_atom_slot[] = {0, 0, 0, 0, 0, 1, 2, 0, };
+static uint32_t naccess_VAL_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x314743, 0x324743, 0x0, };
 static double naccess_VAL_atom_radius[] = {1.87, 1.87, };
 static int naccess_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_VAL_cfg = {
@@ -409,6 +512,7 @@ static struct classifier_residue naccess_VAL_cfg = {
     (double*) naccess_VAL_atom_radius,
     (freesasa_atom_class*) naccess_VAL_atom_class,
  {"VAL", 151.40, 41.17, 110.23, 36.12, 115.28, 0},
+    {8, naccess_VAL_atom_slot, naccess_VAL_atom_key, 0x9e3779b1u},
 };
 
 static struct classifier_residue *naccess_residue_cfg[] = {
@@ -418,5 +522,7 @@ const freesasa_classifier freesasa_naccess_classifier = {
     34,    (char**) naccess_residue_name,
     "NACCESS",
     (struct classifier_residue **) naccess_residue_cfg,
+    {128, naccess_residue_slot, naccess_residue_key, 0x9e377b53u},
+    NULL,
 };
 
@@ -3,7 +3,11 @@
 /* Autogenerated code from the script config2c.pl */
 
 static const char *oons_residue_name[] = {"ACE", "ANY", "ARG", "ASN", "ASP", "ASX", "CSE", "CYS", "GLN", "GLU", "GLX", "HIS", "HOH", "ILE", "LEU", "LYS", "MET", "NH2", "PHE", "PRO", "PYL", "SEC", "SER", "THR", "TRP", "TYR", "VAL", };
+static int oons_residue_slot[] = {0, 23, 0, 0, 3, 0, 12, 0, 0, 0, 8, 0, 25, 20, 0, 2, 18, 0, 22, 0, 0, 10, 0, 0, 0, 26, 0, 27, 0, 0, 0, 15, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 1, 0, 0, 4, 9, 5, 0, 0, 19, 7, 14, 21, 17, 6, 11, 0, 0, 0, 0, 24, 16, 0, };
+static uint32_t oons_residue_key[] = {0x0, 0x524553, 0x0, 0x0, 0x475241, 0x0, 0x534948, 0x0, 0x0, 0x0, 0x535943, 0x0, 0x505254, 0x4f5250, 0x0, 0x594e41, 0x32484e, 0x0, 0x434553, 0x0, 0x0, 0x554c47, 0x0, 0x0, 0x0, 0x525954, 0x0, 0x4c4156, 0x0, 0x0, 0x0, 0x55454c, 0x0, 0x0, 0x0, 0x0, 0x0, 0x484f48, 0x0, 0x0, 0x0, 0x0, 0x454341, 0x0, 0x0, 0x4e5341, 0x4e4c47, 0x505341, 0x0, 0x0, 0x454850, 0x455343, 0x454c49, 0x4c5950, 0x54454d, 0x585341, 0x584c47, 0x0, 0x0, 0x0, 0x0, 0x524854, 0x53594c, 0x0, };
 static const char *oons_ACE_atom_name[] = {"CH3", };
+static int oons_ACE_atom_slot[] = {0, 1, 0, 0, 0, 0, 0, 0, };
+static uint32_t oons_ACE_atom_key[] = {0x0, 0x334843, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double oons_ACE_atom_radius[] = {2.00, };
 static int oons_ACE_atom_class[] = {FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_ACE_cfg = {
@@ -13,11 +17,14 @@ static struct classifier_residue oons_ACE_cfg = {
     (double*) oons_ACE_atom_radius,
     (freesasa_atom_class*) oons_ACE_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, oons_ACE_atom_slot, oons_ACE_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_ANY_atom_name[] = {"C8", "C2'", "C2", "C4'", "O6", "N", "N1", "P", "O2", "O2'", "C7", "O", "O4", "O4'", "OP3", "C5'", "N6", "N4", "O3'", "C6", "CA", "C3'", "CM2", "OXT", "C4", "OP2", "C1'", "N9", "CB", "N2", "C", "O5'", "N7", "OP1", "C5", "N3", };
-static double oons_ANY_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.40, 1.55, 1.55, 1.80, 1.40, 1.40, 1.75, 1.40, 1.40, 1.40, 1.40, 2.00, 1.55, 1.55, 1.40, 1.75, 2.00, 1.75, 2.00, 1.40, 1.75, 1.40, 1.75, 1.55, 2.00, 1.55, 1.55, 1.40, 1.55, 1.40, 1.75, 1.55, };
-static int oons_ANY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_ANY_atom_name[] = {"C", "C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "C8", "CA", "CB", "CM2", "N", "N1", "N2", "N3", "N4", "N6", "N7", "N9", "O", "O2", "O2'", "O3'", "O4", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "OXT", "P", };
+static int oons_ANY_atom_slot[] = {7, 0, 0, 0, 1, 0, 5, 0, 0, 0, 0, 0, 4, 23, 0, 0, 0, 0, 0, 2, 30, 0, 0, 0, 0, 22, 29, 0, 0, 35, 24, 21, 27, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 12, 19, 0, 0, 0, 0, 11, 18, 0, 0, 0, 34, 10, 17, 0, 0, 0, 0, 8, 15, 0, 0, 0, 0, 6, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 36, 31, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 9, 13, 0, 0, 0, 0, };
+static uint32_t oons_ANY_atom_key[] = {0x273443, 0x0, 0x0, 0x0, 0x43, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x374e, 0x27344f, 0x0, 0x0, 0x54584f, 0x4f, 0x364e, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27324f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x344e, 0x0, 0x0, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x0, 0x0, 0x3743, 0x324e, 0x0, 0x0, 0x0, 0x33504f, 0x3643, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x3543, 0x324d43, 0x0, 0x0, 0x0, 0x0, 0x3443, 0x0, 0x32504f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3243, 0x50, 0x364f, 0x0, 0x0, 0x31504f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x344f, 0x0, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4243, 0x0, 0x0, 0x0, 0x0, 0x273543, 0x4143, 0x0, 0x0, 0x0, 0x0, };
+static double oons_ANY_atom_radius[] = {1.55, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 2.00, 1.75, 1.75, 1.75, 2.00, 2.00, 2.00, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.80, };
+static int oons_ANY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ANY_cfg = {
     36,
  "ANY",
@@ -25,11 +32,14 @@ static struct classifier_residue oons_ANY_cfg = {
     (double*) oons_ANY_atom_radius,
     (freesasa_atom_class*) oons_ANY_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {128, oons_ANY_atom_slot, oons_ANY_atom_key, 0x9e3779f1u},
 };
 
-static const char *oons_ARG_atom_name[] = {"NH1", "CD", "CZ", "NE", "NH2", "CG", };
-static double oons_ARG_atom_radius[] = {1.55, 2.00, 2.00, 1.55, 1.55, 2.00, };
-static int oons_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_ARG_atom_name[] = {"CD", "CG", "CZ", "NE", "NH1", "NH2", };
+static int oons_ARG_atom_slot[] = {0, 5, 6, 4, 2, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, };
+static uint32_t oons_ARG_atom_key[] = {0x0, 0x31484e, 0x32484e, 0x454e, 0x4743, 0x0, 0x0, 0x4443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a43, 0x0, 0x0, };
+static double oons_ARG_atom_radius[] = {2.00, 2.00, 2.00, 1.55, 1.55, 1.55, };
+static int oons_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ARG_cfg = {
     6,
  "ARG",
@@ -37,9 +47,12 @@ static struct classifier_residue oons_ARG_cfg = {
     (double*) oons_ARG_atom_radius,
     (freesasa_atom_class*) oons_ARG_atom_class,
  {"ARG", 235.30, 38.31, 196.99, 125.27, 110.03, 0},
+    {16, oons_ARG_atom_slot, oons_ARG_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_ASN_atom_name[] = {"CG", "ND2", "OD1", };
+static int oons_ASN_atom_slot[] = {0, 0, 0, 0, 0, 2, 1, 3, };
+static uint32_t oons_ASN_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x32444e, 0x4743, 0x31444f, };
 static double oons_ASN_atom_radius[] = {1.55, 1.55, 1.40, };
 static int oons_ASN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ASN_cfg = {
@@ -49,10 +62,13 @@ static struct classifier_residue oons_ASN_cfg = {
     (double*) oons_ASN_atom_radius,
     (freesasa_atom_class*) oons_ASN_atom_class,
  {"ASN", 143.47, 38.26, 105.21, 97.51, 45.97, 0},
+    {8, oons_ASN_atom_slot, oons_ASN_atom_key, 0x9e3779b5u},
 };
 
-static const char *oons_ASP_atom_name[] = {"OD2", "OD1", "CG", };
-static double oons_ASP_atom_radius[] = {1.40, 1.40, 1.55, };
+static const char *oons_ASP_atom_name[] = {"CG", "OD1", "OD2", };
+static int oons_ASP_atom_slot[] = {0, 0, 2, 3, 1, 0, 0, 0, };
+static uint32_t oons_ASP_atom_key[] = {0x0, 0x0, 0x31444f, 0x32444f, 0x4743, 0x0, 0x0, 0x0, };
+static double oons_ASP_atom_radius[] = {1.55, 1.40, 1.40, };
 static int oons_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ASP_cfg = {
     3,
@@ -61,10 +77,13 @@ static struct classifier_residue oons_ASP_cfg = {
     (double*) oons_ASP_atom_radius,
     (freesasa_atom_class*) oons_ASP_atom_class,
  {"ASP", 141.20, 38.87, 102.33, 95.17, 46.03, 0},
+    {8, oons_ASP_atom_slot, oons_ASP_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_ASX_atom_name[] = {"AD2", "XD2", "AD1", "XD1", "CG", };
-static double oons_ASX_atom_radius[] = {1.5, 1.5, 1.5, 1.5, 1.55, };
+static const char *oons_ASX_atom_name[] = {"AD1", "AD2", "CG", "XD1", "XD2", };
+static int oons_ASX_atom_slot[] = {0, 0, 0, 0, 3, 4, 5, 0, 0, 1, 2, 0, 0, 0, 0, 0, };
+static uint32_t oons_ASX_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x4743, 0x314458, 0x324458, 0x0, 0x0, 0x314441, 0x324441, 0x0, 0x0, 0x0, 0x0, 0x0, };
+static double oons_ASX_atom_radius[] = {1.5, 1.5, 1.55, 1.5, 1.5, };
 static int oons_ASX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ASX_cfg = {
     5,
@@ -73,9 +92,12 @@ static struct classifier_residue oons_ASX_cfg = {
     (double*) oons_ASX_atom_radius,
     (freesasa_atom_class*) oons_ASX_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, oons_ASX_atom_slot, oons_ASX_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_CSE_atom_name[] = {"SE", };
+static int oons_CSE_atom_slot[] = {0, 1, 0, 0, 0, 0, 0, 0, };
+static uint32_t oons_CSE_atom_key[] = {0x0, 0x4553, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double oons_CSE_atom_radius[] = {1.90, };
 static int oons_CSE_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_CSE_cfg = {
@@ -85,9 +107,12 @@ static struct classifier_residue oons_CSE_cfg = {
     (double*) oons_CSE_atom_radius,
     (freesasa_atom_class*) oons_CSE_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, oons_CSE_atom_slot, oons_CSE_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_CYS_atom_name[] = {"SG", };
+static int oons_CYS_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 0, };
+static uint32_t oons_CYS_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x4753, 0x0, 0x0, 0x0, };
 static double oons_CYS_atom_radius[] = {2.00, };
 static int oons_CYS_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_CYS_cfg = {
@@ -97,11 +122,14 @@ static struct classifier_residue oons_CYS_cfg = {
     (double*) oons_CYS_atom_radius,
     (freesasa_atom_class*) oons_CYS_atom_class,
  {"CYS", 140.29, 38.44, 101.85, 98.30, 41.99, 0},
+    {8, oons_CYS_atom_slot, oons_CYS_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_GLN_atom_name[] = {"OE1", "CD", "NE2", "CG", };
-static double oons_GLN_atom_radius[] = {1.40, 1.55, 1.55, 2.00, };
-static int oons_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_GLN_atom_name[] = {"CD", "CG", "NE2", "OE1", };
+static int oons_GLN_atom_slot[] = {1, 0, 3, 0, 0, 2, 4, 0, };
+static uint32_t oons_GLN_atom_key[] = {0x4443, 0x0, 0x32454e, 0x0, 0x0, 0x4743, 0x31454f, 0x0, };
+static double oons_GLN_atom_radius[] = {1.55, 2.00, 1.55, 1.40, };
+static int oons_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLN_cfg = {
     4,
  "GLN",
@@ -109,11 +137,14 @@ static struct classifier_residue oons_GLN_cfg = {
     (double*) oons_GLN_atom_radius,
     (freesasa_atom_class*) oons_GLN_atom_class,
  {"GLN", 176.23, 38.31, 137.92, 122.17, 54.06, 0},
+    {8, oons_GLN_atom_slot, oons_GLN_atom_key, 0x9e3779b3u},
 };
 
-static const char *oons_GLU_atom_name[] = {"OE1", "CD", "OE2", "CG", };
-static double oons_GLU_atom_radius[] = {1.40, 1.55, 1.40, 2.00, };
-static int oons_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_GLU_atom_name[] = {"CD", "CG", "OE1", "OE2", };
+static int oons_GLU_atom_slot[] = {1, 4, 0, 0, 0, 2, 3, 0, };
+static uint32_t oons_GLU_atom_key[] = {0x4443, 0x32454f, 0x0, 0x0, 0x0, 0x4743, 0x31454f, 0x0, };
+static double oons_GLU_atom_radius[] = {1.55, 2.00, 1.40, 1.40, };
+static int oons_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLU_cfg = {
     4,
  "GLU",
@@ -121,11 +152,14 @@ static struct classifier_residue oons_GLU_cfg = {
     (double*) oons_GLU_atom_radius,
     (freesasa_atom_class*) oons_GLU_atom_class,
  {"GLU", 172.43, 38.31, 134.11, 115.92, 56.51, 0},
+    {8, oons_GLU_atom_slot, oons_GLU_atom_key, 0x9e3779b3u},
 };
 
-static const char *oons_GLX_atom_name[] = {"XE2", "CD", "AE1", "AE2", "CG", "XE1", };
-static double oons_GLX_atom_radius[] = {1.5, 1.55, 1.5, 1.5, 2.00, 1.5, };
-static int oons_GLX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_GLX_atom_name[] = {"AE1", "AE2", "CD", "CG", "XE1", "XE2", };
+static int oons_GLX_atom_slot[] = {0, 0, 2, 0, 0, 0, 4, 5, 0, 3, 0, 1, 0, 0, 6, 0, };
+static uint32_t oons_GLX_atom_key[] = {0x0, 0x0, 0x324541, 0x0, 0x0, 0x0, 0x4743, 0x314558, 0x0, 0x4443, 0x0, 0x314541, 0x0, 0x0, 0x324558, 0x0, };
+static double oons_GLX_atom_radius[] = {1.5, 1.5, 1.55, 2.00, 1.5, 1.5, };
+static int oons_GLX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLX_cfg = {
     6,
  "GLX",
@@ -133,11 +167,14 @@ static struct classifier_residue oons_GLX_cfg = {
     (double*) oons_GLX_atom_radius,
     (freesasa_atom_class*) oons_GLX_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, oons_GLX_atom_slot, oons_GLX_atom_key, 0x9e3779b7u},
 };
 
-static const char *oons_HIS_atom_name[] = {"CG", "ND1", "CD2", "CE1", "NE2", };
-static double oons_HIS_atom_radius[] = {1.75, 1.55, 1.75, 1.75, 1.55, };
-static int oons_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_HIS_atom_name[] = {"CD2", "CE1", "CG", "ND1", "NE2", };
+static int oons_HIS_atom_slot[] = {0, 0, 2, 0, 3, 5, 0, 0, 0, 1, 0, 4, 0, 0, 0, 0, };
+static uint32_t oons_HIS_atom_key[] = {0x0, 0x0, 0x314543, 0x0, 0x4743, 0x32454e, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x31444e, 0x0, 0x0, 0x0, 0x0, };
+static double oons_HIS_atom_radius[] = {1.75, 1.75, 1.75, 1.55, 1.55, };
+static int oons_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_HIS_cfg = {
     5,
  "HIS",
@@ -145,9 +182,12 @@ static struct classifier_residue oons_HIS_cfg = {
     (double*) oons_HIS_atom_radius,
     (freesasa_atom_class*) oons_HIS_atom_class,
  {"HIS", 180.78, 36.04, 144.74, 73.26, 107.52, 0},
+    {16, oons_HIS_atom_slot, oons_HIS_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_HOH_atom_name[] = {"O", };
+static int oons_HOH_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 0, };
+static uint32_t oons_HOH_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
 static double oons_HOH_atom_radius[] = {1.40, };
 static int oons_HOH_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_HOH_cfg = {
@@ -157,9 +197,12 @@ static struct classifier_residue oons_HOH_cfg = {
     (double*) oons_HOH_atom_radius,
     (freesasa_atom_class*) oons_HOH_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, oons_HOH_atom_slot, oons_HOH_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_ILE_atom_name[] = {"CG2", "CG1", "CD1", };
+static const char *oons_ILE_atom_name[] = {"CD1", "CG1", "CG2", };
+static int oons_ILE_atom_slot[] = {1, 0, 0, 0, 0, 2, 3, 0, };
+static uint32_t oons_ILE_atom_key[] = {0x314443, 0x0, 0x0, 0x0, 0x0, 0x314743, 0x324743, 0x0, };
 static double oons_ILE_atom_radius[] = {2.00, 2.00, 2.00, };
 static int oons_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_ILE_cfg = {
@@ -169,9 +212,12 @@ static struct classifier_residue oons_ILE_cfg = {
     (double*) oons_ILE_atom_radius,
     (freesasa_atom_class*) oons_ILE_atom_class,
  {"ILE", 182.12, 37.96, 144.16, 31.67, 150.45, 0},
+    {8, oons_ILE_atom_slot, oons_ILE_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_LEU_atom_name[] = {"CD1", "CG", "CD2", };
+static const char *oons_LEU_atom_name[] = {"CD1", "CD2", "CG", };
+static int oons_LEU_atom_slot[] = {1, 2, 0, 0, 3, 0, 0, 0, };
+static uint32_t oons_LEU_atom_key[] = {0x314443, 0x324443, 0x0, 0x0, 0x4743, 0x0, 0x0, 0x0, };
 static double oons_LEU_atom_radius[] = {2.00, 2.00, 2.00, };
 static int oons_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_LEU_cfg = {
@@ -181,9 +227,12 @@ static struct classifier_residue oons_LEU_cfg = {
     (double*) oons_LEU_atom_radius,
     (freesasa_atom_class*) oons_LEU_atom_class,
  {"LEU", 185.43, 35.34, 150.08, 31.73, 153.69, 0},
+    {8, oons_LEU_atom_slot, oons_LEU_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_LYS_atom_name[] = {"CE", "CG", "CD", "NZ", };
+static const char *oons_LYS_atom_name[] = {"CD", "CE", "CG", "NZ", };
+static int oons_LYS_atom_slot[] = {0, 1, 4, 2, 0, 0, 0, 3, };
+static uint32_t oons_LYS_atom_key[] = {0x0, 0x4443, 0x5a4e, 0x4543, 0x0, 0x0, 0x0, 0x4743, };
 static double oons_LYS_atom_radius[] = {2.00, 2.00, 2.00, 1.55, };
 static int oons_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_LYS_cfg = {
@@ -193,11 +242,14 @@ static struct classifier_residue oons_LYS_cfg = {
     (double*) oons_LYS_atom_radius,
     (freesasa_atom_class*) oons_LYS_atom_class,
  {"LYS", 205.80, 38.31, 167.49, 78.02, 127.78, 0},
+    {8, oons_LYS_atom_slot, oons_LYS_atom_key, 0x9e3779b9u},
 };
 
-static const char *oons_MET_atom_name[] = {"SD", "CE", "CG", };
+static const char *oons_MET_atom_name[] = {"CE", "CG", "SD", };
+static int oons_MET_atom_slot[] = {0, 1, 0, 0, 2, 0, 0, 3, };
+static uint32_t oons_MET_atom_key[] = {0x0, 0x4543, 0x0, 0x0, 0x4743, 0x0, 0x0, 0x4453, };
 static double oons_MET_atom_radius[] = {2.00, 2.00, 2.00, };
-static int oons_MET_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static int oons_MET_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_MET_cfg = {
     3,
  "MET",
@@ -205,9 +257,12 @@ static struct classifier_residue oons_MET_cfg = {
     (double*) oons_MET_atom_radius,
     (freesasa_atom_class*) oons_MET_atom_class,
  {"MET", 201.66, 38.31, 163.35, 78.68, 122.98, 0},
+    {8, oons_MET_atom_slot, oons_MET_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_NH2_atom_name[] = {"NH2", };
+static int oons_NH2_atom_slot[] = {0, 0, 1, 0, 0, 0, 0, 0, };
+static uint32_t oons_NH2_atom_key[] = {0x0, 0x0, 0x32484e, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double oons_NH2_atom_radius[] = {1.55, };
 static int oons_NH2_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_NH2_cfg = {
@@ -217,9 +272,12 @@ static struct classifier_residue oons_NH2_cfg = {
     (double*) oons_NH2_atom_radius,
     (freesasa_atom_class*) oons_NH2_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, oons_NH2_atom_slot, oons_NH2_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_PHE_atom_name[] = {"CG", "CD1", "CE2", "CZ", "CD2", "CE1", };
+static const char *oons_PHE_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", };
+static int oons_PHE_atom_slot[] = {0, 0, 3, 4, 5, 0, 0, 0, 1, 2, 0, 0, 0, 6, 0, 0, };
+static uint32_t oons_PHE_atom_key[] = {0x0, 0x0, 0x314543, 0x324543, 0x4743, 0x0, 0x0, 0x0, 0x314443, 0x324443, 0x0, 0x0, 0x0, 0x5a43, 0x0, 0x0, };
 static double oons_PHE_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, };
 static int oons_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_PHE_cfg = {
@@ -229,9 +287,12 @@ static struct classifier_residue oons_PHE_cfg = {
     (double*) oons_PHE_atom_radius,
     (freesasa_atom_class*) oons_PHE_atom_class,
  {"PHE", 199.28, 35.20, 164.08, 30.08, 169.20, 0},
+    {16, oons_PHE_atom_slot, oons_PHE_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_PRO_atom_name[] = {"CB", "CD", "CG", };
+static int oons_PRO_atom_slot[] = {2, 0, 0, 0, 1, 3, 0, 0, };
+static uint32_t oons_PRO_atom_key[] = {0x4443, 0x0, 0x0, 0x0, 0x4243, 0x4743, 0x0, 0x0, };
 static double oons_PRO_atom_radius[] = {1.75, 1.75, 1.75, };
 static int oons_PRO_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_PRO_cfg = {
@@ -241,11 +302,14 @@ static struct classifier_residue oons_PRO_cfg = {
     (double*) oons_PRO_atom_radius,
     (freesasa_atom_class*) oons_PRO_atom_class,
  {"PRO", 128.18, 31.08, 97.10, 13.95, 114.23, 0},
+    {8, oons_PRO_atom_slot, oons_PRO_atom_key, 0x9e3779b3u},
 };
 
-static const char *oons_PYL_atom_name[] = {"CD2", "CG2", "CB2", "CD", "CA2", "CE2", "O2", "N2", "NZ", "C2", "CG", "CE", };
-static double oons_PYL_atom_radius[] = {1.75, 1.75, 2.00, 2.00, 1.75, 1.75, 1.40, 1.55, 1.55, 1.55, 2.00, 2.00, };
-static int oons_PYL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_PYL_atom_name[] = {"C2", "CA2", "CB2", "CD", "CD2", "CE", "CE2", "CG", "CG2", "N2", "NZ", "O2", };
+static int oons_PYL_atom_slot[] = {0, 2, 0, 12, 0, 8, 0, 0, 7, 1, 0, 0, 10, 0, 5, 0, 11, 0, 6, 0, 0, 0, 0, 0, 4, 0, 3, 9, 0, 0, 0, 0, };
+static uint32_t oons_PYL_atom_key[] = {0x0, 0x324143, 0x0, 0x324f, 0x0, 0x4743, 0x0, 0x0, 0x324543, 0x3243, 0x0, 0x0, 0x324e, 0x0, 0x324443, 0x0, 0x5a4e, 0x0, 0x4543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x324243, 0x324743, 0x0, 0x0, 0x0, 0x0, };
+static double oons_PYL_atom_radius[] = {1.55, 1.75, 2.00, 2.00, 1.75, 2.00, 1.75, 2.00, 1.75, 1.55, 1.55, 1.40, };
+static int oons_PYL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_PYL_cfg = {
     12,
  "PYL",
@@ -253,9 +317,12 @@ static struct classifier_residue oons_PYL_cfg = {
     (double*) oons_PYL_atom_radius,
     (freesasa_atom_class*) oons_PYL_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, oons_PYL_atom_slot, oons_PYL_atom_key, 0x9e3779b3u},
 };
 
 static const char *oons_SEC_atom_name[] = {"SE", };
+static int oons_SEC_atom_slot[] = {0, 1, 0, 0, 0, 0, 0, 0, };
+static uint32_t oons_SEC_atom_key[] = {0x0, 0x4553, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, };
 static double oons_SEC_atom_radius[] = {1.90, };
 static int oons_SEC_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_SEC_cfg = {
@@ -265,9 +332,12 @@ static struct classifier_residue oons_SEC_cfg = {
     (double*) oons_SEC_atom_radius,
     (freesasa_atom_class*) oons_SEC_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, oons_SEC_atom_slot, oons_SEC_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_SER_atom_name[] = {"OG", };
+static int oons_SER_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 0, };
+static uint32_t oons_SER_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x474f, 0x0, };
 static double oons_SER_atom_radius[] = {1.40, };
 static int oons_SER_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_SER_cfg = {
@@ -277,9 +347,12 @@ static struct classifier_residue oons_SER_cfg = {
     (double*) oons_SER_atom_radius,
     (freesasa_atom_class*) oons_SER_atom_class,
  {"SER", 118.43, 40.20, 78.23, 60.41, 58.02, 0},
+    {8, oons_SER_atom_slot, oons_SER_atom_key, 0x9e3779b1u},
 };
 
 static const char *oons_THR_atom_name[] = {"CG2", "OG1", };
+static int oons_THR_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 2, };
+static uint32_t oons_THR_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324743, 0x31474f, };
 static double oons_THR_atom_radius[] = {2.00, 1.40, };
 static int oons_THR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_THR_cfg = {
@@ -289,11 +362,14 @@ static struct classifier_residue oons_THR_cfg = {
     (double*) oons_THR_atom_radius,
     (freesasa_atom_class*) oons_THR_atom_class,
  {"THR", 142.41, 38.32, 104.08, 56.42, 85.99, 0},
+    {8, oons_THR_atom_slot, oons_THR_atom_key, 0x9e3779b1u},
 };
 
-static const char *oons_TRP_atom_name[] = {"NE1", "CH2", "CG", "CZ2", "CE3", "CD2", "CE2", "CD1", "CZ3", };
-static double oons_TRP_atom_radius[] = {1.55, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, };
-static int oons_TRP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_TRP_atom_name[] = {"CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "NE1", };
+static int oons_TRP_atom_slot[] = {1, 0, 0, 0, 8, 0, 5, 0, 4, 0, 0, 0, 0, 7, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 9, 0, 6, 0, };
+static uint32_t oons_TRP_atom_key[] = {0x314443, 0x0, 0x0, 0x0, 0x335a43, 0x0, 0x4743, 0x0, 0x334543, 0x0, 0x0, 0x0, 0x0, 0x325a43, 0x0, 0x0, 0x0, 0x324543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x31454e, 0x0, 0x324843, 0x0, };
+static double oons_TRP_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.55, };
+static int oons_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_TRP_cfg = {
     9,
  "TRP",
@@ -301,11 +377,14 @@ static struct classifier_residue oons_TRP_cfg = {
     (double*) oons_TRP_atom_radius,
     (freesasa_atom_class*) oons_TRP_atom_class,
  {"TRP", 247.08, 39.43, 207.65, 52.90, 194.18, 0},
+    {32, oons_TRP_atom_slot, oons_TRP_atom_key, 0x9e3779b7u},
 };
 
-static const char *oons_TYR_atom_name[] = {"CZ", "CE1", "CD2", "OH", "CG", "CD1", "CE2", };
-static double oons_TYR_atom_radius[] = {1.75, 1.75, 1.75, 1.40, 1.75, 1.75, 1.75, };
-static int oons_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_TYR_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", "OH", };
+static int oons_TYR_atom_slot[] = {0, 0, 2, 0, 0, 0, 5, 3, 0, 7, 0, 0, 4, 1, 6, 0, };
+static uint32_t oons_TYR_atom_key[] = {0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x4743, 0x314543, 0x0, 0x484f, 0x0, 0x0, 0x324543, 0x314443, 0x5a43, 0x0, };
+static double oons_TYR_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.40, };
+static int oons_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_TYR_cfg = {
     7,
  "TYR",
@@ -313,9 +392,12 @@ static struct classifier_residue oons_TYR_cfg = {
     (double*) oons_TYR_atom_radius,
     (freesasa_atom_class*) oons_TYR_atom_class,
  {"TYR", 212.31, 35.20, 177.11, 72.41, 139.90, 0},
+    {16, oons_TYR_atom_slot, oons_TYR_atom_key, 0x9e3779b5u},
 };
 
-static const char *oons_VAL_atom_name[] = {"CG2", "CG1", };
+static const char *oons_VAL_atom_name[] = {"CG1", "CG2", };
+static int oons_VAL_atom_slot[] = {0, 0, 0, 0, 0, 1, 2, 0, };
+static uint32_t oons_VAL_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x314743, 0x324743, 0x0, };
 static double oons_VAL_atom_radius[] = {2.00, 2.00, };
 static int oons_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_VAL_cfg = {
@@ -325,6 +407,7 @@ static struct classifier_residue oons_VAL_cfg = {
     (double*) oons_VAL_atom_radius,
     (freesasa_atom_class*) oons_VAL_atom_class,
  {"VAL", 157.64, 37.96, 119.68, 31.70, 125.94, 0},
+    {8, oons_VAL_atom_slot, oons_VAL_atom_key, 0x9e3779b1u},
 };
 
 static struct classifier_residue *oons_residue_cfg[] = {
@@ -334,5 +417,7 @@ const freesasa_classifier freesasa_oons_classifier = {
     27,    (char**) oons_residue_name,
     "OONS",
     (struct classifier_residue **) oons_residue_cfg,
+    {64, oons_residue_slot, oons_residue_key, 0x9e3781a1u},
+    NULL,
 };
 
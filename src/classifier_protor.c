@@ -3,9 +3,13 @@
 /* Autogenerated code from the script config2c.pl */
 
 static const char *protor_residue_name[] = {"A", "ACE", "ALA", "ARG", "ASN", "ASP", "ASX", "C", "CYS", "DA", "DC", "DG", "DI", "DT", "DU", "G", "GLN", "GLU", "GLX", "GLY", "HIS", "HOH", "I", "ILE", "LEU", "LYS", "MET", "NH2", "PHE", "PRO", "PYL", "SEC", "SER", "T", "THR", "TRP", "TYR", "U", "VAL", };
-static const char *protor_A_atom_name[] = {"N6", "P", "C2", "O5'", "O4'", "O3'", "OP2", "OP1", "N3", "C2'", "C6", "O2'", "N7", "N9", "C3'", "C4", "C4'", "OP3", "C5", "C8", "C5'", "N1", "C1'", };
-static double protor_A_atom_radius[] = {1.64, 1.8, 1.76, 1.46, 1.46, 1.46, 1.46, 1.42, 1.64, 1.88, 1.61, 1.46, 1.64, 1.64, 1.88, 1.61, 1.88, 1.46, 1.61, 1.76, 1.88, 1.64, 1.88, };
-static int protor_A_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static int protor_residue_slot[] = {0, 27, 14, 0, 0, 8, 0, 0, 0, 0, 0, 25, 28, 0, 0, 0, 0, 0, 0, 0, 17, 0, 1, 0, 0, 0, 0, 0, 21, 0, 19, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 5, 0, 6, 0, 0, 30, 12, 34, 0, 0, 7, 0, 37, 24, 22, 0, 0, 26, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 10, 0, 9, 33, 0, 29, 0, 0, 36, 23, 0, 0, 31, 0, 0, 0, 0, 0, 18, 0, 0, 0, 20, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 4, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 3, 0, 39, 32, 15, 0, };
+static uint32_t protor_residue_key[] = {0x0, 0x54454d, 0x5444, 0x0, 0x0, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55454c, 0x32484e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e4c47, 0x0, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x534948, 0x0, 0x584c47, 0x0, 0x454341, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4944, 0x0, 0x4e5341, 0x0, 0x505341, 0x0, 0x0, 0x4f5250, 0x4744, 0x54, 0x0, 0x0, 0x585341, 0x0, 0x525954, 0x454c49, 0x484f48, 0x0, 0x0, 0x53594c, 0x0, 0x0, 0x0, 0x4344, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4144, 0x0, 0x535943, 0x524553, 0x0, 0x454850, 0x0, 0x0, 0x505254, 0x49, 0x0, 0x0, 0x4c5950, 0x0, 0x0, 0x0, 0x0, 0x0, 0x554c47, 0x0, 0x0, 0x0, 0x594c47, 0x0, 0x0, 0x0, 0x47, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x475241, 0x0, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x524854, 0x414c41, 0x0, 0x4c4156, 0x434553, 0x5544, 0x0, };
+static const char *protor_A_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N6", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_A_atom_slot[] = {0, 5, 0, 20, 15, 0, 0, 0, 0, 0, 21, 0, 8, 2, 0, 0, 14, 22, 6, 0, 0, 0, 23, 13, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 19, 0, 0, 10, 12, 0, 0, 18, 0, 0, 0, 0, 0, 17, 0, 9, 0, 11, 0, 16, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_A_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x0, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x364e, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x27324f, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_A_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_A_cfg = {
     23,
  "A",
@@ -13,11 +17,14 @@ static struct classifier_residue protor_A_cfg = {
     (double*) protor_A_atom_radius,
     (freesasa_atom_class*) protor_A_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_A_atom_slot, protor_A_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_ACE_atom_name[] = {"CH3", "O", "C", };
-static double protor_ACE_atom_radius[] = {1.88, 1.42, 1.76, };
-static int protor_ACE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ACE_atom_name[] = {"C", "CH3", "O", };
+static int protor_ACE_atom_slot[] = {0, 2, 0, 0, 1, 0, 3, 0, };
+static uint32_t protor_ACE_atom_key[] = {0x0, 0x334843, 0x0, 0x0, 0x43, 0x0, 0x4f, 0x0, };
+static double protor_ACE_atom_radius[] = {1.76, 1.88, 1.42, };
+static int protor_ACE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ACE_cfg = {
     3,
  "ACE",
@@ -25,11 +32,14 @@ static struct classifier_residue protor_ACE_cfg = {
     (double*) protor_ACE_atom_radius,
     (freesasa_atom_class*) protor_ACE_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, protor_ACE_atom_slot, protor_ACE_atom_key, 0x9e3779b1u},
 };
 
-static const char *protor_ALA_atom_name[] = {"OXT", "O", "CB", "N", "CA", "C", };
-static double protor_ALA_atom_radius[] = {1.46, 1.42, 1.88, 1.64, 1.88, 1.61, };
-static int protor_ALA_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ALA_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", };
+static int protor_ALA_atom_slot[] = {0, 0, 0, 0, 1, 3, 0, 4, 6, 0, 0, 2, 0, 0, 5, 0, };
+static uint32_t protor_ALA_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x0, 0x4e, 0x54584f, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_ALA_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_ALA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ALA_cfg = {
     6,
  "ALA",
@@ -37,11 +47,14 @@ static struct classifier_residue protor_ALA_cfg = {
     (double*) protor_ALA_atom_radius,
     (freesasa_atom_class*) protor_ALA_atom_class,
  {"ALA", 108.76, 43.96, 64.80, 37.75, 71.01, 0},
+    {16, protor_ALA_atom_slot, protor_ALA_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_ARG_atom_name[] = {"NH1", "OXT", "CA", "CZ", "CG", "CB", "N", "O", "NH2", "CD", "C", "NE", };
-static double protor_ARG_atom_radius[] = {1.64, 1.46, 1.88, 1.61, 1.88, 1.88, 1.64, 1.42, 1.64, 1.88, 1.61, 1.64, };
-static int protor_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ARG_atom_name[] = {"C", "CA", "CB", "CD", "CG", "CZ", "N", "NE", "NH1", "NH2", "O", "OXT", };
+static int protor_ARG_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 7, 3, 5, 0, 0, 12, 0, 2, 0, 0, 0, 6, 0, 0, 0, 9, 10, 8, 0, 0, 0, 4, 0, 11, 0, };
+static uint32_t protor_ARG_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x4243, 0x4743, 0x0, 0x0, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x5a43, 0x0, 0x0, 0x0, 0x31484e, 0x32484e, 0x454e, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x4f, 0x0, };
+static double protor_ARG_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.61, 1.64, 1.64, 1.64, 1.64, 1.42, 1.46, };
+static int protor_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ARG_cfg = {
     12,
  "ARG",
@@ -49,11 +62,14 @@ static struct classifier_residue protor_ARG_cfg = {
     (double*) protor_ARG_atom_radius,
     (freesasa_atom_class*) protor_ARG_atom_class,
  {"ARG", 238.17, 42.00, 196.17, 165.00, 73.17, 0},
+    {32, protor_ARG_atom_slot, protor_ARG_atom_key, 0x9e3779c1u},
 };
 
-static const char *protor_ASN_atom_name[] = {"C", "ND2", "O", "OD1", "CG", "CA", "N", "CB", "OXT", };
-static double protor_ASN_atom_radius[] = {1.61, 1.64, 1.42, 1.42, 1.61, 1.88, 1.64, 1.88, 1.46, };
-static int protor_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ASN_atom_name[] = {"C", "CA", "CB", "CG", "N", "ND2", "O", "OD1", "OXT", };
+static int protor_ASN_atom_slot[] = {0, 0, 0, 0, 1, 3, 4, 5, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 8, 9, 0, 0, 0, 0, 0, 7, 0, };
+static uint32_t protor_ASN_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32444e, 0x0, 0x31444f, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_ASN_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASN_cfg = {
     9,
  "ASN",
@@ -61,11 +77,14 @@ static struct classifier_residue protor_ASN_cfg = {
     (double*) protor_ASN_atom_radius,
     (freesasa_atom_class*) protor_ASN_atom_class,
  {"ASN", 145.01, 41.53, 103.48, 103.46, 41.55, 0},
+    {32, protor_ASN_atom_slot, protor_ASN_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_ASP_atom_name[] = {"OD2", "CB", "N", "CA", "CG", "OXT", "C", "OD1", "O", };
-static double protor_ASP_atom_radius[] = {1.46, 1.88, 1.64, 1.88, 1.61, 1.46, 1.61, 1.42, 1.42, };
-static int protor_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ASP_atom_name[] = {"C", "CA", "CB", "CG", "N", "O", "OD1", "OD2", "OXT", };
+static int protor_ASP_atom_slot[] = {0, 0, 0, 0, 1, 3, 4, 5, 0, 0, 0, 2, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 6, 0, };
+static uint32_t protor_ASP_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x32444f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x31444f, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_ASP_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.42, 1.42, 1.46, 1.46, };
+static int protor_ASP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASP_cfg = {
     9,
  "ASP",
@@ -73,11 +92,14 @@ static struct classifier_residue protor_ASP_cfg = {
     (double*) protor_ASP_atom_radius,
     (freesasa_atom_class*) protor_ASP_atom_class,
  {"ASP", 142.76, 42.29, 100.47, 100.27, 42.49, 0},
+    {32, protor_ASP_atom_slot, protor_ASP_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_ASX_atom_name[] = {"XD1", "XD2", "O", "C", "OXT", "CB", "N", "CG", "CA", };
-static double protor_ASX_atom_radius[] = {1.5, 1.5, 1.42, 1.61, 1.46, 1.88, 1.64, 1.61, 1.88, };
-static int protor_ASX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ASX_atom_name[] = {"C", "CA", "CB", "CG", "N", "O", "OXT", "XD1", "XD2", };
+static int protor_ASX_atom_slot[] = {0, 0, 0, 0, 1, 3, 4, 5, 0, 0, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 6, 9, };
+static uint32_t protor_ASX_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x314458, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x324458, };
+static double protor_ASX_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.42, 1.46, 1.5, 1.5, };
+static int protor_ASX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASX_cfg = {
     9,
  "ASX",
@@ -85,11 +107,14 @@ static struct classifier_residue protor_ASX_cfg = {
     (double*) protor_ASX_atom_radius,
     (freesasa_atom_class*) protor_ASX_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, protor_ASX_atom_slot, protor_ASX_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_C_atom_name[] = {"O5'", "O4'", "O3'", "N4", "C2", "P", "C2'", "N3", "C6", "OP1", "OP2", "C4'", "C4", "C3'", "OP3", "O2'", "C5'", "N1", "C1'", "O2", "C5", };
-static double protor_C_atom_radius[] = {1.46, 1.46, 1.46, 1.64, 1.61, 1.8, 1.88, 1.64, 1.76, 1.42, 1.46, 1.88, 1.61, 1.88, 1.46, 1.46, 1.88, 1.64, 1.88, 1.42, 1.76, };
-static int protor_C_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_C_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "N4", "O2", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_C_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 17, 0, 0, 0, 0, 0, 16, 21, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 12, 14, 0, 0, 13, 0, 11, 0, 0, 20, 0, 0, 0, 0, 19, 0, 0, 9, 10, 18, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_C_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x344e, 0x27324f, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_C_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.64, 1.42, 1.46, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_C_cfg = {
     21,
  "C",
@@ -97,11 +122,14 @@ static struct classifier_residue protor_C_cfg = {
     (double*) protor_C_atom_radius,
     (freesasa_atom_class*) protor_C_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_C_atom_slot, protor_C_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_CYS_atom_name[] = {"OXT", "SG", "O", "N", "CB", "CA", "C", };
-static double protor_CYS_atom_radius[] = {1.46, 1.77, 1.42, 1.64, 1.88, 1.88, 1.61, };
-static int protor_CYS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_CYS_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", "SG", };
+static int protor_CYS_atom_slot[] = {0, 0, 0, 0, 1, 3, 0, 4, 6, 0, 0, 2, 0, 7, 5, 0, };
+static uint32_t protor_CYS_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x0, 0x4e, 0x54584f, 0x0, 0x0, 0x4143, 0x0, 0x4753, 0x4f, 0x0, };
+static double protor_CYS_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.77, };
+static int protor_CYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_CYS_cfg = {
     7,
  "CYS",
@@ -109,11 +137,14 @@ static struct classifier_residue protor_CYS_cfg = {
     (double*) protor_CYS_atom_radius,
     (freesasa_atom_class*) protor_CYS_atom_class,
  {"CYS", 132.20, 42.55, 89.66, 92.74, 39.47, 0},
+    {16, protor_CYS_atom_slot, protor_CYS_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_DA_atom_name[] = {"C6", "C2'", "N3", "OP1", "OP2", "O4'", "O3'", "O5'", "C2", "N6", "P", "N1", "C1'", "C5'", "C8", "C5", "OP3", "C4'", "C4", "C3'", "N9", "N7", };
-static double protor_DA_atom_radius[] = {1.61, 1.88, 1.64, 1.42, 1.46, 1.46, 1.46, 1.46, 1.76, 1.64, 1.8, 1.64, 1.88, 1.88, 1.76, 1.61, 1.46, 1.88, 1.61, 1.88, 1.64, 1.64, };
-static int protor_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DA_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N6", "N7", "N9", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_DA_atom_slot[] = {0, 5, 0, 19, 15, 0, 0, 0, 0, 0, 20, 0, 8, 2, 0, 0, 14, 21, 6, 0, 0, 0, 22, 13, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 18, 0, 0, 10, 12, 0, 0, 17, 0, 0, 0, 0, 0, 16, 0, 9, 0, 11, 0, 0, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_DA_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x0, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x364e, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_DA_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DA_cfg = {
     22,
  "DA",
@@ -121,11 +152,14 @@ static struct classifier_residue protor_DA_cfg = {
     (double*) protor_DA_atom_radius,
     (freesasa_atom_class*) protor_DA_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DA_atom_slot, protor_DA_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_DC_atom_name[] = {"OP2", "OP1", "N3", "C2'", "C6", "N4", "P", "C2", "O5'", "O3'", "O4'", "C5", "O2", "C5'", "N1", "C1'", "C3'", "C4'", "C4", "OP3", };
-static double protor_DC_atom_radius[] = {1.46, 1.42, 1.64, 1.88, 1.76, 1.64, 1.8, 1.61, 1.46, 1.46, 1.46, 1.76, 1.42, 1.88, 1.64, 1.88, 1.88, 1.88, 1.61, 1.46, };
-static int protor_DC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DC_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "N4", "O2", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_DC_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 16, 0, 0, 0, 0, 0, 15, 20, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 12, 0, 0, 0, 13, 0, 11, 0, 0, 19, 0, 0, 0, 0, 18, 0, 0, 9, 10, 17, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_DC_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x344e, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_DC_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.64, 1.42, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DC_cfg = {
     20,
  "DC",
@@ -133,11 +167,14 @@ static struct classifier_residue protor_DC_cfg = {
     (double*) protor_DC_atom_radius,
     (freesasa_atom_class*) protor_DC_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DC_atom_slot, protor_DC_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_DG_atom_name[] = {"O3'", "O4'", "O5'", "P", "C2", "N2", "C6", "C2'", "N3", "OP2", "OP1", "OP3", "C3'", "C4'", "C4", "N9", "N7", "N1", "C1'", "O6", "C5'", "C5", "C8", };
-static double protor_DG_atom_radius[] = {1.46, 1.46, 1.46, 1.8, 1.61, 1.64, 1.61, 1.88, 1.64, 1.46, 1.42, 1.46, 1.88, 1.88, 1.61, 1.64, 1.64, 1.64, 1.88, 1.42, 1.88, 1.61, 1.76, };
-static int protor_DG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DG_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static int protor_DG_atom_slot[] = {0, 5, 0, 20, 15, 0, 0, 0, 0, 0, 21, 0, 8, 2, 19, 0, 14, 22, 6, 0, 0, 0, 23, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 18, 0, 0, 10, 13, 0, 0, 17, 0, 0, 12, 0, 0, 16, 0, 9, 0, 11, 0, 0, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_DG_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x364f, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x324e, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_DG_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DG_cfg = {
     23,
  "DG",
@@ -145,11 +182,14 @@ static struct classifier_residue protor_DG_cfg = {
     (double*) protor_DG_atom_radius,
     (freesasa_atom_class*) protor_DG_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DG_atom_slot, protor_DG_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_DI_atom_name[] = {"OP2", "OP1", "C6", "C2'", "N3", "P", "C2", "O4'", "O3'", "O5'", "C5", "C8", "C1'", "N1", "O6", "C5'", "N9", "N7", "OP3", "C3'", "C4'", "C4", };
-static double protor_DI_atom_radius[] = {1.46, 1.42, 1.61, 1.88, 1.64, 1.8, 1.76, 1.46, 1.46, 1.46, 1.61, 1.76, 1.88, 1.64, 1.42, 1.88, 1.64, 1.64, 1.46, 1.88, 1.88, 1.61, };
-static int protor_DI_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DI_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N7", "N9", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static int protor_DI_atom_slot[] = {0, 5, 0, 19, 14, 0, 0, 0, 0, 0, 20, 0, 8, 2, 18, 0, 13, 21, 6, 0, 0, 0, 22, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 17, 0, 0, 10, 12, 0, 0, 16, 0, 0, 0, 0, 0, 15, 0, 9, 0, 11, 0, 0, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_DI_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x364f, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x0, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_DI_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DI_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DI_cfg = {
     22,
  "DI",
@@ -157,11 +197,14 @@ static struct classifier_residue protor_DI_cfg = {
     (double*) protor_DI_atom_radius,
     (freesasa_atom_class*) protor_DI_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DI_atom_slot, protor_DI_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_DT_atom_name[] = {"OP3", "C3'", "C4'", "C4", "C5", "O2", "N1", "C1'", "C5'", "P", "C2", "O4", "O4'", "C7", "O3'", "O5'", "OP2", "OP1", "C6", "C2'", "N3", };
-static double protor_DT_atom_radius[] = {1.46, 1.88, 1.88, 1.61, 1.61, 1.42, 1.64, 1.88, 1.88, 1.8, 1.61, 1.42, 1.46, 1.88, 1.46, 1.46, 1.46, 1.42, 1.76, 1.88, 1.64, };
-static int protor_DT_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DT_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_DT_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 17, 0, 0, 0, 0, 0, 16, 21, 0, 15, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 12, 0, 0, 20, 0, 10, 0, 0, 19, 0, 0, 9, 11, 18, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_DT_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x344f, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x3743, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_DT_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.76, 1.88, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DT_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DT_cfg = {
     21,
  "DT",
@@ -169,11 +212,14 @@ static struct classifier_residue protor_DT_cfg = {
     (double*) protor_DT_atom_radius,
     (freesasa_atom_class*) protor_DT_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DT_atom_slot, protor_DT_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_DU_atom_name[] = {"C3'", "C4", "C4'", "OP3", "O2", "C5", "C5'", "C1'", "N1", "P", "O4", "C2", "O5'", "O3'", "O4'", "OP2", "OP1", "C2'", "N3", "C6", };
-static double protor_DU_atom_radius[] = {1.88, 1.61, 1.88, 1.46, 1.42, 1.76, 1.88, 1.88, 1.64, 1.8, 1.42, 1.61, 1.46, 1.46, 1.46, 1.46, 1.42, 1.88, 1.64, 1.76, };
-static int protor_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DU_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_DU_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 16, 0, 0, 0, 0, 0, 15, 20, 0, 14, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 11, 0, 0, 19, 0, 0, 0, 0, 18, 0, 0, 9, 10, 17, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_DU_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x344f, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_DU_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DU_cfg = {
     20,
  "DU",
@@ -181,11 +227,14 @@ static struct classifier_residue protor_DU_cfg = {
     (double*) protor_DU_atom_radius,
     (freesasa_atom_class*) protor_DU_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_DU_atom_slot, protor_DU_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_G_atom_name[] = {"C8", "C5", "C1'", "N1", "C5'", "O6", "N9", "N7", "O2'", "OP3", "C4", "C4'", "C3'", "OP1", "OP2", "C6", "N3", "C2'", "C2", "N2", "P", "O3'", "O4'", "O5'", };
-static double protor_G_atom_radius[] = {1.76, 1.61, 1.88, 1.64, 1.88, 1.42, 1.64, 1.64, 1.46, 1.46, 1.61, 1.88, 1.88, 1.42, 1.46, 1.61, 1.64, 1.88, 1.61, 1.64, 1.8, 1.46, 1.46, 1.46, };
-static int protor_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_G_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static int protor_G_atom_slot[] = {0, 5, 0, 21, 15, 0, 0, 0, 0, 0, 22, 0, 8, 2, 20, 0, 14, 23, 6, 0, 0, 0, 24, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 19, 0, 0, 10, 13, 0, 0, 18, 0, 0, 12, 0, 0, 17, 0, 9, 0, 11, 0, 16, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_G_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x364f, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x324e, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x27324f, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_G_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_G_cfg = {
     24,
  "G",
@@ -193,11 +242,14 @@ static struct classifier_residue protor_G_cfg = {
     (double*) protor_G_atom_radius,
     (freesasa_atom_class*) protor_G_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_G_atom_slot, protor_G_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_GLN_atom_name[] = {"C", "CD", "O", "CB", "N", "NE2", "CG", "CA", "OXT", "OE1", };
-static double protor_GLN_atom_radius[] = {1.61, 1.61, 1.42, 1.88, 1.64, 1.64, 1.88, 1.88, 1.46, 1.42, };
-static int protor_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLN_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "NE2", "O", "OE1", "OXT", };
+static int protor_GLN_atom_slot[] = {9, 0, 0, 0, 1, 0, 0, 6, 3, 5, 7, 0, 10, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 0, };
+static uint32_t protor_GLN_atom_key[] = {0x31454f, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x4243, 0x4743, 0x32454e, 0x0, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x4f, 0x0, };
+static double protor_GLN_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLN_cfg = {
     10,
  "GLN",
@@ -205,11 +257,14 @@ static struct classifier_residue protor_GLN_cfg = {
     (double*) protor_GLN_atom_radius,
     (freesasa_atom_class*) protor_GLN_atom_class,
  {"GLN", 178.83, 42.00, 136.83, 131.85, 46.98, 0},
+    {32, protor_GLN_atom_slot, protor_GLN_atom_key, 0x9e3779c1u},
 };
 
-static const char *protor_GLU_atom_name[] = {"CG", "CA", "CB", "N", "OE2", "OXT", "OE1", "CD", "C", "O", };
-static double protor_GLU_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.46, 1.42, 1.61, 1.61, 1.42, };
-static int protor_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLU_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OE1", "OE2", "OXT", };
+static int protor_GLU_atom_slot[] = {8, 9, 0, 0, 1, 0, 0, 6, 3, 5, 0, 0, 10, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 7, 0, };
+static uint32_t protor_GLU_atom_key[] = {0x31454f, 0x32454f, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x4243, 0x4743, 0x0, 0x0, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x4f, 0x0, };
+static double protor_GLU_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.42, 1.42, 1.46, 1.46, };
+static int protor_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLU_cfg = {
     10,
  "GLU",
@@ -217,11 +272,14 @@ static struct classifier_residue protor_GLU_cfg = {
     (double*) protor_GLU_atom_radius,
     (freesasa_atom_class*) protor_GLU_atom_class,
  {"GLU", 174.18, 42.00, 132.18, 122.48, 51.70, 0},
+    {32, protor_GLU_atom_slot, protor_GLU_atom_key, 0x9e3779c1u},
 };
 
-static const char *protor_GLX_atom_name[] = {"CG", "CA", "CB", "N", "OXT", "CD", "C", "O", "XE2", "XE1", };
-static double protor_GLX_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.61, 1.61, 1.42, 1.5, 1.5, };
-static int protor_GLX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLX_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OXT", "XE1", "XE2", };
+static int protor_GLX_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 6, 3, 5, 0, 0, 8, 0, 2, 0, 0, 0, 0, 9, 10, 0, 0, 0, 0, 0, 0, 0, 4, 0, 7, 0, };
+static uint32_t protor_GLX_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x4243, 0x4743, 0x0, 0x0, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x314558, 0x324558, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x4f, 0x0, };
+static double protor_GLX_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.42, 1.46, 1.5, 1.5, };
+static int protor_GLX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLX_cfg = {
     10,
  "GLX",
@@ -229,11 +287,14 @@ static struct classifier_residue protor_GLX_cfg = {
     (double*) protor_GLX_atom_radius,
     (freesasa_atom_class*) protor_GLX_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {32, protor_GLX_atom_slot, protor_GLX_atom_key, 0x9e3779c1u},
 };
 
-static const char *protor_GLY_atom_name[] = {"OXT", "O", "N", "C", "CA", };
-static double protor_GLY_atom_radius[] = {1.46, 1.42, 1.64, 1.61, 1.88, };
-static int protor_GLY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_GLY_atom_name[] = {"C", "CA", "N", "O", "OXT", };
+static int protor_GLY_atom_slot[] = {5, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 2, 0, 0, 4, 0, };
+static uint32_t protor_GLY_atom_key[] = {0x54584f, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_GLY_atom_radius[] = {1.61, 1.88, 1.64, 1.42, 1.46, };
+static int protor_GLY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLY_cfg = {
     5,
  "GLY",
@@ -241,11 +302,14 @@ static struct classifier_residue protor_GLY_cfg = {
     (double*) protor_GLY_atom_radius,
     (freesasa_atom_class*) protor_GLY_atom_class,
  {"GLY", 81.09, 81.09, 0.00, 44.65, 36.44, 0},
+    {16, protor_GLY_atom_slot, protor_GLY_atom_key, 0x9e3779b3u},
 };
 
-static const char *protor_HIS_atom_name[] = {"OXT", "CA", "CG", "NE2", "CB", "N", "O", "ND1", "CD2", "CE1", "C", };
-static double protor_HIS_atom_radius[] = {1.46, 1.88, 1.61, 1.64, 1.88, 1.64, 1.42, 1.64, 1.76, 1.76, 1.61, };
-static int protor_HIS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_HIS_atom_name[] = {"C", "CA", "CB", "CD2", "CE1", "CG", "N", "ND1", "NE2", "O", "OXT", };
+static int protor_HIS_atom_slot[] = {8, 0, 0, 0, 1, 3, 6, 7, 0, 0, 0, 2, 0, 0, 9, 0, 0, 0, 4, 0, 0, 0, 0, 5, 11, 0, 0, 0, 0, 0, 10, 0, };
+static uint32_t protor_HIS_atom_key[] = {0x31444e, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x32454e, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x314543, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_HIS_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.61, 1.64, 1.64, 1.64, 1.42, 1.46, };
+static int protor_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_HIS_cfg = {
     11,
  "HIS",
@@ -253,9 +317,12 @@ static struct classifier_residue protor_HIS_cfg = {
     (double*) protor_HIS_atom_radius,
     (freesasa_atom_class*) protor_HIS_atom_class,
  {"HIS", 182.97, 39.09, 143.87, 85.94, 97.03, 0},
+    {32, protor_HIS_atom_slot, protor_HIS_atom_key, 0x9e3779b5u},
 };
 
 static const char *protor_HOH_atom_name[] = {"O", };
+static int protor_HOH_atom_slot[] = {0, 0, 0, 0, 0, 0, 1, 0, };
+static uint32_t protor_HOH_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
 static double protor_HOH_atom_radius[] = {1.46, };
 static int protor_HOH_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_HOH_cfg = {
@@ -265,11 +332,14 @@ static struct classifier_residue protor_HOH_cfg = {
     (double*) protor_HOH_atom_radius,
     (freesasa_atom_class*) protor_HOH_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, protor_HOH_atom_slot, protor_HOH_atom_key, 0x9e3779b1u},
 };
 
-static const char *protor_I_atom_name[] = {"C6", "N3", "C2'", "OP1", "OP2", "O4'", "O3'", "O5'", "C2", "P", "N1", "C1'", "C5'", "O6", "C8", "C5", "OP3", "C4", "C4'", "C3'", "N9", "N7", "O2'", };
-static double protor_I_atom_radius[] = {1.61, 1.64, 1.88, 1.42, 1.46, 1.46, 1.46, 1.46, 1.76, 1.8, 1.64, 1.88, 1.88, 1.42, 1.76, 1.61, 1.46, 1.61, 1.88, 1.88, 1.64, 1.64, 1.46, };
-static int protor_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_I_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static int protor_I_atom_slot[] = {0, 5, 0, 20, 14, 0, 0, 0, 0, 0, 21, 0, 8, 2, 19, 0, 13, 22, 6, 0, 0, 0, 23, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 18, 0, 0, 10, 12, 0, 0, 17, 0, 0, 0, 0, 0, 16, 0, 9, 0, 11, 0, 15, 0, 0, 7, 0, 0, 0, 0, };
+static uint32_t protor_I_atom_key[] = {0x0, 0x3443, 0x0, 0x31504f, 0x394e, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x273543, 0x3243, 0x364f, 0x0, 0x374e, 0x33504f, 0x273443, 0x0, 0x0, 0x0, 0x50, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x3843, 0x334e, 0x0, 0x0, 0x27344f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27334f, 0x0, 0x3643, 0x0, 0x314e, 0x0, 0x27324f, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x0, 0x0, };
+static double protor_I_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_I_cfg = {
     23,
  "I",
@@ -277,11 +347,14 @@ static struct classifier_residue protor_I_cfg = {
     (double*) protor_I_atom_radius,
     (freesasa_atom_class*) protor_I_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_I_atom_slot, protor_I_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_ILE_atom_name[] = {"O", "CD1", "C", "OXT", "CG2", "CB", "N", "CG1", "CA", };
-static double protor_ILE_atom_radius[] = {1.42, 1.88, 1.61, 1.46, 1.88, 1.88, 1.64, 1.88, 1.88, };
-static int protor_ILE_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ILE_atom_name[] = {"C", "CA", "CB", "CD1", "CG1", "CG2", "N", "O", "OXT", };
+static int protor_ILE_atom_slot[] = {0, 0, 4, 0, 1, 0, 3, 7, 0, 6, 9, 0, 2, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, };
+static uint32_t protor_ILE_atom_key[] = {0x0, 0x0, 0x314443, 0x0, 0x43, 0x0, 0x4243, 0x4e, 0x0, 0x324743, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x314743, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_ILE_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ILE_cfg = {
     9,
  "ILE",
@@ -289,11 +362,14 @@ static struct classifier_residue protor_ILE_cfg = {
     (double*) protor_ILE_atom_radius,
     (freesasa_atom_class*) protor_ILE_atom_class,
  {"ILE", 175.73, 41.49, 134.23, 36.85, 138.87, 0},
+    {32, protor_ILE_atom_slot, protor_ILE_atom_key, 0x9e3779b9u},
 };
 
-static const char *protor_LEU_atom_name[] = {"CA", "CG", "CB", "N", "OXT", "C", "CD1", "O", "CD2", };
-static double protor_LEU_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.61, 1.88, 1.42, 1.88, };
-static int protor_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_LEU_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CG", "N", "O", "OXT", };
+static int protor_LEU_atom_slot[] = {0, 0, 0, 0, 1, 3, 6, 7, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 4, 8, 0, };
+static uint32_t protor_LEU_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x314443, 0x4f, 0x0, };
+static double protor_LEU_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_LEU_cfg = {
     9,
  "LEU",
@@ -301,11 +377,14 @@ static struct classifier_residue protor_LEU_cfg = {
     (double*) protor_LEU_atom_radius,
     (freesasa_atom_class*) protor_LEU_atom_class,
  {"LEU", 179.56, 39.78, 139.78, 37.16, 142.39, 0},
+    {32, protor_LEU_atom_slot, protor_LEU_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_LYS_atom_name[] = {"C", "CD", "CE", "O", "NZ", "N", "CB", "CG", "CA", "OXT", };
-static double protor_LYS_atom_radius[] = {1.61, 1.88, 1.88, 1.42, 1.64, 1.64, 1.88, 1.88, 1.88, 1.46, };
-static int protor_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_LYS_atom_name[] = {"C", "CA", "CB", "CD", "CE", "CG", "N", "NZ", "O", "OXT", };
+static int protor_LYS_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 7, 3, 6, 0, 0, 10, 0, 2, 0, 0, 0, 0, 0, 8, 5, 0, 0, 0, 0, 0, 0, 4, 0, 9, 0, };
+static uint32_t protor_LYS_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4e, 0x4243, 0x4743, 0x0, 0x0, 0x54584f, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5a4e, 0x4543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x4f, 0x0, };
+static double protor_LYS_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.64, 1.42, 1.46, };
+static int protor_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_LYS_cfg = {
     10,
  "LYS",
@@ -313,11 +392,14 @@ static struct classifier_residue protor_LYS_cfg = {
     (double*) protor_LYS_atom_radius,
     (freesasa_atom_class*) protor_LYS_atom_class,
  {"LYS", 204.98, 42.00, 162.98, 93.88, 111.10, 0},
+    {32, protor_LYS_atom_slot, protor_LYS_atom_key, 0x9e3779c1u},
 };
 
-static const char *protor_MET_atom_name[] = {"OXT", "CG", "CA", "N", "CB", "CE", "O", "SD", "C", };
-static double protor_MET_atom_radius[] = {1.46, 1.88, 1.88, 1.64, 1.88, 1.88, 1.42, 1.77, 1.61, };
-static int protor_MET_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_MET_atom_name[] = {"C", "CA", "CB", "CE", "CG", "N", "O", "OXT", "SD", };
+static int protor_MET_atom_slot[] = {0, 0, 0, 0, 1, 3, 5, 6, 0, 0, 0, 2, 0, 0, 0, 0, 9, 0, 4, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 7, 0, };
+static uint32_t protor_MET_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x0, 0x0, 0x4453, 0x0, 0x4543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_MET_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, 1.77, };
+static int protor_MET_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_MET_cfg = {
     9,
  "MET",
@@ -325,9 +407,12 @@ static struct classifier_residue protor_MET_cfg = {
     (double*) protor_MET_atom_radius,
     (freesasa_atom_class*) protor_MET_atom_class,
  {"MET", 193.10, 42.00, 151.10, 75.48, 117.62, 0},
+    {32, protor_MET_atom_slot, protor_MET_atom_key, 0x9e3779b5u},
 };
 
 static const char *protor_NH2_atom_name[] = {"N", };
+static int protor_NH2_atom_slot[] = {0, 0, 0, 0, 0, 0, 0, 1, };
+static uint32_t protor_NH2_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, };
 static double protor_NH2_atom_radius[] = {1.64, };
 static int protor_NH2_atom_class[] = {FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_NH2_cfg = {
@@ -337,11 +422,14 @@ static struct classifier_residue protor_NH2_cfg = {
     (double*) protor_NH2_atom_radius,
     (freesasa_atom_class*) protor_NH2_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {8, protor_NH2_atom_slot, protor_NH2_atom_key, 0x9e3779b1u},
 };
 
-static const char *protor_PHE_atom_name[] = {"CD2", "CE1", "O", "CD1", "C", "CE2", "OXT", "CB", "N", "CA", "CZ", "CG", };
-static double protor_PHE_atom_radius[] = {1.76, 1.76, 1.42, 1.76, 1.61, 1.76, 1.46, 1.88, 1.64, 1.88, 1.76, 1.61, };
-static int protor_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_PHE_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE1", "CE2", "CG", "CZ", "N", "O", "OXT", };
+static int protor_PHE_atom_slot[] = {0, 0, 0, 0, 1, 3, 8, 10, 0, 0, 0, 2, 7, 0, 9, 0, 0, 0, 5, 0, 0, 0, 0, 6, 12, 0, 0, 0, 0, 4, 11, 0, };
+static uint32_t protor_PHE_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x324543, 0x0, 0x5a43, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x314543, 0x54584f, 0x0, 0x0, 0x0, 0x0, 0x314443, 0x4f, 0x0, };
+static double protor_PHE_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.76, 1.76, 1.61, 1.76, 1.64, 1.42, 1.46, };
+static int protor_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PHE_cfg = {
     12,
  "PHE",
@@ -349,11 +437,14 @@ static struct classifier_residue protor_PHE_cfg = {
     (double*) protor_PHE_atom_radius,
     (freesasa_atom_class*) protor_PHE_atom_class,
  {"PHE", 199.88, 38.43, 161.45, 34.94, 164.94, 0},
+    {32, protor_PHE_atom_slot, protor_PHE_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_PRO_atom_name[] = {"N", "CB", "CG", "CA", "OXT", "C", "CD", "O", };
-static double protor_PRO_atom_radius[] = {1.64, 1.88, 1.88, 1.88, 1.46, 1.61, 1.88, 1.42, };
-static int protor_PRO_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_PRO_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OXT", };
+static int protor_PRO_atom_slot[] = {2, 0, 0, 0, 1, 0, 8, 6, 0, 0, 3, 5, 0, 4, 7, 0, };
+static uint32_t protor_PRO_atom_key[] = {0x4143, 0x0, 0x0, 0x0, 0x43, 0x0, 0x54584f, 0x4e, 0x0, 0x0, 0x4243, 0x4743, 0x0, 0x4443, 0x4f, 0x0, };
+static double protor_PRO_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_PRO_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PRO_cfg = {
     8,
  "PRO",
@@ -361,11 +452,14 @@ static struct classifier_residue protor_PRO_cfg = {
     (double*) protor_PRO_atom_radius,
     (freesasa_atom_class*) protor_PRO_atom_class,
  {"PRO", 137.21, 27.51, 109.70, 16.09, 121.12, 0},
+    {16, protor_PRO_atom_slot, protor_PRO_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_PYL_atom_name[] = {"OXT", "CA", "CD2", "O", "NZ", "N2", "C2", "CA2", "CD", "C", "O2", "N", "CB", "CG2", "CG", "CE", "CE2", "CB2", };
-static double protor_PYL_atom_radius[] = {1.46, 1.88, 1.88, 1.42, 1.64, 1.64, 1.61, 1.88, 1.88, 1.61, 1.42, 1.64, 1.88, 1.88, 1.88, 1.88, 1.76, 1.88, };
-static int protor_PYL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_PYL_atom_name[] = {"C", "C2", "CA", "CA2", "CB", "CB2", "CD", "CD2", "CE", "CE2", "CG", "CG2", "N", "N2", "NZ", "O", "O2", "OXT", };
+static int protor_PYL_atom_slot[] = {0, 0, 0, 0, 1, 0, 0, 11, 6, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 17, 0, 5, 13, 0, 12, 18, 0, 3, 14, 0, 0, 0, 0, 15, 0, 0, 10, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, };
+static uint32_t protor_PYL_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x0, 0x0, 0x4743, 0x324243, 0x0, 0x3243, 0x0, 0x0, 0x0, 0x324143, 0x0, 0x0, 0x0, 0x0, 0x4543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4443, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x4243, 0x4e, 0x0, 0x324743, 0x54584f, 0x0, 0x4143, 0x324e, 0x0, 0x0, 0x0, 0x0, 0x5a4e, 0x0, 0x0, 0x324543, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, };
+static double protor_PYL_atom_radius[] = {1.61, 1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.88, 1.88, 1.76, 1.88, 1.88, 1.64, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_PYL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PYL_cfg = {
     18,
  "PYL",
@@ -373,11 +467,14 @@ static struct classifier_residue protor_PYL_cfg = {
     (double*) protor_PYL_atom_radius,
     (freesasa_atom_class*) protor_PYL_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_PYL_atom_slot, protor_PYL_atom_key, 0x9e3779b9u},
 };
 
-static const char *protor_SEC_atom_name[] = {"O", "OXT", "C", "CA", "SE", "N", "CB", };
-static double protor_SEC_atom_radius[] = {1.42, 1.46, 1.61, 1.88, 1.9, 1.64, 1.88, };
-static int protor_SEC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_SEC_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", "SE", };
+static int protor_SEC_atom_slot[] = {0, 0, 0, 0, 1, 3, 0, 4, 6, 0, 7, 2, 0, 0, 5, 0, };
+static uint32_t protor_SEC_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x0, 0x4e, 0x54584f, 0x0, 0x4553, 0x4143, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_SEC_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.9, };
+static int protor_SEC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_SEC_cfg = {
     7,
  "SEC",
@@ -385,11 +482,14 @@ static struct classifier_residue protor_SEC_cfg = {
     (double*) protor_SEC_atom_radius,
     (freesasa_atom_class*) protor_SEC_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {16, protor_SEC_atom_slot, protor_SEC_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_SER_atom_name[] = {"O", "OXT", "OG", "CA", "C", "CB", "N", };
-static double protor_SER_atom_radius[] = {1.42, 1.46, 1.46, 1.88, 1.61, 1.88, 1.64, };
-static int protor_SER_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_SER_atom_name[] = {"C", "CA", "CB", "N", "O", "OG", "OXT", };
+static int protor_SER_atom_slot[] = {0, 0, 0, 0, 1, 3, 0, 4, 7, 0, 0, 2, 0, 0, 5, 6, };
+static uint32_t protor_SER_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x0, 0x4e, 0x54584f, 0x0, 0x0, 0x4143, 0x0, 0x0, 0x4f, 0x474f, };
+static double protor_SER_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.46, };
+static int protor_SER_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_SER_cfg = {
     7,
  "SER",
@@ -397,11 +497,14 @@ static struct classifier_residue protor_SER_cfg = {
     (double*) protor_SER_atom_radius,
     (freesasa_atom_class*) protor_SER_atom_class,
  {"SER", 118.34, 43.41, 74.93, 71.38, 46.96, 0},
+    {16, protor_SER_atom_slot, protor_SER_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_T_atom_name[] = {"C6", "C2'", "N3", "OP1", "OP2", "C7", "O4'", "O3'", "O5'", "O4", "C2", "P", "C1'", "N1", "C5'", "O2", "C5", "OP3", "C4'", "C4", "C3'", };
-static double protor_T_atom_radius[] = {1.76, 1.88, 1.64, 1.42, 1.46, 1.88, 1.46, 1.46, 1.46, 1.42, 1.61, 1.8, 1.88, 1.64, 1.88, 1.42, 1.61, 1.46, 1.88, 1.61, 1.88, };
-static int protor_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_T_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_T_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 17, 0, 0, 0, 0, 0, 16, 21, 0, 15, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 12, 0, 0, 20, 0, 10, 0, 0, 19, 0, 0, 9, 11, 18, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_T_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x344f, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x3743, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_T_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.76, 1.88, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_T_cfg = {
     21,
  "T",
@@ -409,11 +512,14 @@ static struct classifier_residue protor_T_cfg = {
     (double*) protor_T_atom_radius,
     (freesasa_atom_class*) protor_T_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_T_atom_slot, protor_T_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_THR_atom_name[] = {"O", "OG1", "C", "OXT", "N", "CB", "CG2", "CA", };
-static double protor_THR_atom_radius[] = {1.42, 1.46, 1.61, 1.46, 1.64, 1.88, 1.88, 1.88, };
-static int protor_THR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_THR_atom_name[] = {"C", "CA", "CB", "CG2", "N", "O", "OG1", "OXT", };
+static int protor_THR_atom_slot[] = {2, 0, 0, 0, 1, 0, 8, 5, 0, 4, 3, 7, 0, 0, 6, 0, };
+static uint32_t protor_THR_atom_key[] = {0x4143, 0x0, 0x0, 0x0, 0x43, 0x0, 0x54584f, 0x4e, 0x0, 0x324743, 0x4243, 0x31474f, 0x0, 0x0, 0x4f, 0x0, };
+static double protor_THR_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, 1.46, };
+static int protor_THR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_THR_cfg = {
     8,
  "THR",
@@ -421,11 +527,14 @@ static struct classifier_residue protor_THR_cfg = {
     (double*) protor_THR_atom_radius,
     (freesasa_atom_class*) protor_THR_atom_class,
  {"THR", 140.60, 41.96, 98.64, 66.15, 74.45, 0},
+    {16, protor_THR_atom_slot, protor_THR_atom_key, 0x9e3779c7u},
 };
 
-static const char *protor_TRP_atom_name[] = {"NE1", "CG", "CA", "CB", "CE3", "N", "CZ2", "OXT", "CE2", "C", "CD1", "O", "CZ3", "CD2", "CH2", };
-static double protor_TRP_atom_radius[] = {1.64, 1.61, 1.88, 1.88, 1.76, 1.64, 1.76, 1.46, 1.61, 1.61, 1.76, 1.42, 1.76, 1.61, 1.76, };
-static int protor_TRP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_TRP_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "N", "NE1", "O", "OXT", };
+static int protor_TRP_atom_slot[] = {0, 0, 6, 10, 1, 0, 0, 12, 5, 0, 0, 0, 0, 13, 0, 0, 9, 4, 0, 0, 0, 0, 3, 15, 8, 7, 11, 0, 2, 0, 14, 0, };
+static uint32_t protor_TRP_atom_key[] = {0x0, 0x0, 0x324543, 0x325a43, 0x43, 0x0, 0x0, 0x4e, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x31454e, 0x0, 0x0, 0x324843, 0x314443, 0x0, 0x0, 0x0, 0x0, 0x4243, 0x54584f, 0x4743, 0x334543, 0x335a43, 0x0, 0x4143, 0x0, 0x4f, 0x0, };
+static double protor_TRP_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.61, 1.61, 1.76, 1.61, 1.76, 1.76, 1.76, 1.64, 1.64, 1.42, 1.46, };
+static int protor_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_TRP_cfg = {
     15,
  "TRP",
@@ -433,11 +542,14 @@ static struct classifier_residue protor_TRP_cfg = {
     (double*) protor_TRP_atom_radius,
     (freesasa_atom_class*) protor_TRP_atom_class,
  {"TRP", 249.19, 42.59, 206.60, 61.64, 187.55, 0},
+    {32, protor_TRP_atom_slot, protor_TRP_atom_key, 0x9e3779f7u},
 };
 
-static const char *protor_TYR_atom_name[] = {"OXT", "N", "CB", "OH", "CG", "CZ", "CA", "CE1", "CD2", "O", "CD1", "CE2", "C", };
-static double protor_TYR_atom_radius[] = {1.46, 1.64, 1.88, 1.46, 1.61, 1.61, 1.88, 1.76, 1.76, 1.42, 1.76, 1.76, 1.61, };
-static int protor_TYR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_TYR_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE1", "CE2", "CG", "CZ", "N", "O", "OH", "OXT", };
+static int protor_TYR_atom_slot[] = {0, 0, 0, 0, 1, 3, 8, 10, 0, 0, 0, 2, 7, 0, 9, 0, 0, 0, 5, 0, 0, 0, 0, 6, 13, 12, 0, 0, 0, 4, 11, 0, };
+static uint32_t protor_TYR_atom_key[] = {0x0, 0x0, 0x0, 0x0, 0x43, 0x4243, 0x4743, 0x4e, 0x0, 0x0, 0x0, 0x4143, 0x324543, 0x0, 0x5a43, 0x0, 0x0, 0x0, 0x324443, 0x0, 0x0, 0x0, 0x0, 0x314543, 0x54584f, 0x484f, 0x0, 0x0, 0x0, 0x314443, 0x4f, 0x0, };
+static double protor_TYR_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.76, 1.76, 1.61, 1.61, 1.64, 1.42, 1.46, 1.46, };
+static int protor_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_TYR_cfg = {
     13,
  "TYR",
@@ -445,11 +557,14 @@ static struct classifier_residue protor_TYR_cfg = {
     (double*) protor_TYR_atom_radius,
     (freesasa_atom_class*) protor_TYR_atom_class,
  {"TYR", 214.19, 38.43, 175.76, 81.12, 133.07, 0},
+    {32, protor_TYR_atom_slot, protor_TYR_atom_key, 0x9e3779b5u},
 };
 
-static const char *protor_U_atom_name[] = {"OP3", "C4'", "C4", "C3'", "O2'", "C1'", "N1", "C5'", "C5", "O2", "O3'", "O4'", "O5'", "C2", "O4", "P", "C6", "C2'", "N3", "OP1", "OP2", };
-static double protor_U_atom_radius[] = {1.46, 1.88, 1.61, 1.88, 1.46, 1.88, 1.64, 1.88, 1.76, 1.42, 1.46, 1.46, 1.46, 1.61, 1.42, 1.8, 1.76, 1.88, 1.64, 1.42, 1.46, };
-static int protor_U_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_U_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "O2", "O2'", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static int protor_U_atom_slot[] = {0, 0, 4, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 1, 17, 0, 0, 0, 0, 0, 16, 21, 0, 15, 0, 0, 14, 0, 0, 0, 0, 0, 0, 13, 0, 0, 12, 0, 11, 0, 0, 20, 0, 0, 0, 0, 19, 0, 0, 9, 10, 18, 8, 0, 0, 7, 0, 0, 6, 0, 0, 5, 0, };
+static uint32_t protor_U_atom_key[] = {0x0, 0x0, 0x273343, 0x0, 0x0, 0x0, 0x0, 0x0, 0x273243, 0x0, 0x0, 0x3243, 0x0, 0x0, 0x273143, 0x27354f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27344f, 0x50, 0x0, 0x344f, 0x0, 0x0, 0x27334f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x27324f, 0x0, 0x0, 0x324f, 0x0, 0x334e, 0x0, 0x0, 0x33504f, 0x0, 0x0, 0x0, 0x0, 0x32504f, 0x0, 0x0, 0x3643, 0x314e, 0x31504f, 0x273543, 0x0, 0x0, 0x3543, 0x0, 0x0, 0x273443, 0x0, 0x0, 0x3443, 0x0, };
+static double protor_U_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_U_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_U_cfg = {
     21,
  "U",
@@ -457,11 +572,14 @@ static struct classifier_residue protor_U_cfg = {
     (double*) protor_U_atom_radius,
     (freesasa_atom_class*) protor_U_atom_class,
  {NULL, 0, 0, 0, 0, 0},
+    {64, protor_U_atom_slot, protor_U_atom_key, 0x9e3779bbu},
 };
 
-static const char *protor_VAL_atom_name[] = {"OXT", "CG2", "N", "CB", "CA", "CG1", "O", "C", };
-static double protor_VAL_atom_radius[] = {1.46, 1.88, 1.64, 1.88, 1.88, 1.88, 1.42, 1.61, };
-static int protor_VAL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_VAL_atom_name[] = {"C", "CA", "CB", "CG1", "CG2", "N", "O", "OXT", };
+static int protor_VAL_atom_slot[] = {4, 0, 0, 0, 1, 0, 3, 6, 0, 5, 8, 0, 2, 0, 7, 0, };
+static uint32_t protor_VAL_atom_key[] = {0x314743, 0x0, 0x0, 0x0, 0x43, 0x0, 0x4243, 0x4e, 0x0, 0x324743, 0x54584f, 0x0, 0x4143, 0x0, 0x4f, 0x0, };
+static double protor_VAL_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_VAL_cfg = {
     8,
  "VAL",
@@ -469,6 +587,7 @@ static struct classifier_residue protor_VAL_cfg = {
     (double*) protor_VAL_atom_radius,
     (freesasa_atom_class*) protor_VAL_atom_class,
  {"VAL", 151.97, 41.50, 110.46, 36.87, 115.09, 0},
+    {16, protor_VAL_atom_slot, protor_VAL_atom_key, 0x9e3779b9u},
 };
 
 static struct classifier_residue *protor_residue_cfg[] = {
@@ -478,5 +597,7 @@ const freesasa_classifier freesasa_protor_classifier = {
     39,    (char**) protor_residue_name,
     "ProtOr",
     (struct classifier_residue **) protor_residue_cfg,
+    {128, protor_residue_slot, protor_residue_key, 0x9e377c41u},
+    NULL,
 };
 
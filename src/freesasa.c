@@ -11,6 +11,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef _MSC_VER
+#define _USE_MATH_DEFINES
+#endif
+#include <math.h>
+
 #include "freesasa_internal.h"
 
 #ifdef PACKAGE_VERSION
@@ -40,7 +45,73 @@ const freesasa_parameters freesasa_default_parameters = {
     FREESASA_DEF_PROBE_RADIUS,
     FREESASA_DEF_SR_N,
     FREESASA_DEF_LR_N,
-    DEF_NUMBER_THREADS};
+    DEF_NUMBER_THREADS,
+    {0, 0, 0, 0, 0, 0, 0, 0, 0}};
+
+int freesasa_parameters_set_box(freesasa_parameters *parameters,
+                                double a,
+                                double b,
+                                double c,
+                                double alpha,
+                                double beta,
+                                double gamma)
+{
+    const double deg = M_PI / 180;
+    double cos_a, cos_b, cos_g, sin_g, cx, cy, cz2;
+    double *box;
+
+    assert(parameters);
+
+    if (a == 0 && b == 0 && c == 0) {
+        memset(parameters->box, 0, sizeof(parameters->box));
+        return FREESASA_SUCCESS;
+    }
+    if (a <= 0 || b <= 0 || c <= 0) {
+        return fail_msg("box lengths must be positive, got %f, %f, %f", a, b, c);
+    }
+    if (alpha <= 0 || alpha >= 180 || beta <= 0 || beta >= 180 || gamma <= 0 || gamma >= 180) {
+        return fail_msg("box angles must be between 0 and 180 degrees, got %f, %f, %f",
+                        alpha, beta, gamma);
+    }
+
+    cos_a = cos(alpha * deg);
+    cos_b = cos(beta * deg);
+    cos_g = cos(gamma * deg);
+    sin_g = sin(gamma * deg);
+    cx = c * cos_b;
+    cy = c * (cos_a - cos_b * cos_g) / sin_g;
+    cz2 = c * c - cx * cx - cy * cy;
+
+    if (cz2 <= 0) {
+        return fail_msg("box angles %f, %f, %f do not describe a valid unit cell",
+                        alpha, beta, gamma);
+    }
+
+    box = parameters->box;
+    box[0] = a;
+    box[1] = 0;
+    box[2] = 0;
+    box[3] = b * cos_g;
+    box[4] = b * sin_g;
+    box[5] = 0;
+    box[6] = cx;
+    box[7] = cy;
+    box[8] = sqrt(cz2);
+
+    return FREESASA_SUCCESS;
+}
+
+const double *
+freesasa_parameters_box(const freesasa_parameters *parameters)
+{
+    int i;
+
+    for (i = 0; i < 9; ++i) {
+        if (parameters->box[i] != 0) return parameters->box;
+    }
+
+    return NULL;
+}
 
 static freesasa_result *
 result_new(int n)
@@ -78,6 +149,15 @@ freesasa_calc(const coord_t *c,
               const double *radii,
               const freesasa_parameters *parameters)
 
+{
+    return freesasa_calc_subset(c, radii, NULL, parameters);
+}
+
+freesasa_result *
+freesasa_calc_subset(const coord_t *c,
+                     const double *radii,
+                     const int *target,
+                     const freesasa_parameters *parameters)
 {
     freesasa_result *result;
     int ret = FREESASA_SUCCESS, i;
@@ -96,10 +176,10 @@ freesasa_calc(const coord_t *c,
 
     switch (parameters->alg) {
     case FREESASA_SHRAKE_RUPLEY:
-        ret = freesasa_shrake_rupley(result->sasa, c, radii, parameters);
+        ret = freesasa_shrake_rupley(result->sasa, c, radii, target, parameters);
         break;
     case FREESASA_LEE_RICHARDS:
-        ret = freesasa_lee_richards(result->sasa, c, radii, parameters);
+        ret = freesasa_lee_richards(result->sasa, c, radii, target, parameters);
         break;
     default:
         assert(0); /* should never get here */
@@ -110,8 +190,10 @@ freesasa_calc(const coord_t *c,
         return NULL;
     }
 
+    /* atoms that weren't calculated make the total NaN too */
     result->total = 0;
     for (i = 0; i < freesasa_coord_n(c); ++i) {
+        if (target && !target[i]) result->sasa[i] = NAN;
         result->total += result->sasa[i];
     }
     result->parameters = *parameters;
@@ -141,6 +223,53 @@ freesasa_calc_coord(const double *xyz,
     return result;
 }
 
+int freesasa_calc_coord_sweep(const double *xyz,
+                              const double *radii,
+                              int n,
+                              const double *probe_radii,
+                              int n_probes,
+                              const freesasa_parameters *parameters,
+                              double *sasa)
+{
+    coord_t *coord = NULL;
+    int ret = FREESASA_SUCCESS, k;
+
+    assert(xyz);
+    assert(radii);
+    assert(probe_radii);
+    assert(sasa);
+
+    if (n <= 0 || n_probes <= 0) {
+        return fail_msg("sweep needs at least one atom and one probe radius");
+    }
+    for (k = 0; k < n_probes; ++k) {
+        if (probe_radii[k] < 0) {
+            return fail_msg("probe radius %f invalid, must be >= 0", probe_radii[k]);
+        }
+    }
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    coord = freesasa_coord_new_linked(xyz, n);
+    if (coord == NULL) return fail_msg("");
+
+    switch (parameters->alg) {
+    case FREESASA_SHRAKE_RUPLEY:
+        ret = freesasa_shrake_rupley_sweep(sasa, coord, radii, probe_radii, n_probes, parameters);
+        break;
+    case FREESASA_LEE_RICHARDS:
+        ret = freesasa_lee_richards_sweep(sasa, coord, radii, probe_radii, n_probes, parameters);
+        break;
+    default:
+        assert(0); /* should never get here */
+        break;
+    }
+
+    freesasa_coord_free(coord);
+
+    return ret;
+}
+
 freesasa_result *
 freesasa_calc_structure(const freesasa_structure *structure,
                         const freesasa_parameters *parameters)
@@ -152,6 +281,37 @@ freesasa_calc_structure(const freesasa_structure *structure,
                          parameters);
 }
 
+freesasa_result *
+freesasa_calc_targets(const freesasa_structure *structure,
+                      const char *command,
+                      const freesasa_parameters *parameters)
+{
+    freesasa_result *result = NULL;
+    int *target;
+
+    assert(structure);
+    assert(command);
+
+    target = malloc(sizeof(int) * freesasa_structure_n(structure));
+    if (target == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    if (freesasa_selection_mask(target, command, structure) == FREESASA_FAIL) {
+        fail_msg("");
+    } else {
+        result = freesasa_calc_subset(freesasa_structure_xyz(structure),
+                                      freesasa_structure_radius(structure),
+                                      target, parameters);
+        if (result == NULL) fail_msg("");
+    }
+
+    free(target);
+
+    return result;
+}
+
 freesasa_node *
 freesasa_calc_tree(const freesasa_structure *structure,
                    const freesasa_parameters *parameters,
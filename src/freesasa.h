@@ -55,6 +55,12 @@
     exception where a lower level node can be modified is
     freesasa_node_structure_add_selection().
 
+    The nodes of a tree are allocated in a ::freesasa_arena, and
+    released together by freesasa_node_free(). To process many
+    structures, trees can be allocated in a caller-owned arena with
+    freesasa_tree_new_arena(), and the arena reused after
+    freesasa_arena_reset().
+
     @defgroup structure Structure
 
     @brief Representation of macromolecular structures.
@@ -215,6 +221,11 @@ enum freesasa_output_options {
 
 /**
    Struct to store parameters for SASA calculation
+
+   Fields may be added in new major versions, so initialize instances
+   from ::freesasa_default_parameters and then modify them, rather
+   than listing all fields. The field `box` was added in 3.0.0.
+
    @ingroup core
  */
 typedef struct {
@@ -223,6 +234,12 @@ typedef struct {
     int shrake_rupley_n_points; /**< Number of test points in S&R calculation. */
     int lee_richards_n_slices;  /**< Number of slices per atom in L&R calculation. */
     int n_threads;              /**< Number of threads to use, if compiled with thread-support. */
+    /**
+       Periodic box vectors a, b and c (in Ångström), stored
+       consecutively. If all elements are zero (the default), the
+       system is not periodic. See freesasa_parameters_set_box().
+     */
+    double box[9];
 } freesasa_parameters;
 
 /**
@@ -231,6 +248,39 @@ typedef struct {
  */
 extern const freesasa_parameters freesasa_default_parameters;
 
+/**
+    Sets a periodic box from unit cell parameters.
+
+    Uses the same parameters as the CRYST1 record in PDB files. Vector
+    a is placed along the x-axis and b in the xy-plane. When a box is
+    set, contacts are calculated across the box faces using the
+    nearest periodic image, so solvated simulation boxes and crystal
+    lattices can be handled without replicating atoms. The box has to
+    be at least three times the largest atomic diameter (including
+    probe) wide in each direction.
+
+    Setting all lengths to 0 removes the box.
+
+    @param parameters The parameters to modify.
+    @param a Length of box vector a (in Ångström).
+    @param b Length of box vector b.
+    @param c Length of box vector c.
+    @param alpha Angle between b and c (in degrees).
+    @param beta Angle between a and c.
+    @param gamma Angle between a and b.
+    @return ::FREESASA_SUCCESS if the parameters describe a valid box,
+      ::FREESASA_FAIL else (parameters are then left unchanged).
+
+    @ingroup core
+ */
+int freesasa_parameters_set_box(freesasa_parameters *parameters,
+                                double a,
+                                double b,
+                                double c,
+                                double alpha,
+                                double beta,
+                                double gamma);
+
 /**
    @brief Struct for structure object.
 
@@ -328,6 +378,29 @@ typedef struct freesasa_node freesasa_node;
  */
 typedef struct freesasa_selection freesasa_selection;
 
+/**
+   @brief Compiled selection
+
+   A selection command that has been parsed and checked once by
+   freesasa_selection_compile(), to be applied to any number of
+   structures with freesasa_selection_apply().
+
+   @ingroup selection
+ */
+typedef struct freesasa_compiled_selection freesasa_compiled_selection;
+
+/**
+   @brief Arena for result trees
+
+   Memory region that the nodes of a tree are allocated in, so that a
+   whole tree is released in one operation. Each tree has its own
+   arena by default, a caller-owned arena can be shared by several
+   trees. Initiated from freesasa_arena_new().
+
+   @ingroup node
+ */
+typedef struct freesasa_arena freesasa_arena;
+
 /**
    @brief Classifier struct
 
@@ -341,6 +414,16 @@ typedef struct freesasa_selection freesasa_selection;
  */
 typedef struct freesasa_classifier freesasa_classifier;
 
+/**
+   @brief Preprocessed receptor for pose scoring
+
+   Stores everything about a receptor that doesn't change when a
+   ligand is moved around it. Initiated from freesasa_receptor_new().
+
+   @ingroup core
+ */
+typedef struct freesasa_receptor freesasa_receptor;
+
 /**
    @brief ProtOr classifier.
 
@@ -411,6 +494,73 @@ freesasa_calc_coord(const double *xyz,
                     int n,
                     const freesasa_parameters *parameters);
 
+/**
+    Calculates SASA for a set of probe radii in one pass.
+
+    Gives the same result as calling freesasa_calc_coord() once per
+    probe radius, but the neighbor list is only calculated once (for
+    the largest probe) and reused for the smaller ones. With
+    ::FREESASA_SHRAKE_RUPLEY all probes are handled in the same pass
+    over the atoms.
+
+    @param xyz Array of coordinates in the form x1,y1,z1,x2,y2,z2,...,xn,yn,zn.
+    @param radii Radii, this array should have n elements.
+    @param n Number of coordinates (i.e. xyz has size 3*n, radii size n).
+    @param probe_radii The probe radii to calculate SASA for.
+    @param n_probes Number of probe radii.
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used. The field `probe_radius` is ignored.
+    @param sasa Array of size `n_probes * n` where the results are
+      stored, the SASA of atom `i` with probe `k` is `sasa[k * n + i]`.
+
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_WARN if multiple
+      threads are requested when compiled in single-threaded mode.
+      ::FREESASA_FAIL if input is invalid or memory allocation fails.
+
+    @ingroup core
+ */
+int freesasa_calc_coord_sweep(const double *xyz,
+                              const double *radii,
+                              int n,
+                              const double *probe_radii,
+                              int n_probes,
+                              const freesasa_parameters *parameters,
+                              double *sasa);
+
+/**
+    Calculates SASA for a selected subset of the atoms in a structure.
+
+    The targets are specified using the same syntax as
+    freesasa_selection_new(). All atoms in the structure occlude the
+    targets, but neighbors are only determined, and SASA only
+    calculated, for the targets. This makes it cheap to study for
+    example a binding pocket in a large assembly.
+
+    Atoms that are not targets have SASA `NaN` in the result (check
+    with `isnan()`). Any area that includes them is also `NaN`: the
+    `total` of the result if not all atoms are targets, and in trees
+    and selections generated from the result the residues, chains,
+    structures and selections that include atoms that aren't
+    targets. These areas are written as "N/A" in text output.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_result_free().
+
+    @param structure The structure
+    @param command The selection of targets, e.g. "pocket, resi 10-20".
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used.
+
+    @return The result of the calculation, `NULL` if something went
+      wrong (including if the selection couldn't be parsed).
+
+    @ingroup core
+ */
+freesasa_result *
+freesasa_calc_targets(const freesasa_structure *structure,
+                      const char *command,
+                      const freesasa_parameters *parameters);
+
 /**
     Calculates SASA for a structure and returns as a tree of
     ::freesasa_node.
@@ -459,10 +609,126 @@ freesasa_result_classes(const freesasa_structure *structure,
  */
 void freesasa_result_free(freesasa_result *result);
 
+/**
+    Preprocess a receptor for rigid-body pose scoring.
+
+    Calculates the SASA of the isolated receptor and stores its
+    neighbor list and a spatial grid, so that ligand poses can be
+    scored with freesasa_receptor_score_poses() without repeating
+    that work.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_receptor_free().
+
+    @param xyz Array of receptor coordinates in the form x1,y1,z1,...,xn,yn,zn.
+    @param radii Receptor radii, this array should have n elements.
+    @param n Number of receptor atoms.
+    @param parameters Parameters for the calculation, these are also
+      used for all poses scored against the receptor. If `NULL`
+      defaults are used. Periodic boxes are not supported.
+
+    @return The receptor, `NULL` if something went wrong.
+
+    @ingroup core
+ */
+freesasa_receptor *
+freesasa_receptor_new(const double *xyz,
+                      const double *radii,
+                      int n,
+                      const freesasa_parameters *parameters);
+
+/**
+    Frees a ::freesasa_receptor object.
+
+    @param receptor the object to be freed.
+
+    @ingroup core
+ */
+void freesasa_receptor_free(freesasa_receptor *receptor);
+
+/**
+    Total SASA of the isolated receptor.
+
+    @param receptor The receptor.
+    @return Total SASA in Ångström^2.
+
+    @ingroup core
+ */
+double
+freesasa_receptor_area(const freesasa_receptor *receptor);
+
+/**
+    Score a batch of rigid-body poses of a ligand against a receptor.
+
+    Each pose is given by 12 numbers, a rotation matrix in row-major
+    order followed by a translation vector, and places the ligand atom
+    at x at R*x + t. For each pose only the ligand and the receptor
+    atoms in contact with it are recalculated, the remaining receptor
+    atoms keep the SASA from freesasa_receptor_new(). The poses are
+    divided over the number of threads in the receptor's parameters.
+
+    The buried area is the SASA of the isolated receptor plus that of
+    the isolated ligand minus the SASA of the complex.
+
+    @param receptor The receptor.
+    @param ligand_xyz Ligand coordinates in the form x1,y1,z1,...
+    @param ligand_radii Ligand radii, this array should have n_ligand elements.
+    @param n_ligand Number of ligand atoms.
+    @param transforms The poses, this array should have 12*n_poses elements.
+    @param n_poses Number of poses.
+    @param complex_sasa Total SASA of the complex for each pose is
+      written here, should have n_poses elements.
+    @param buried_area Buried area for each pose is written here,
+      should have n_poses elements.
+
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_WARN if there
+      were no poses, ::FREESASA_FAIL if the calculation failed.
+
+    @ingroup core
+ */
+int freesasa_receptor_score_poses(const freesasa_receptor *receptor,
+                                  const double *ligand_xyz,
+                                  const double *ligand_radii,
+                                  int n_ligand,
+                                  const double *transforms,
+                                  int n_poses,
+                                  double *complex_sasa,
+                                  double *buried_area);
+
+/**
+    Alanine scanning.
+
+    For each residue, calculates how the total SASA of the structure
+    changes if the residue's side chain is truncated at CB, i.e. all
+    atoms except backbone atoms and CB are removed. Residues without
+    a CB atom, such as glycine, get a change of 0. The SASA and the
+    neighbor list of the unmutated structure are calculated once, and
+    only the atoms in contact with the removed atoms are recalculated
+    for each residue. The residues are divided over the number of
+    threads in the parameters.
+
+    @param structure The structure.
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used.
+    @param delta The change in total SASA for each residue is written
+      here, should have freesasa_structure_n_residues() elements.
+
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_WARN if the
+      structure is empty, ::FREESASA_FAIL if the calculation failed.
+
+    @ingroup core
+ */
+int freesasa_alanine_scan(const freesasa_structure *structure,
+                          const freesasa_parameters *parameters,
+                          double *delta);
+
 /**
     Generate a classifier from a config-file.
 
-    Input file format described in @ref Config-file
+    Input file format described in @ref Config-file. The file can also
+    be a binary classifier written by
+    freesasa_classifier_write_binary(), which is memory-mapped if
+    possible and used without parsing. The file has to be seekable.
 
     Return value is dynamically allocated, should be freed with
     freesasa_classifier_free().
@@ -478,6 +744,28 @@ void freesasa_result_free(freesasa_result *result);
 freesasa_classifier *
 freesasa_classifier_from_file(FILE *file);
 
+/**
+    Write a classifier in binary form.
+
+    The binary file contains the names, radii, classes, reference
+    areas and hash tables of the classifier in the layout they are
+    used in, so that freesasa_classifier_from_file() can load it
+    without parsing or building tables. The file is written in the
+    byte order of the platform, and can only be read on platforms
+    with the same byte order.
+
+    @param output Output file, opened in binary mode.
+    @param classifier The classifier, from a config-file or one of the
+      static classifiers.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if the
+      file could not be written or if there was a memory allocation
+      failure.
+
+    @ingroup classifier
+ */
+int freesasa_classifier_write_binary(FILE *output,
+                                     const freesasa_classifier *classifier);
+
 /**
     Frees a classifier object
 
@@ -624,6 +912,82 @@ freesasa_selection_area(const freesasa_selection *selection);
  */
 int freesasa_selection_n_atoms(const freesasa_selection *selection);
 
+/**
+    Compile a selection.
+
+    Parses the command, with the same syntax as
+    freesasa_selection_new(), and checks the names and ranges in it
+    once, so that the selection can be applied to many structures
+    without parsing it again. Invalid names and ranges are reported
+    here and left out of the selection.
+
+    A compiled selection is not modified when it is applied, and can
+    be used by several threads at the same time.
+
+    @param command The selection
+    @return The compiled selection, should be freed with
+      freesasa_compiled_selection_free(). `NULL` if the command
+      couldn't be parsed or if memory allocation failed.
+
+    @ingroup selection
+ */
+freesasa_compiled_selection *
+freesasa_selection_compile(const char *command);
+
+/**
+    Free compiled selection.
+
+    @param compiled The compiled selection
+
+    @ingroup selection
+ */
+void freesasa_compiled_selection_free(freesasa_compiled_selection *compiled);
+
+/**
+    Name of a compiled selection
+
+    @param compiled The compiled selection
+    @return The name, truncated to ::FREESASA_MAX_SELECTION_NAME
+      characters
+
+    @ingroup selection
+ */
+const char *
+freesasa_compiled_selection_name(const freesasa_compiled_selection *compiled);
+
+/**
+    Command of a compiled selection
+
+    @param compiled The compiled selection
+    @return The command
+
+    @ingroup selection
+ */
+const char *
+freesasa_compiled_selection_command(const freesasa_compiled_selection *compiled);
+
+/**
+    Apply a compiled selection.
+
+    Selects the atoms of the structure and sums up their area in the
+    result, like freesasa_selection_new().
+
+    @param compiled The compiled selection
+    @param structure The structure to select from
+    @param result The results to integrate
+    @param mask If not `NULL`, one element per atom in the structure
+      is set to 1 for selected atoms and 0 for the rest.
+    @return The selection, should be freed with
+      freesasa_selection_free(). `NULL` if something went wrong.
+
+    @ingroup selection
+ */
+freesasa_selection *
+freesasa_selection_apply(const freesasa_compiled_selection *compiled,
+                         const freesasa_structure *structure,
+                         const freesasa_result *result,
+                         int *mask);
+
 /**
     Set the global verbosity level.
 
@@ -782,6 +1146,167 @@ freesasa_structure_array(FILE *pdb,
                          const freesasa_classifier *classifier,
                          int options);
 
+/**
+    Init array of structures from PDB, using a sidecar index file.
+
+    Equivalent to freesasa_structure_array(), but the locations of the
+    models and chains in the file are read from `index_file` if it
+    exists and was made for the current version of `pdb` (and the same
+    value of ::FREESASA_INCLUDE_HETATM). Otherwise the file is indexed
+    and the index written to `index_file`, so that the next call for
+    the same file doesn't have to scan it. Only a warning is printed if
+    the index can't be written.
+
+    @param pdb Input PDB-file.
+    @param index_file Path of the index file.
+    @param n Number of structures found are written to this integer.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield, see freesasa_structure_array().
+    @return Array of structures. Prints error message(s) and returns
+      `NULL` if there were problems reading input, if invalid value of
+      `options`, or upon a memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure **
+freesasa_structure_array_indexed(FILE *pdb,
+                                 const char *index_file,
+                                 int *n,
+                                 const freesasa_classifier *classifier,
+                                 int options);
+
+/**
+    Init structure from a BinaryCIF file.
+
+    Reads the columns of the `_atom_site` category in the first data
+    block of a BinaryCIF (MessagePack-encoded mmCIF) file, and selects
+    the same atoms as mmCIF input in the command-line tool. Input can
+    be compressed with gzip or zstd, see freesasa_structure_from_pdb().
+
+    The supported encodings are ByteArray, FixedPoint,
+    IntervalQuantization, RunLength, Delta, IntegerPacking and
+    StringArray. Only the columns used by FreeSASA are decoded.
+
+    @param input Input BinaryCIF file.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield, see freesasa_structure_from_pdb().
+      ::FREESASA_RADIUS_FROM_OCCUPANCY is ignored.
+    @return The generated structure. Prints an error and returns
+      `NULL` if input is invalid, has no atoms, or if there was a
+      memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure *
+freesasa_structure_from_bcif(FILE *input,
+                             const freesasa_classifier *classifier,
+                             int options);
+
+/**
+    Init array of structures from a BinaryCIF file.
+
+    The BinaryCIF version of freesasa_structure_array(). Chains are
+    identified by `auth_asym_id` and sorted by name, models are in the
+    order they appear in the file.
+
+    @param input Input BinaryCIF file.
+    @param n Number of structures found are written to this integer.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield, see freesasa_structure_array().
+    @return Array of structures. Prints error message(s) and returns
+      `NULL` if there were problems reading input, if invalid value of
+      `options`, or upon a memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure **
+freesasa_structure_array_bcif(FILE *input,
+                              int *n,
+                              const freesasa_classifier *classifier,
+                              int options);
+
+/**
+    Write structures to a binary cache file.
+
+    The cache stores everything needed to recreate the structures:
+    coordinates, radii, classes, residue and chain tables, the names
+    of the atoms, and PDB lines if the structures were read from PDB.
+    It can be loaded with freesasa_structure_array_from_cache()
+    without parsing or classifying the atoms again. Several calls can
+    write to the same file, the structures are then loaded in the
+    order they were written.
+
+    The file is written in the byte order of the platform, and can
+    only be read on platforms with the same byte order.
+
+    @param output Output file, opened in binary mode.
+    @param structures Array of structures.
+    @param n Number of structures.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if the
+      file could not be written or if there was a memory allocation
+      failure.
+
+    @ingroup structure
+ */
+int freesasa_structure_write_cache(FILE *output,
+                                   freesasa_structure *const *structures,
+                                   int n);
+
+/**
+    Load structures from a binary cache file.
+
+    Reads a file written by freesasa_structure_write_cache(). The file
+    is memory-mapped if possible, and the names and PDB lines of the
+    atoms point into the mapped file, so that loading doesn't require
+    any allocations per atom. The mapping is released when the last of
+    the structures is freed. Radii and classes are those of the
+    classifier used when the cache was written.
+
+    @param input Input file, opened in binary mode.
+    @param n Number of structures found are written to this integer.
+    @return Array of structures. Its members should be freed using
+      freesasa_structure_free() and the array itself with
+      free(). Prints error message(s) and returns `NULL` if the file
+      is not a valid cache, or upon a memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_structure **
+freesasa_structure_array_from_cache(FILE *input,
+                                    int *n);
+
+/**
+    Set the number of threads used to parse models and chains.
+
+    Used by freesasa_structure_array() and
+    freesasa_structure_array_indexed(), which parse each model or
+    chain into a separate structure. The order of the structures does
+    not depend on the number of threads, but warnings and errors from
+    different models and chains may be printed in any order when more
+    than one thread is used. The default is 1. Like
+    freesasa_set_verbosity() this is a global setting, and should not
+    be changed while structures are being read.
+
+    @param n Number of threads.
+    @return ::FREESASA_SUCCESS. ::FREESASA_WARN if `n` is larger than
+      the supported number of threads (16, or 1 without
+      thread-support), the maximum is then used instead.
+      ::FREESASA_FAIL if `n < 1`.
+
+    @ingroup structure
+ */
+int freesasa_set_parse_threads(int n);
+
+/**
+    Get the number of threads used to parse models and chains.
+
+    @return Number of threads.
+    @see freesasa_set_parse_threads()
+
+    @ingroup structure
+ */
+int freesasa_get_parse_threads(void);
+
 /**
     Add individual atom to structure using default behavior.
 
@@ -863,6 +1388,55 @@ int freesasa_structure_add_atom_wopt(freesasa_structure *structure,
                                      double x, double y, double z,
                                      const freesasa_classifier *classifier,
                                      int options);
+/**
+    Create a structure from arrays of atoms.
+
+    Builds the same structure as adding the atoms one by one with
+    freesasa_structure_add_atom_wopt(), but is intended for clients
+    that already have the atoms in memory. The storage of the
+    structure is allocated once, and each combination of residue name
+    and atom name is only classified once.
+
+    Warnings about unknown atoms are only printed for the first atom
+    with each combination of names, unknown atoms are handled as
+    described for freesasa_structure_add_atom_wopt(), according to
+    the options ::FREESASA_SKIP_UNKNOWN and ::FREESASA_HALT_AT_UNKNOWN.
+
+    @param n Number of atoms.
+    @param atom_names The atom names: `" CA "`,`"CA"`, `" OXT"`, etc.
+    @param residue_names The residue names: `"ALA"`, `"PHE"`, etc.
+    @param residue_numbers The residue numbers, of the format `"   1"`, `" 123"`, etc.
+    @param chain_labels The chain labels, `n` characters, not a
+      NUL-terminated string.
+    @param xyz Coordinates, `3 * n` values, in the order
+      `x1, y1, z1, x2, ...`.
+    @param radii Radii of the atoms. If `NULL` the classifier is
+      used. If given, no atoms are unknown.
+    @param classes Classes of the atoms. If `NULL` the classifier
+      is used.
+    @param classifier A ::freesasa_classifier to determine radius and
+      class of the atoms, and the reference areas of the
+      residues. If `NULL` the default classifier is used.
+    @param options A bitfield to determine what to do with unknown
+      atoms, see freesasa_structure_add_atom_wopt().
+
+    @return The structure. `NULL` if memory allocation fails, a
+      radius is negative, or if halting at an unknown atom.
+
+    @ingroup structure
+ */
+freesasa_structure *
+freesasa_structure_from_arrays(int n,
+                               const char *const *atom_names,
+                               const char *const *residue_names,
+                               const char *const *residue_numbers,
+                               const char *chain_labels,
+                               const double *xyz,
+                               const double *radii,
+                               const freesasa_atom_class *classes,
+                               const freesasa_classifier *classifier,
+                               int options);
+
 /**
     Add atoms from a mmCIF file to a structure
 
@@ -909,6 +1483,35 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
                               const freesasa_classifier *classifier,
                               int options);
 
+/**
+    Create a view of a selection of chains of a structure.
+
+    The view can be used like any other structure, but the atoms are
+    not added and classified again, as by
+    freesasa_structure_get_chains(). Names, classes and reference
+    areas are shared with the input structure. If the chains are
+    adjacent in the input structure, which is usually the case, the
+    atoms and coordinates are shared as well. The radii of the view
+    are a copy, and can be changed without affecting the input
+    structure.
+
+    The input structure must not be modified or freed while the view
+    is in use. Atoms can't be added to a view. The view should be
+    freed with freesasa_structure_free().
+
+    @param structure Input structure.
+    @param chains String of chain labels (e.g. `"AB"`)
+
+    @return A view of the specified chains. Returns `NULL` if one or
+    more of the requested chains don't match any in the input
+    structure or if memory allocation fails.
+
+    @ingroup structure
+ */
+freesasa_structure *
+freesasa_structure_chain_view(const freesasa_structure *structure,
+                              const char *chains);
+
 /**
     Get string listing all chains in structure.
 
@@ -1239,6 +1842,26 @@ freesasa_structure_classifier_name(const freesasa_structure *structure);
 freesasa_node *
 freesasa_tree_new(void);
 
+/**
+    Generates empty ::freesasa_node of type ::FREESASA_NODE_ROOT,
+    whose nodes are allocated in a caller-owned arena.
+
+    To be populated by freesasa_tree_add_result(). The tree should
+    still be freed using freesasa_node_free(), to release its
+    selections, but the nodes themselves are only released by
+    freesasa_arena_reset() or freesasa_arena_free(). The arena
+    therefore has to outlive the tree, and any tree it has been joined
+    to. This allows several trees in a batch to be released at once,
+    and the memory of the arena to be reused for the next batch.
+
+    @param arena The arena.
+    @return A ::freesasa_node. `NULL` if memory allocation fails.
+
+    @ingroup node
+ */
+freesasa_node *
+freesasa_tree_new_arena(freesasa_arena *arena);
+
 /**
     Init tree based on result and structure.
 
@@ -1290,7 +1913,8 @@ int freesasa_tree_add_result(freesasa_node *tree,
       will be stored here.
     @param tree2 Node of type ::FREESASA_NODE_ROOT. Will be added to
       tree1, and then changed to `NULL`, since ownership of its contents
-      have been transferred to tree1.
+      have been transferred to tree1. If tree2 owns its arena, the
+      memory of the arena is transferred to the arena of tree1.
     @return ::FREESASA_SUCCESS.
 
     @ingroup node
@@ -1317,16 +1941,64 @@ int freesasa_tree_export(FILE *output,
 /**
     Free tree.
 
-    Will not free anything if the node is not a root node.
+    Will not free anything if the node is not a root node. The nodes
+    of a tree created by freesasa_tree_new_arena() are released with
+    the arena.
 
     @param root Node of type ::FREESASA_NODE_ROOT
     @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the node has a
-      parent.
+      parent, or is not of type ::FREESASA_NODE_ROOT.
 
     @ingroup node
  */
 int freesasa_node_free(freesasa_node *root);
 
+/**
+    Create an arena for result trees.
+
+    Memory is allocated in blocks when the arena is first used.
+
+    @return The arena. `NULL` if memory allocation fails.
+
+    @ingroup node
+ */
+freesasa_arena *
+freesasa_arena_new(void);
+
+/**
+    Release all memory allocated in an arena.
+
+    All trees allocated in the arena become invalid.
+
+    @param arena The arena. Can be `NULL`.
+
+    @ingroup node
+ */
+void freesasa_arena_free(freesasa_arena *arena);
+
+/**
+    Mark all memory in an arena as unused, without releasing it.
+
+    All trees allocated in the arena become invalid, and the memory
+    is reused by the trees allocated after the reset.
+
+    @param arena The arena.
+
+    @ingroup node
+ */
+void freesasa_arena_reset(freesasa_arena *arena);
+
+/**
+    The number of bytes allocated by an arena.
+
+    @param arena The arena.
+    @return Size of all blocks of the arena, used or not.
+
+    @ingroup node
+ */
+size_t
+freesasa_arena_size(const freesasa_arena *arena);
+
 /**
     The ::freesasa_nodearea of all atoms belonging to a node.
 
@@ -65,6 +65,9 @@ extern const freesasa_nodearea freesasa_nodearea_null;
     make sure it is large enough.
     @param c Coordinates of the object to calculate SASA for.
     @param radii Array of radii for each sphere.
+    @param target If not NULL, SASA is only calculated for atoms with
+    target[i] != 0, the other elements of sasa are left untouched
+    (all atoms are still used as occluders).
     @param param Parameters specifying resolution, probe radius and
     number of threads. If NULL :.freesasa_default_parameters is used.
     @return ::FREESASA_SUCCESS on success, ::FREESASA_WARN if multiple
@@ -74,6 +77,7 @@ extern const freesasa_nodearea freesasa_nodearea_null;
 int freesasa_shrake_rupley(double *sasa,
                            const coord_t *c,
                            const double *radii,
+                           const int *target,
                            const freesasa_parameters *param);
 
 /**
@@ -90,6 +94,8 @@ int freesasa_shrake_rupley(double *sasa,
     make sure it is large enough.
     @param c Coordinates of the object to calculate SASA for.
     @param radii Array of radii for each sphere.
+    @param target If not NULL, SASA is only calculated for atoms with
+    target[i] != 0 (see freesasa_shrake_rupley()).
     @param param Parameters specifying resolution, probe radius and
     number of threads. If NULL :.freesasa_default_parameters is used.
     @return ::FREESASA_SUCCESS on success, ::FREESASA_WARN if
@@ -100,8 +106,50 @@ int freesasa_shrake_rupley(double *sasa,
 int freesasa_lee_richards(double *sasa,
                           const coord_t *c,
                           const double *radii,
+                          const int *target,
                           const freesasa_parameters *param);
 
+/**
+    Calculate S&R SASA for several probe radii in one pass.
+
+    The neighbor list is calculated once for the largest probe and
+    the same test points are used for all probes.
+
+    @param sasa The results are written to this array, it should have
+    `n_probes * n_atoms` elements, the result for atom `i` and probe
+    `p` is stored in `sasa[p * n_atoms + i]`.
+    @param c Coordinates of the object to calculate SASA for.
+    @param radii Array of radii for each sphere (without probe).
+    @param probes The probe radii.
+    @param n_probes Number of probe radii.
+    @param param Parameters specifying resolution and number of
+    threads, the probe radius is ignored. If NULL
+    :.freesasa_default_parameters is used.
+    @return See freesasa_shrake_rupley().
+ */
+int freesasa_shrake_rupley_sweep(double *sasa,
+                                 const coord_t *c,
+                                 const double *radii,
+                                 const double *probes,
+                                 int n_probes,
+                                 const freesasa_parameters *param);
+
+/**
+    Calculate L&R SASA for several probe radii.
+
+    The neighbor list is calculated once for the largest probe and
+    filtered for each of the others. Arguments as for
+    freesasa_shrake_rupley_sweep().
+
+    @return See freesasa_lee_richards().
+ */
+int freesasa_lee_richards_sweep(double *sasa,
+                                const coord_t *c,
+                                const double *radii,
+                                const double *probes,
+                                int n_probes,
+                                const freesasa_parameters *param);
+
 /**
     Calculate SASA based on a coordinate object, radii and parameters
 
@@ -121,6 +169,35 @@ freesasa_calc(const coord_t *c,
               const double *radii,
               const freesasa_parameters *parameters);
 
+/**
+    The periodic box of a set of parameters.
+
+    @param parameters Parameters
+    @return The box vectors, or NULL if no box is set.
+ */
+const double *
+freesasa_parameters_box(const freesasa_parameters *parameters);
+
+/**
+    Calculate SASA for a subset of the atoms
+
+    Like freesasa_calc(), but only atoms with `target[i] != 0` are
+    calculated, the rest only act as occluders and have their SASA
+    set to NaN. The total only includes the targets.
+
+    @param c Coordinates
+    @param radii Atomi radii
+    @param target One element per atom, nonzero for the atoms to
+      calculate. If NULL all atoms are calculated.
+    @param parameters Parameters
+    @return Result of calculation, NULL if something went wrong.
+ */
+freesasa_result *
+freesasa_calc_subset(const coord_t *c,
+                     const double *radii,
+                     const int *target,
+                     const freesasa_parameters *parameters);
+
 int freesasa_write_log(FILE *log,
                        freesasa_node *root);
 
@@ -224,12 +301,107 @@ int freesasa_write_log(FILE *log,
 freesasa_result *
 freesasa_result_clone(const freesasa_result *result);
 
+/**
+    Allocate memory in an arena.
+
+    @param arena The arena.
+    @param size Number of bytes.
+    @return Pointer to memory suitably aligned for any of the
+      structs of the library. `NULL` if memory allocation fails.
+ */
+void *
+freesasa_arena_alloc(freesasa_arena *arena,
+                     size_t size);
+
+/**
+    Copy a string to an arena.
+
+    @param arena The arena.
+    @param str The string.
+    @return The copy. `NULL` if memory allocation fails.
+ */
+char *
+freesasa_arena_strdup(freesasa_arena *arena,
+                      const char *str);
+
+/**
+    Copy the first characters of a string to an arena.
+
+    @param arena The arena.
+    @param str The string.
+    @param length Number of characters to copy, a terminating `\0`
+      is added.
+    @return The copy. `NULL` if memory allocation fails.
+ */
+char *
+freesasa_arena_strndup(freesasa_arena *arena,
+                       const char *str,
+                       size_t length);
+
+/**
+    Move the memory of one arena to another.
+
+    @param arena The arena to keep.
+    @param other Its memory is transferred to arena, and the handle
+      is freed.
+ */
+void freesasa_arena_adopt(freesasa_arena *arena,
+                          freesasa_arena *other);
+
+/**
+    Allocate selection object with area 0 for name and command
+*/
+freesasa_selection *
+freesasa_selection_alloc(const char *name, const char *command);
+
 /**
     Clone selection object
 */
 freesasa_selection *
 freesasa_selection_clone(const freesasa_selection *selection);
 
+/**
+    Evaluate a selection command without calculating its area.
+
+    @param mask One element per atom in the structure, set to 1 for
+      selected atoms and 0 for the rest.
+    @param command The selection, same syntax as freesasa_selection_new().
+    @param structure The structure.
+    @return The number of selected atoms. ::FREESASA_FAIL if the
+      command couldn't be parsed.
+ */
+int freesasa_selection_mask(int *mask,
+                            const char *command,
+                            const freesasa_structure *structure);
+
+/**
+    The atoms of a structure as columns.
+
+    The names of the atoms are stored once per structure, and each
+    column holds the index of the name of each atom in `strings`.
+    The pointers are valid until more atoms are added to the
+    structure.
+ */
+struct structure_columns {
+    int n_atoms;                /**< Number of atoms */
+    int n_strings;              /**< Number of distinct names */
+    const char *const *strings; /**< The names */
+    const int *atom_name;       /**< Index in strings per atom */
+    const int *symbol;          /**< Index in strings per atom */
+    const int *res_name;        /**< Index in strings per atom */
+    const int *res_number;      /**< Index in strings per atom */
+    const char *chain_label;    /**< Chain label per atom */
+};
+
+/**
+    Get the columns of a structure.
+
+    @param structure A structure.
+    @param columns The columns are written here.
+ */
+void freesasa_structure_columns(const freesasa_structure *structure,
+                                struct structure_columns *columns);
+
 /**
     Get coordinates.
 
@@ -253,13 +425,19 @@ freesasa_structure_atom_class(const freesasa_structure *structure,
 /**
     The PDB line used to generate the atom.
 
+    The line points into the input file, that the structure keeps in
+    memory, and is not NUL-terminated.
+
     @param structure A structure.
     @param i Atom index.
+    @param length The length of the line (including newline) is
+      stored here.
     @return The line, NULL if structure wasn't generated from a PDB file.
  */
 const char *
 freesasa_structure_atom_pdb_line(const freesasa_structure *structure,
-                                 int i);
+                                 int i,
+                                 int *length);
 
 const freesasa_nodearea *
 freesasa_structure_residue_reference(const freesasa_structure *structure,
@@ -296,6 +474,9 @@ int freesasa_atom_nodearea(freesasa_nodearea *area,
 /**
     Adds all members of term to corresponding members of sum
 
+    If the total of term is `NaN` (atoms that weren't calculated), all
+    members of sum become `NaN`.
+
     @param sum Object to add to
     @param term Object to add
  */
@@ -402,6 +583,25 @@ int freesasa_mem_fail(const char *file,
 const char *
 freesasa_thread_error(int error_code);
 
+/**
+    Formats an area for text output.
+
+    Areas that include atoms that weren't calculated are `NaN`, and
+    are written as "N/A".
+
+    @param buf The string is written here, should have room for width
+      or the formatted number, whichever is longer.
+    @param area The area.
+    @param width Minimum field width.
+    @param precision Number of decimals.
+    @return buf
+ */
+char *
+freesasa_area_str(char *buf,
+                  double area,
+                  int width,
+                  int precision);
+
 /**
     Prints fail message with function name, file name, and line number.
 
@@ -37,6 +37,7 @@ write_result(FILE *log,
     const char *name = NULL;
     freesasa_node *structure = NULL, *chain = NULL;
     const freesasa_nodearea *area = NULL;
+    char buf[32];
 
     assert(log);
     assert(freesasa_node_type(result) == FREESASA_NODE_RESULT);
@@ -57,18 +58,19 @@ write_result(FILE *log,
     fprintf(log, "atoms   : %d\n", freesasa_node_structure_n_atoms(structure));
 
     fprintf(log, "\nRESULTS (A^2)\n");
-    fprintf(log, "Total   : %10.2f\n", area->total);
-    fprintf(log, "Apolar  : %10.2f\n", area->apolar);
-    fprintf(log, "Polar   : %10.2f\n", area->polar);
+    fprintf(log, "Total   : %s\n", freesasa_area_str(buf, area->total, 10, 2));
+    fprintf(log, "Apolar  : %s\n", freesasa_area_str(buf, area->apolar, 10, 2));
+    fprintf(log, "Polar   : %s\n", freesasa_area_str(buf, area->polar, 10, 2));
     if (area->unknown > 0) {
-        fprintf(log, "Unknown : %10.2f\n", area->unknown);
+        fprintf(log, "Unknown : %s\n", freesasa_area_str(buf, area->unknown, 10, 2));
     }
 
     chain = freesasa_node_children(structure);
     while (chain) {
         area = freesasa_node_area(chain);
         assert(area);
-        fprintf(log, "CHAIN %s : %10.2f\n", freesasa_node_name(chain), area->total);
+        fprintf(log, "CHAIN %s : %s\n", freesasa_node_name(chain),
+                freesasa_area_str(buf, area->total, 10, 2));
         chain = freesasa_node_next(chain);
     }
 
@@ -86,15 +88,16 @@ write_selections(FILE *log,
 {
     freesasa_node *structure = freesasa_node_children(result);
     const freesasa_selection **selection;
+    char buf[32];
 
     while (structure) {
         selection = freesasa_node_structure_selections(structure);
         if (selection && *selection) {
             fprintf(log, "\nSELECTIONS\n");
             while (*selection) {
-                fprintf(log, "%s : %10.2f\n",
+                fprintf(log, "%s : %s\n",
                         freesasa_selection_name(*selection),
-                        freesasa_selection_area(*selection));
+                        freesasa_area_str(buf, freesasa_selection_area(*selection), 10, 2));
                 ++selection;
             }
         }
@@ -153,6 +156,7 @@ int freesasa_write_res(FILE *log,
     freesasa_node *result, *structure, *chain, *residue;
     int n_res = freesasa_classify_n_residue_types() + 1, i_res, i;
     double *residue_area = malloc(sizeof(double) * n_res);
+    char buf[32];
 
     assert(log);
     assert(root);
@@ -184,9 +188,9 @@ int freesasa_write_res(FILE *log,
         for (i_res = 0; i_res < n_res; ++i_res) {
             double sasa = residue_area[i_res];
             if (i_res < 20 || sasa > 0) {
-                fprintf(log, "RES %s : %10.2f\n",
+                fprintf(log, "RES %s : %s\n",
                         freesasa_classify_residue_name(i_res),
-                        sasa);
+                        freesasa_area_str(buf, sasa, 10, 2));
             }
         }
         fprintf(log, "\n");
@@ -206,6 +210,7 @@ int freesasa_write_seq(FILE *log,
                        freesasa_node *root)
 {
     freesasa_node *result, *structure, *chain, *residue;
+    char buf[32];
 
     assert(log);
     assert(root);
@@ -222,11 +227,11 @@ int freesasa_write_seq(FILE *log,
                 residue = freesasa_node_children(chain);
                 while (residue) {
                     assert(freesasa_node_type(residue) == FREESASA_NODE_RESIDUE);
-                    fprintf(log, "SEQ %s %s %s : %7.2f\n",
+                    fprintf(log, "SEQ %s %s %s : %s\n",
                             freesasa_node_name(chain),
                             freesasa_node_residue_number(residue),
                             freesasa_node_name(residue),
-                            freesasa_node_area(residue)->total);
+                            freesasa_area_str(buf, freesasa_node_area(residue)->total, 7, 2));
                     residue = freesasa_node_next(residue);
                 }
                 chain = freesasa_node_next(chain);
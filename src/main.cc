@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
 #include <unistd.h>
 
 #include "cif.hh"
@@ -42,7 +43,14 @@ enum { B_FILE,
        RSA,
        RADII,
        DEPRECATED,
-       CIF };
+       CIF,
+       TARGET,
+       BOX,
+       PDB_INDEX,
+       BCIF,
+       CACHE,
+       WRITE_CACHE,
+       WRITE_CONFIG };
 
 static int option_flag;
 
@@ -68,7 +76,14 @@ static struct option long_options[] = {
     {"format", required_argument, 0, 'f'},
     {"depth", required_argument, 0, 'd'},
     {"cif", no_argument, &option_flag, CIF},
+    {"bcif", no_argument, &option_flag, BCIF},
+    {"cache", no_argument, &option_flag, CACHE},
+    {"write-cache", required_argument, &option_flag, WRITE_CACHE},
+    {"write-config", required_argument, &option_flag, WRITE_CONFIG},
     {"select", required_argument, &option_flag, SELECT},
+    {"target", required_argument, &option_flag, TARGET},
+    {"box", required_argument, &option_flag, BOX},
+    {"pdb-index", no_argument, &option_flag, PDB_INDEX},
     {"unknown", required_argument, &option_flag, UNKNOWN},
     {"rsa", no_argument, &option_flag, RSA},
     {"radii", required_argument, &option_flag, RADII},
@@ -93,6 +108,9 @@ struct cli_state {
     int structure_options;
     int static_classifier;
     int cif;
+    int bcif;
+    int cache;
+    int pdb_index;
     int no_rel;
     /* chain groups */
     int n_chain_groups;
@@ -100,11 +118,14 @@ struct cli_state {
     /* selection commands */
     int n_select;
     char **select_cmd;
+    freesasa_compiled_selection **select;
+    /* only calculate SASA for these atoms */
+    char *target_cmd;
     /* output settings */
     int output_format, output_depth;
     /* Files */
     char *output_filename;
-    FILE *input, *output, *errlog;
+    FILE *input, *output, *errlog, *cache_output, *config_output;
 };
 
 struct analysis_results {
@@ -127,12 +148,19 @@ init_state(struct cli_state *state)
     state->chain_groups = NULL;
     state->n_select = 0;
     state->select_cmd = 0;
+    state->select = NULL;
+    state->target_cmd = NULL;
     state->output_format = 0;
     state->output_depth = FREESASA_OUTPUT_CHAIN;
     state->output_filename = NULL;
     state->output = NULL;
     state->errlog = NULL;
     state->cif = 0;
+    state->bcif = 0;
+    state->cache = 0;
+    state->cache_output = NULL;
+    state->config_output = NULL;
+    state->pdb_index = 0;
 }
 
 static void
@@ -151,10 +179,20 @@ release_state(struct cli_state *state)
         for (i = 0; i < state->n_select; ++i) {
             free(state->select_cmd[i]);
         }
+        free(state->select_cmd);
+    }
+    if (state->select) {
+        for (i = 0; i < state->n_select; ++i) {
+            freesasa_compiled_selection_free(state->select[i]);
+        }
+        free(state->select);
     }
     if (state->errlog) fclose(state->errlog);
+    if (state->cache_output) fclose(state->cache_output);
+    if (state->config_output) fclose(state->config_output);
     if (state->output) fclose(state->output);
     free(state->output_filename);
+    free(state->target_cmd);
 }
 
 static void
@@ -172,15 +210,16 @@ help(void)
     printf("\n"
            "Options:\n"
            "  --shrake-rupley | --lee-richards\n"
-           "  --probe-radius=<NUMBER>\n"
+           "  --probe-radius=<NUMBER> --box=<a,b,c[,alpha,beta,gamma]>\n"
            "  --resolution=<INTEGER> -n-threads=<INTEGER>\n"
            "  --radius-from-occupancy | --config-file=<FILE> | --radii=<protor|naccess>\n"
+           "  --write-config=<FILE>\n"
            "  --hetatm --hydrogen\n"
            "  --unknown=<guess|skip|halt>\n"
-           "  --cif\n"
-           "  --separate-models | --join-models\n"
+           "  --cif | --bcif | --cache --write-cache=<FILE>\n"
+           "  --separate-models | --join-models --pdb-index\n"
            "  --separate-chains | --chain-groups=<LIST> ...\n"
-           "  --select=<STRING> ...\n"
+           "  --select=<STRING> ... --target=<STRING>\n"
            "  --output=<FILE> --error-file=<FILE> --no-warnings\n"
            "  --format=<" FORMAT_STRING "> ... \n"
            "  --depth=<structure|chain|residue|atom>\n");
@@ -260,6 +299,7 @@ exit_with_help(void)
 
 static std::vector<freesasa_structure *>
 get_structures(std::FILE *input,
+               const char *name,
                int *n,
                const struct cli_state *state)
 {
@@ -268,13 +308,29 @@ get_structures(std::FILE *input,
     freesasa_structure *tmp;
 
     *n = 0;
-    if ((state->structure_options & FREESASA_SEPARATE_CHAINS) ||
+    if (state->cache) {
+        freesasa_structure **cached = freesasa_structure_array_from_cache(input, n);
+        structures.reserve(*n);
+        for (i = 0; i < *n; ++i) {
+            structures.push_back(cached[i]);
+        }
+        free(cached);
+    } else if ((state->structure_options & FREESASA_SEPARATE_CHAINS) ||
         (state->structure_options & FREESASA_SEPARATE_MODELS)) {
         if (state->cif) {
             structures = freesasa_cif_structure_array(input, n, state->classifier, state->structure_options);
         } else {
             // TODO this hack needed since PDB implementation is in C
-            freesasa_structure **db_ptr_structs = freesasa_structure_array(input, n, state->classifier, state->structure_options);
+            freesasa_structure **db_ptr_structs;
+            if (state->bcif) {
+                db_ptr_structs = freesasa_structure_array_bcif(input, n, state->classifier, state->structure_options);
+            } else if (state->pdb_index && input != stdin) {
+                std::string index_file = std::string(name) + ".fsidx";
+                db_ptr_structs = freesasa_structure_array_indexed(input, index_file.c_str(), n,
+                                                                  state->classifier, state->structure_options);
+            } else {
+                db_ptr_structs = freesasa_structure_array(input, n, state->classifier, state->structure_options);
+            }
             structures.reserve(*n);
             for (i = 0; i < *n; ++i) {
                 structures.push_back(std::move(db_ptr_structs[i]));
@@ -284,6 +340,8 @@ get_structures(std::FILE *input,
         *n = 1;
         if (state->cif) {
             structures.emplace_back(freesasa_structure_from_cif(input, state->classifier, state->structure_options));
+        } else if (state->bcif) {
+            structures.emplace_back(freesasa_structure_from_bcif(input, state->classifier, state->structure_options));
         } else {
             structures.emplace_back(freesasa_structure_from_pdb(input, state->classifier, state->structure_options));
         }
@@ -292,14 +350,17 @@ get_structures(std::FILE *input,
         }
     }
 
+    if (state->cache_output && *n > 0 &&
+        freesasa_structure_write_cache(state->cache_output, structures.data(), *n) == FREESASA_FAIL) {
+        abort_msg("failed writing structure cache");
+    }
+
     /* get chain-groups (if requested) */
     if (state->n_chain_groups > 0) {
         n2 = *n;
         for (i = 0; i < state->n_chain_groups; ++i) {
             for (j = 0; j < *n; ++j) {
-                // TODO make this function pdb and cif compatible.
-                tmp = freesasa_structure_get_chains(structures[j], state->chain_groups[i],
-                                                    state->classifier, state->structure_options);
+                tmp = freesasa_structure_chain_view(structures[j], state->chain_groups[i]);
                 if (tmp != NULL) {
                     ++n2;
                     structures.reserve(n2);
@@ -323,6 +384,7 @@ run_analysis(FILE *input,
     std::vector<freesasa_structure *> structures;
     freesasa_node *tree = freesasa_tree_new(), *tmp_tree, *structure_node;
     const freesasa_result *result;
+    freesasa_result *target_result;
     freesasa_selection *sel;
     int n = 0, i, c;
     char *name_i = (char *)malloc(name_len + 10);
@@ -331,7 +393,7 @@ run_analysis(FILE *input,
     if (name_i == NULL) abort_msg("memory failure");
 
     /* read PDB file */
-    structures = get_structures(input, &n, state);
+    structures = get_structures(input, name, &n, state);
     if (n == 0) abort_msg("invalid input");
 
     /* perform calculation on each structure */
@@ -340,7 +402,14 @@ run_analysis(FILE *input,
         if (n > 1 && (state->structure_options & FREESASA_SEPARATE_MODELS))
             sprintf(name_i + strlen(name_i), ":%d", freesasa_structure_model(structures[i]));
 
-        tmp_tree = freesasa_calc_tree(structures[i], &state->parameters, name_i);
+        if (state->target_cmd) {
+            target_result = freesasa_calc_targets(structures[i], state->target_cmd, &state->parameters);
+            if (target_result == NULL) abort_msg("can't calculate SASA for target '%s'", state->target_cmd);
+            tmp_tree = freesasa_tree_init(target_result, structures[i], name_i);
+            freesasa_result_free(target_result);
+        } else {
+            tmp_tree = freesasa_calc_tree(structures[i], &state->parameters, name_i);
+        }
         if (tmp_tree == NULL) abort_msg("can't calculate SASA");
 
         structure_node =
@@ -350,7 +419,7 @@ run_analysis(FILE *input,
         /* Calculate selections for each structure */
         if (state->n_select > 0) {
             for (c = 0; c < state->n_select; ++c) {
-                sel = freesasa_selection_new(state->select_cmd[c], structures[i], result);
+                sel = freesasa_selection_apply(state->select[c], structures[i], result, NULL);
                 if (sel != NULL) {
                     freesasa_node_structure_add_selection(structure_node, sel);
                 } else {
@@ -364,7 +433,13 @@ run_analysis(FILE *input,
             abort_msg("failed joining result-trees");
         }
 
-        freesasa_structure_free(structures[i]);
+        /* chain groups are views of the first structures */
+        if (state->n_chain_groups == 0) freesasa_structure_free(structures[i]);
+    }
+    if (state->n_chain_groups > 0) {
+        for (i = n - 1; i >= 0; --i) {
+            freesasa_structure_free(structures[i]);
+        }
     }
 
     return tree;
@@ -438,6 +513,27 @@ state_add_select(const char *cmd, struct cli_state *state)
     }
 }
 
+/* Selections are parsed once, after the verbosity has been set, and
+   applied to each structure */
+static void
+state_compile_selections(struct cli_state *state)
+{
+    int i;
+
+    if (state->n_select == 0) return;
+
+    state->select = (freesasa_compiled_selection **)calloc(state->n_select, sizeof(freesasa_compiled_selection *));
+    if (state->select == NULL) {
+        abort_msg("out of memory");
+    }
+    for (i = 0; i < state->n_select; ++i) {
+        state->select[i] = freesasa_selection_compile(state->select_cmd[i]);
+        if (state->select[i] == NULL) {
+            abort_msg("illegal selection");
+        }
+    }
+}
+
 static void
 state_add_unknown_option(const char *optarg, struct cli_state *state)
 {
@@ -530,6 +626,21 @@ state_set_static_classifier(const char *optarg, struct cli_state *state)
     state->static_classifier = 1;
 }
 
+static void
+state_set_box(const char *arg,
+              struct cli_state *state)
+{
+    double a, b, c, alpha = 90, beta = 90, gamma = 90;
+    int n = sscanf(arg, "%lf,%lf,%lf,%lf,%lf,%lf", &a, &b, &c, &alpha, &beta, &gamma);
+
+    if (n != 3 && n != 6) {
+        abort_msg("box '%s' not valid, should be 'a,b,c' or 'a,b,c,alpha,beta,gamma'", arg);
+    }
+    if (freesasa_parameters_set_box(&state->parameters, a, b, c, alpha, beta, gamma)) {
+        abort_msg("invalid box '%s'", arg);
+    }
+}
+
 /* Parse command line arguments and transform state
    accordingly. Parameter state assumed to be initialized to default. */
 static int
@@ -577,6 +688,36 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             case CIF:
                 state->cif = 1;
                 break;
+            case BCIF:
+                state->bcif = 1;
+                break;
+            case CACHE:
+                state->cache = 1;
+                break;
+            case WRITE_CACHE:
+                if (state->cache_output != NULL) {
+                    abort_msg("option --write-cache can only be set once");
+                }
+                state->cache_output = fopen_werr(optarg, "wb");
+                break;
+            case WRITE_CONFIG:
+                if (state->config_output != NULL) {
+                    abort_msg("option --write-config can only be set once");
+                }
+                state->config_output = fopen_werr(optarg, "wb");
+                break;
+            case TARGET:
+                if (state->target_cmd != NULL) {
+                    abort_msg("option --target can only be set once");
+                }
+                state->target_cmd = strdup(optarg);
+                break;
+            case BOX:
+                state_set_box(optarg, state);
+                break;
+            case PDB_INDEX:
+                state->pdb_index = 1;
+                break;
             default:
                 abort(); /* what does this even mean? */
             }
@@ -607,8 +748,9 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             freesasa_set_verbosity(FREESASA_V_NOWARNINGS);
             break;
         case 'c': {
-            cf = fopen_werr(optarg, "r");
+            cf = fopen_werr(optarg, "rb");
             state->classifier = state->classifier_from_file = freesasa_classifier_from_file(cf);
+            fclose(cf);
             if (state->classifier_from_file == NULL) abort_msg("can't read file '%s'", optarg);
             state->no_rel = 1;
             break;
@@ -658,6 +800,8 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             if (USE_THREADS) {
                 state->parameters.n_threads = atoi(optarg);
                 if (state->parameters.n_threads < 1) abort_msg("number of threads must be 1 or larger");
+                /* also used to parse models and chains (capped at the maximum) */
+                freesasa_set_parse_threads(state->parameters.n_threads);
             } else {
                 abort_msg("option '-t' only defined if program compiled with thread support");
             }
@@ -713,10 +857,13 @@ parse_arg(int argc, char **argv, struct cli_state *state)
         abort_msg("the RSA format can not be used with the options -C or -M, "
                   "it does not support several results in one file");
 
-    if (state->output_format & FREESASA_LOG) {
+    if (state->output_format & FREESASA_LOG && !(state->config_output && optind == argc)) {
         fprintf(state->output, "## %s ##\n", PACKAGE_STRING);
     }
 
+    if (state->cif + state->bcif + state->cache > 1) abort_msg("only one of the options --cif, --bcif and --cache can be used");
+    if ((state->output_format == FREESASA_CIF || state->output_format == FREESASA_PDB) && state->bcif)
+        abort_msg("CIF and PDB output can not be generated from BinaryCIF input");
     if (state->output_format == FREESASA_CIF && state->cif != 1) abort_msg("CIF output can not be generated from .pdb input");
     if (state->output_format == FREESASA_PDB && state->cif == 1) abort_msg("PDB output can not be generated from .cif input.");
     if ((state->output_format == FREESASA_CIF || state->output_format == FREESASA_PDB) &&
@@ -724,15 +871,35 @@ parse_arg(int argc, char **argv, struct cli_state *state)
         state->structure_options & FREESASA_SEPARATE_MODELS)
         abort_msg("Cannot output a cif/pdb file with both --separate-chains and --separate-models set. Pick one.");
 
+    state_compile_selections(state);
+
     return optind;
 }
 
+/* CIF output is written for one input file at a time, so that its
+   document can be released, other formats are written in one tree */
+static void
+add_results(freesasa_node *tree,
+            freesasa_node *results,
+            struct cli_state *state,
+            int *ret)
+{
+    if (state->output_format & FREESASA_CIF) {
+        if (freesasa_export_tree_to_cif(state->output, results) == FREESASA_FAIL) {
+            *ret = FREESASA_FAIL;
+        }
+        freesasa_node_free(results);
+    } else {
+        freesasa_tree_join(tree, &results);
+    }
+}
+
 int main(int argc,
          char **argv)
 {
     struct cli_state state;
     FILE *input = NULL;
-    int optind = 0, i, ret;
+    int optind = 0, i, ret = FREESASA_SUCCESS;
 
     freesasa_node *tree = freesasa_tree_new(), *tmp;
     if (tree == NULL) abort_msg("error initializing calculation");
@@ -741,24 +908,38 @@ int main(int argc,
 
     optind = parse_arg(argc, argv, &state);
 
+    /* the classifier can be compiled without analyzing anything */
+    if (state.config_output) {
+        if (state.structure_options & FREESASA_RADIUS_FROM_OCCUPANCY) {
+            abort_msg("the options -O and --write-config can't be combined");
+        }
+        if (freesasa_classifier_write_binary(state.config_output,
+                                             state.classifier ? state.classifier : &freesasa_default_classifier) == FREESASA_FAIL) {
+            abort_msg("could not write binary classifier");
+        }
+        if (argc == optind) {
+            freesasa_node_free(tree);
+            release_state(&state);
+            return EXIT_SUCCESS;
+        }
+    }
+
     if (argc > optind) {
         for (i = optind; i < argc; ++i) {
             input = fopen_werr(argv[i], "r");
             tmp = run_analysis(input, argv[i], &state);
-            freesasa_tree_join(tree, &tmp);
+            add_results(tree, tmp, &state, &ret);
             fclose(input);
         }
     } else {
         if (!isatty(STDIN_FILENO)) {
             tmp = run_analysis(stdin, "stdin", &state);
-            freesasa_tree_join(tree, &tmp);
+            add_results(tree, tmp, &state, &ret);
         } else
             abort_msg("no input", program_name);
     }
 
-    if (state.output_format & FREESASA_CIF) {
-        ret = freesasa_export_tree_to_cif(state.output_filename, tree);
-    } else {
+    if (!(state.output_format & FREESASA_CIF)) {
         ret = freesasa_tree_export(state.output, tree, state.output_format | state.output_depth | (state.no_rel ? FREESASA_OUTPUT_SKIP_REL : 0));
     }
     freesasa_node_free(tree);
@@ -14,16 +14,18 @@
 
 typedef struct cell cell;
 struct cell {
-    cell *nb[17]; /** includes self, only forward neighbors */
-    int *atom;    /** indices of the atoms/coordinates in a cell */
-    int n_nb;     /** number of neighbors to cell */
-    int n_atoms;  /** number of atoms in cell */
+    cell *nb[17];  /** includes self, only forward neighbors */
+    int *atom;     /** indices of the atoms/coordinates in a cell, targets first */
+    int n_nb;      /** number of neighbors to cell */
+    int n_atoms;   /** number of atoms in cell */
+    int n_targets; /** number of targets in cell (all atoms if there is no target subset) */
 };
 
 static cell empty_cell = {{NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
                           NULL,
                           0,
+                          0,
                           0};
 
 /** cell lists, divide space into boxes */
@@ -35,9 +37,21 @@ typedef struct cell_list {
     double x_max, x_min;
     double y_max, y_min;
     double z_max, z_min;
+    const double *box; /** periodic box vectors, NULL if not periodic */
+    double *s;         /** fractional coordinates in the box, wrapped to [0,1) */
 } cell_list;
 
-static struct cell_list empty_cell_list = {NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static struct cell_list empty_cell_list = {NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, NULL, NULL};
+
+static inline void
+cross(const double *a,
+      const double *b,
+      double *c)
+{
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
 
 /** Finds the bounds of the cell list and writes them to the provided cell list */
 static void
@@ -71,6 +85,72 @@ cell_list_bounds(cell_list *c,
     c->n = c->nx * c->ny * c->nz;
 }
 
+/**
+    Sets up the cells of a periodic cell list and calculates the
+    fractional coordinates of all atoms.
+
+    The cells are parallel to the box faces, and the number of cells
+    along each box vector is chosen so that the distance between
+    opposite cell faces is at least the cell size. Requires at least
+    three cells along each box vector, so that the neighbors of a cell
+    are all different cells and a contact can only involve one image
+    of each atom.
+ */
+static int
+cell_list_bounds_periodic(cell_list *c,
+                          const coord_t *coord,
+                          const double *box)
+{
+    const int n = freesasa_coord_n(coord);
+    const double *a = box, *b = box + 3, *cv = box + 6;
+    const double *v;
+    double bc[3], ca[3], ab[3], vol, w[3];
+    int i, k, nk[3];
+
+    cross(b, cv, bc);
+    cross(cv, a, ca);
+    cross(a, b, ab);
+    vol = a[0] * bc[0] + a[1] * bc[1] + a[2] * bc[2];
+
+    if (fabs(vol) < 1e-10) return fail_msg("periodic box has zero volume");
+
+    /* distances between opposite faces */
+    w[0] = fabs(vol) / sqrt(bc[0] * bc[0] + bc[1] * bc[1] + bc[2] * bc[2]);
+    w[1] = fabs(vol) / sqrt(ca[0] * ca[0] + ca[1] * ca[1] + ca[2] * ca[2]);
+    w[2] = fabs(vol) / sqrt(ab[0] * ab[0] + ab[1] * ab[1] + ab[2] * ab[2]);
+
+    for (k = 0; k < 3; ++k) {
+        nk[k] = (int)floor(w[k] / c->d);
+        if (nk[k] < 3) {
+            return fail_msg("periodic box too small, the distance between opposite faces "
+                            "(%.2f Å) must be at least 3 times the largest atom diameter "
+                            "including probe (%.2f Å)",
+                            w[k], c->d);
+        }
+    }
+
+    c->s = malloc(sizeof(double) * 3 * n);
+    if (c->s == NULL) return mem_fail();
+
+    for (i = 0; i < n; ++i) {
+        v = freesasa_coord_i(coord, i);
+        c->s[3 * i] = (v[0] * bc[0] + v[1] * bc[1] + v[2] * bc[2]) / vol;
+        c->s[3 * i + 1] = (v[0] * ca[0] + v[1] * ca[1] + v[2] * ca[2]) / vol;
+        c->s[3 * i + 2] = (v[0] * ab[0] + v[1] * ab[1] + v[2] * ab[2]) / vol;
+        for (k = 0; k < 3; ++k) {
+            c->s[3 * i + k] -= floor(c->s[3 * i + k]);
+        }
+    }
+
+    c->box = box;
+    c->nx = nk[0];
+    c->ny = nk[1];
+    c->nz = nk[2];
+    c->n = c->nx * c->ny * c->nz;
+
+    return FREESASA_SUCCESS;
+}
+
 static inline int
 cell_index(const cell_list *c,
            int ix,
@@ -114,6 +194,32 @@ fill_nb(cell_list *c,
     assert(n > 0);
 }
 
+/** Like fill_nb(), but neighbors wrap around the box faces */
+static void
+fill_nb_periodic(cell_list *c,
+                 int ix,
+                 int iy,
+                 int iz)
+{
+    cell *cell = &c->cell[cell_index(c, ix, iy, iz)];
+    int n = 0, i, j, k;
+
+    for (i = -1; i <= 1; ++i) {
+        for (j = -1; j <= 1; ++j) {
+            for (k = -1; k <= 1; ++k) {
+                if (i + j + k >= 0) {
+                    cell->nb[n] = &c->cell[cell_index(c,
+                                                      (ix + i + c->nx) % c->nx,
+                                                      (iy + j + c->ny) % c->ny,
+                                                      (iz + k + c->nz) % c->nz)];
+                    ++n;
+                }
+            }
+        }
+    }
+    cell->n_nb = n;
+}
+
 /** find neighbors to all cells */
 static void
 get_nb(cell_list *c)
@@ -123,7 +229,10 @@ get_nb(cell_list *c)
     for (ix = 0; ix < c->nx; ++ix) {
         for (iy = 0; iy < c->ny; ++iy) {
             for (iz = 0; iz < c->nz; ++iz) {
-                fill_nb(c, ix, iy, iz);
+                if (c->box)
+                    fill_nb_periodic(c, ix, iy, iz);
+                else
+                    fill_nb(c, ix, iy, iz);
             }
         }
     }
@@ -135,22 +244,37 @@ coord2cell_index(const cell_list *c,
                  const double *restrict xyz)
 {
     double d = c->d;
-    int ix = (int)((xyz[0] - c->x_min) / d);
-    int iy = (int)((xyz[1] - c->y_min) / d);
-    int iz = (int)((xyz[2] - c->z_min) / d);
+    int ix, iy, iz;
+
+    if (c->box) {
+        /* xyz are fractional coordinates in [0,1), round-off can give 1 */
+        ix = (int)(xyz[0] * c->nx);
+        iy = (int)(xyz[1] * c->ny);
+        iz = (int)(xyz[2] * c->nz);
+        return cell_index(c,
+                          ix < c->nx ? ix : c->nx - 1,
+                          iy < c->ny ? iy : c->ny - 1,
+                          iz < c->nz ? iz : c->nz - 1);
+    }
+
+    ix = (int)((xyz[0] - c->x_min) / d);
+    iy = (int)((xyz[1] - c->y_min) / d);
+    iz = (int)((xyz[2] - c->z_min) / d);
 
     return cell_index(c, ix, iy, iz);
 }
 
 /**
-   Assigns cells to each coordinate. Returns FREESASA_FAIL if realloc
-   fails, FREESASA_SUCCESS else.
+   Assigns cells to each coordinate. If target is not NULL, the
+   targets of each cell are placed first in its list of atoms. Returns
+   FREESASA_FAIL if realloc fails, FREESASA_SUCCESS else.
  */
 static int
 fill_cells(cell_list *c,
-           const coord_t *coord)
+           const coord_t *coord,
+           const int *target)
 {
-    int i;
+    int i, pass, first_pass = target ? 0 : 1;
     cell *cell;
     int *a;
     const double *restrict v;
@@ -159,17 +283,32 @@ fill_cells(cell_list *c,
         c->cell[i].n_atoms = 0;
     }
 
-    for (i = 0; i < freesasa_coord_n(coord); ++i) {
-        v = freesasa_coord_i(coord, i);
-        cell = &c->cell[coord2cell_index(c, v)];
-        ++cell->n_atoms;
-        a = cell->atom;
-        cell->atom = realloc(cell->atom, sizeof(int) * cell->n_atoms);
-        if (!cell->atom) {
-            cell->atom = a;
-            return mem_fail();
+    /* with targets, the first pass adds the targets and the second
+       the rest, so that the order within each group is kept */
+    for (pass = first_pass; pass < 2; ++pass) {
+        for (i = 0; i < freesasa_coord_n(coord); ++i) {
+            if (target && (pass == 0) != (target[i] != 0)) continue;
+            v = c->box ? c->s + 3 * i : freesasa_coord_i(coord, i);
+            cell = &c->cell[coord2cell_index(c, v)];
+            ++cell->n_atoms;
+            a = cell->atom;
+            cell->atom = realloc(cell->atom, sizeof(int) * cell->n_atoms);
+            if (!cell->atom) {
+                cell->atom = a;
+                return mem_fail();
+            }
+            cell->atom[cell->n_atoms - 1] = i;
+        }
+        if (pass == 0) {
+            for (i = 0; i < c->n; ++i) {
+                c->cell[i].n_targets = c->cell[i].n_atoms;
+            }
+        }
+    }
+    if (target == NULL) {
+        for (i = 0; i < c->n; ++i) {
+            c->cell[i].n_targets = c->cell[i].n_atoms;
         }
-        cell->atom[cell->n_atoms - 1] = i;
     }
     return FREESASA_SUCCESS;
 }
@@ -186,20 +325,25 @@ cell_list_free(cell_list *c)
                 free(c->cell[i].atom);
         }
         free(c->cell);
+        free(c->s);
         free(c);
     }
 }
 
 /**
     Creates a cell list with provided cell-size assigning cells to
-    each of the provided coordinates. The created cell list should be
+    each of the provided coordinates. If box is not NULL the cells
+    fill the periodic box. If target is not NULL, the targets of each
+    cell are counted and listed first. The created cell list should be
     freed using cell_list_free().
 
-    Returns NULL if there are malloc fails.
+    Returns NULL if there are malloc fails or the box is invalid.
  */
 static cell_list *
 cell_list_new(double cell_size,
-              const coord_t *coord)
+              const coord_t *coord,
+              const double *box,
+              const int *target)
 {
     int i;
     cell_list *c;
@@ -216,7 +360,14 @@ cell_list_new(double cell_size,
     *c = empty_cell_list;
 
     c->d = cell_size;
-    cell_list_bounds(c, coord);
+    if (box) {
+        if (cell_list_bounds_periodic(c, coord, box)) {
+            cell_list_free(c);
+            return NULL;
+        }
+    } else {
+        cell_list_bounds(c, coord);
+    }
 
     c->cell = malloc(sizeof(cell) * c->n);
     if (!c->cell) {
@@ -228,7 +379,7 @@ cell_list_new(double cell_size,
     for (i = 0; i < c->n; ++i)
         c->cell[i] = empty_cell;
 
-    if (fill_cells(c, coord)) {
+    if (fill_cells(c, coord, target)) {
         cell_list_free(c);
         mem_fail();
         return NULL;
@@ -255,10 +406,13 @@ max_array(const double *a,
 
 /**
     Allocate memory for ::nb_list object. Tries to free everything
-    and returns NULL if malloc somewhere along the way.
+    and returns NULL if malloc somewhere along the way. If target is
+    not NULL, only the lists of atoms with target[i] != 0 are
+    allocated.
  */
 static nb_list *
-freesasa_nb_alloc(int n)
+freesasa_nb_alloc(int n,
+                  const int *target)
 {
     int i;
     nb_list *nb;
@@ -277,22 +431,24 @@ freesasa_nb_alloc(int n)
     nb->nn = NULL;
     nb->nb = NULL;
     nb->capacity = NULL;
-    nb->xyd = nb->xd = nb->yd = NULL;
+    nb->xyd = nb->xd = nb->yd = nb->zd = NULL;
 
     nb->nn = malloc(sizeof(int) * n);
     nb->nb = malloc(sizeof(int *) * n);
     nb->xyd = malloc(sizeof(double *) * n);
     nb->xd = malloc(sizeof(double *) * n);
     nb->yd = malloc(sizeof(double *) * n);
+    nb->zd = malloc(sizeof(double *) * n);
     nb->capacity = malloc(sizeof(int) * n);
 
     if (!nb->nn || !nb->nb || !nb->xyd ||
-        !nb->xd || !nb->yd || !nb->capacity) {
+        !nb->xd || !nb->yd || !nb->zd || !nb->capacity) {
         free(nb->nn);
         free(nb->nb);
         free(nb->xyd);
         free(nb->xd);
         free(nb->yd);
+        free(nb->zd);
         free(nb->capacity);
         free(nb);
         mem_fail();
@@ -301,17 +457,19 @@ freesasa_nb_alloc(int n)
 
     for (i = 0; i < n; ++i) {
         nb->nn[i] = 0;
-        nb->capacity[i] = FREESASA_NB_CHUNK;
+        nb->capacity[i] = (target == NULL || target[i]) ? FREESASA_NB_CHUNK : 0;
         /* again prepare for a potential cleanup */
         nb->nb[i] = NULL;
-        nb->xyd[i] = nb->xd[i] = nb->yd[i] = NULL;
+        nb->xyd[i] = nb->xd[i] = nb->yd[i] = nb->zd[i] = NULL;
     }
     for (i = 0; i < n; ++i) {
+        if (nb->capacity[i] == 0) continue;
         nb->nb[i] = malloc(sizeof(int) * FREESASA_NB_CHUNK);
         nb->xyd[i] = malloc(sizeof(double) * FREESASA_NB_CHUNK);
         nb->xd[i] = malloc(sizeof(double) * FREESASA_NB_CHUNK);
         nb->yd[i] = malloc(sizeof(double) * FREESASA_NB_CHUNK);
-        if (!nb->nb[i] || !nb->xyd[i] || !nb->xd[i] || !nb->yd[i]) {
+        nb->zd[i] = malloc(sizeof(double) * FREESASA_NB_CHUNK);
+        if (!nb->nb[i] || !nb->xyd[i] || !nb->xd[i] || !nb->yd[i] || !nb->zd[i]) {
             freesasa_nb_free(nb);
             mem_fail();
             return NULL;
@@ -338,12 +496,16 @@ void freesasa_nb_free(nb_list *nb)
         if (nb->yd)
             for (i = 0; i < n; ++i)
                 free(nb->yd[i]);
+        if (nb->zd)
+            for (i = 0; i < n; ++i)
+                free(nb->zd[i]);
         free(nb->nb);
         free(nb->nn);
         free(nb->capacity);
         free(nb->xyd);
         free(nb->xd);
         free(nb->yd);
+        free(nb->zd);
         free(nb);
     }
 }
@@ -358,7 +520,7 @@ chunk_up(nb_list *nb_list,
 {
     int nni = nb_list->nn[i];
     int **nbi, *nbi_b, new_cap;
-    double **xydi, **xdi, **ydi, *xydi_b, *xdi_b, *ydi_b;
+    double **xydi, **xdi, **ydi, **zdi, *xydi_b, *xdi_b, *ydi_b, *zdi_b;
 
     if (nni > nb_list->capacity[i]) {
         nbi = &nb_list->nb[i];
@@ -366,9 +528,11 @@ chunk_up(nb_list *nb_list,
         xydi = &nb_list->xyd[i];
         xdi = &nb_list->xd[i];
         ydi = &nb_list->yd[i];
+        zdi = &nb_list->zd[i];
         xydi_b = *xydi;
         xdi_b = *xdi;
         ydi_b = *ydi;
+        zdi_b = *zdi;
         new_cap = (nb_list->capacity[i] += FREESASA_NB_CHUNK);
 
         *nbi = realloc(*nbi, sizeof(int) * new_cap);
@@ -394,6 +558,12 @@ chunk_up(nb_list *nb_list,
             nb_list->yd[i] = ydi_b;
             return mem_fail();
         }
+
+        *zdi = realloc(*zdi, sizeof(double) * new_cap);
+        if (*zdi == NULL) {
+            nb_list->zd[i] = zdi_b;
+            return mem_fail();
+        }
     }
     return FREESASA_SUCCESS;
 }
@@ -401,17 +571,20 @@ chunk_up(nb_list *nb_list,
 /**
     Assumes the coordinates i and j have been determined to be
     neighbors and adds them both to the provided nb lists,
-    symmetrically.
+    symmetrically. If target is not NULL, the pair is only added to
+    the lists of targets.
 
     Returns FREESASA_FAIL if can't allocate memory. FREESASA_SUCCESS
     else.
 */
 static int
 nb_add_pair(nb_list *nb_list,
+            const int *target,
             int i,
             int j,
             double dx,
-            double dy)
+            double dy,
+            double dz)
 {
     int **nb;
     int *nn = nb_list->nn;
@@ -419,66 +592,76 @@ nb_add_pair(nb_list *nb_list,
     double **xyd;
     double **xd;
     double **yd;
+    double **zd;
     double d;
 
     assert(i != j);
 
-    nni = nn[i]++;
-    nnj = nn[j]++;
-
-    if (chunk_up(nb_list, i)) return mem_fail();
-    if (chunk_up(nb_list, j)) return mem_fail();
-
     nb = nb_list->nb;
     xyd = nb_list->xyd;
     xd = nb_list->xd;
     yd = nb_list->yd;
-
-    nb[i][nni] = j;
-    nb[j][nnj] = i;
+    zd = nb_list->zd;
 
     d = sqrt(dx * dx + dy * dy);
 
-    xyd[i][nni] = d;
-    xyd[j][nnj] = d;
+    if (target == NULL || target[i]) {
+        nni = nn[i]++;
+        if (chunk_up(nb_list, i)) return mem_fail();
+        nb[i][nni] = j;
+        xyd[i][nni] = d;
+        xd[i][nni] = dx;
+        yd[i][nni] = dy;
+        zd[i][nni] = dz;
+    }
 
-    xd[i][nni] = dx;
-    xd[j][nnj] = -dx;
-    yd[i][nni] = dy;
-    yd[j][nnj] = -dy;
+    if (target == NULL || target[j]) {
+        nnj = nn[j]++;
+        if (chunk_up(nb_list, j)) return mem_fail();
+        nb[j][nnj] = i;
+        xyd[j][nnj] = d;
+        xd[j][nnj] = -dx;
+        yd[j][nnj] = -dy;
+        zd[j][nnj] = -dz;
+    }
 
     return FREESASA_SUCCESS;
 }
 
 /**
-    Fills the nb list for all contacts between coordinates
-    belonging to the cells ci and cj. Handles the case ci == cj
-    correctly.
+    Fills the nb list for all contacts between the atoms i_begin to
+    i_end - 1 of the cell ci and j_begin to j_end - 1 of the cell
+    cj. Handles the case ci == cj correctly.
 */
 static int
-nb_calc_cell_pair(nb_list *nb_list,
-                  const coord_t *coord,
-                  const double *radii,
-                  const cell *ci,
-                  const cell *cj)
+nb_calc_cell_block(nb_list *nb_list,
+                   const coord_t *coord,
+                   const double *radii,
+                   const int *target,
+                   const cell *ci,
+                   int i_begin,
+                   int i_end,
+                   const cell *cj,
+                   int j_begin,
+                   int j_end)
 {
     const double *restrict v = freesasa_coord_all(coord);
     double ri, rj, xi, yi, zi, xj, yj, zj,
         dx, dy, dz, cut2;
     int i, j, ia, ja;
 
-    for (i = 0; i < ci->n_atoms; ++i) {
+    for (i = i_begin; i < i_end; ++i) {
         ia = ci->atom[i];
         ri = radii[ia];
         xi = v[ia * 3];
         yi = v[ia * 3 + 1];
         zi = v[ia * 3 + 2];
-        if (ci == cj)
+        if (ci == cj && j_begin <= i)
             j = i + 1;
         else
-            j = 0;
+            j = j_begin;
         /** the following loop is performance critical */
-        for (; j < cj->n_atoms; ++j) {
+        for (; j < j_end; ++j) {
             ja = cj->atom[j];
             rj = radii[ja];
             xj = v[ja * 3];
@@ -489,7 +672,58 @@ nb_calc_cell_pair(nb_list *nb_list,
             dy = yj - yi;
             dz = zj - zi;
             if (dx * dx + dy * dy + dz * dz < cut2) {
-                if (nb_add_pair(nb_list, ia, ja, dx, dy))
+                if (nb_add_pair(nb_list, target, ia, ja, dx, dy, dz))
+                    return mem_fail();
+            }
+        }
+    }
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Like nb_calc_cell_block(), but for periodic cell lists. The
+    distance vectors are calculated from the fractional coordinates
+    using the minimum image convention.
+*/
+static int
+nb_calc_cell_block_periodic(nb_list *nb_list,
+                            const cell_list *c,
+                            const double *radii,
+                            const int *target,
+                            const cell *ci,
+                            int i_begin,
+                            int i_end,
+                            const cell *cj,
+                            int j_begin,
+                            int j_end)
+{
+    const double *restrict s = c->s;
+    const double *restrict box = c->box;
+    double ri, rj, sa, sb, sc, dx, dy, dz, cut2;
+    int i, j, ia, ja;
+
+    for (i = i_begin; i < i_end; ++i) {
+        ia = ci->atom[i];
+        ri = radii[ia];
+        if (ci == cj && j_begin <= i)
+            j = i + 1;
+        else
+            j = j_begin;
+        for (; j < j_end; ++j) {
+            ja = cj->atom[j];
+            rj = radii[ja];
+            cut2 = (ri + rj) * (ri + rj);
+            sa = s[ja * 3] - s[ia * 3];
+            sb = s[ja * 3 + 1] - s[ia * 3 + 1];
+            sc = s[ja * 3 + 2] - s[ia * 3 + 2];
+            sa -= round(sa);
+            sb -= round(sb);
+            sc -= round(sc);
+            dx = sa * box[0] + sb * box[3] + sc * box[6];
+            dy = sa * box[1] + sb * box[4] + sc * box[7];
+            dz = sa * box[2] + sb * box[5] + sc * box[8];
+            if (dx * dx + dy * dy + dz * dz < cut2) {
+                if (nb_add_pair(nb_list, target, ia, ja, dx, dy, dz))
                     return mem_fail();
             }
         }
@@ -497,6 +731,45 @@ nb_calc_cell_pair(nb_list *nb_list,
     return FREESASA_SUCCESS;
 }
 
+/**
+    Fills the nb list for all contacts between coordinates belonging
+    to the cells ci and cj that involve at least one target. The
+    targets are first in each cell, so the pairs are the targets of
+    ci with all atoms of cj, and the other atoms of ci with the
+    targets of cj. Without a target subset all atoms are targets.
+*/
+static int
+nb_calc_cell_pair(nb_list *nb_list,
+                  const cell_list *c,
+                  const coord_t *coord,
+                  const double *radii,
+                  const int *target,
+                  const cell *ci,
+                  const cell *cj)
+{
+    if (ci->n_targets == 0 && cj->n_targets == 0) return FREESASA_SUCCESS;
+
+    if (c->box) {
+        if (nb_calc_cell_block_periodic(nb_list, c, radii, target,
+                                        ci, 0, ci->n_targets, cj, 0, cj->n_atoms))
+            return mem_fail();
+        /* in the same cell these pairs have been covered already */
+        if (ci != cj &&
+            nb_calc_cell_block_periodic(nb_list, c, radii, target,
+                                        ci, ci->n_targets, ci->n_atoms, cj, 0, cj->n_targets))
+            return mem_fail();
+    } else {
+        if (nb_calc_cell_block(nb_list, coord, radii, target,
+                               ci, 0, ci->n_targets, cj, 0, cj->n_atoms))
+            return mem_fail();
+        if (ci != cj &&
+            nb_calc_cell_block(nb_list, coord, radii, target,
+                               ci, ci->n_targets, ci->n_atoms, cj, 0, cj->n_targets))
+            return mem_fail();
+    }
+    return FREESASA_SUCCESS;
+}
+
 /**
     Iterates through the cells and records all contacts in the
     provided nb list
@@ -505,7 +778,8 @@ static int
 nb_fill_list(nb_list *nb_list,
              cell_list *c,
              const coord_t *coord,
-             const double *radii)
+             const double *radii,
+             const int *target)
 {
     int nc = c->n, ic, jc;
     cell *ci, *cj;
@@ -514,7 +788,7 @@ nb_fill_list(nb_list *nb_list,
         ci = &c->cell[ic];
         for (jc = 0; jc < ci->n_nb; ++jc) {
             cj = ci->nb[jc];
-            if (nb_calc_cell_pair(nb_list, coord, radii, ci, cj))
+            if (nb_calc_cell_pair(nb_list, c, coord, radii, target, ci, cj))
                 return mem_fail();
         }
     }
@@ -524,6 +798,15 @@ nb_fill_list(nb_list *nb_list,
 nb_list *
 freesasa_nb_new(const coord_t *coord,
                 const double *radii)
+{
+    return freesasa_nb_new_subset(coord, radii, NULL, NULL);
+}
+
+nb_list *
+freesasa_nb_new_subset(const coord_t *coord,
+                       const double *radii,
+                       const int *target,
+                       const double *box)
 {
     double cell_size;
     cell_list *c;
@@ -533,7 +816,7 @@ freesasa_nb_new(const coord_t *coord,
     if (coord == NULL || radii == NULL) return NULL;
 
     n = freesasa_coord_n(coord);
-    nb = freesasa_nb_alloc(n);
+    nb = freesasa_nb_alloc(n, target);
 
     if (!nb) {
         mem_fail();
@@ -542,10 +825,10 @@ freesasa_nb_new(const coord_t *coord,
 
     cell_size = 2 * max_array(radii, n);
     assert(cell_size > 0);
-    c = cell_list_new(cell_size, coord);
+    c = cell_list_new(cell_size, coord, box, target);
     if (c == NULL ||
-        nb_fill_list(nb, c, coord, radii)) {
-        mem_fail();
+        nb_fill_list(nb, c, coord, radii, target)) {
+        fail_msg("");
         freesasa_nb_free(nb);
         nb = NULL;
     }
@@ -556,6 +839,45 @@ freesasa_nb_new(const coord_t *coord,
     return nb;
 }
 
+nb_list *
+freesasa_nb_filter(const nb_list *nb,
+                   const double *radii)
+{
+    nb_list *filtered;
+    double dx, dy, dz, cut;
+    int i, j, k;
+
+    assert(nb != NULL);
+    assert(radii != NULL);
+
+    filtered = freesasa_nb_alloc(nb->n, NULL);
+    if (filtered == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    for (i = 0; i < nb->n; ++i) {
+        for (k = 0; k < nb->nn[i]; ++k) {
+            j = nb->nb[i][k];
+            /* each pair is stored twice, only add it once */
+            if (j < i) continue;
+            dx = nb->xd[i][k];
+            dy = nb->yd[i][k];
+            dz = nb->zd[i][k];
+            cut = radii[i] + radii[j];
+            if (dx * dx + dy * dy + dz * dz < cut * cut) {
+                if (nb_add_pair(filtered, NULL, i, j, dx, dy, dz)) {
+                    mem_fail();
+                    freesasa_nb_free(filtered);
+                    return NULL;
+                }
+            }
+        }
+    }
+
+    return filtered;
+}
+
 int freesasa_nb_contact(const nb_list *nb,
                         int i,
                         int j)
@@ -590,7 +912,7 @@ START_TEST(test_cell)
     freesasa_coord_append(coord, v, n_atoms);
     r_max = max_array(r, n_atoms);
     ck_assert(fabs(r_max - 4) < 1e-10);
-    c = cell_list_new(r_max, coord);
+    c = cell_list_new(r_max, coord, NULL, NULL);
     ck_assert(c != NULL);
     ck_assert(c->cell != NULL);
     ck_assert(fabs(c->d - r_max) < 1e-10);
@@ -23,6 +23,7 @@ typedef struct {
     double **xyd;  /**< distance between neighbors in xy-plane */
     double **xd;   /**< signed distance between neighbors along x-axis */
     double **yd;   /**< signed distance between neighbors along y-axis */
+    double **zd;   /**< signed distance between neighbors along z-axis */
     int *capacity; /**< keeps track of memory chunks (don't change this) */
 } nb_list;
 
@@ -45,6 +46,55 @@ nb_list *
 freesasa_nb_new(const coord_t *coord,
                 const double *radii);
 
+/**
+    Creates a neighbor list where only the neighbors of a subset of
+    the coordinates are stored, optionally in a periodic box.
+
+    All coordinates are considered as neighbors of the targets, but
+    the neighbor lists of the other coordinates are left empty.
+
+    If a periodic box is given, contacts are found across the box
+    faces and the distances `xd`, `yd`, `zd` and `xyd` are those of
+    the nearest periodic image. Coordinates of neighbors should then
+    be calculated from these, not from the coordinate array.
+
+    @param coord a set of coordinates
+    @param radii radii for the coordinates
+    @param target array with one element per coordinate, nonzero for
+      the coordinates whose neighbors should be stored. If NULL, all
+      neighbor lists are stored.
+    @param box the three box vectors a, b, c, stored consecutively,
+      or NULL if the system is not periodic. The box has to be at
+      least three times the largest diameter wide in each direction.
+    @return a neigbor list. Returns NULL if either of the first two
+      arguments is null or if there were any problems constructing the
+      list (see error messages).
+ */
+nb_list *
+freesasa_nb_new_subset(const coord_t *coord,
+                       const double *radii,
+                       const int *target,
+                       const double *box);
+
+/**
+    Creates a new neighbor list from an existing one, keeping only the
+    pairs that are in contact with a new set of radii.
+
+    Intended for calculations with several probe radii, where the
+    list is built once for the largest radii and then filtered for
+    the smaller ones. The new radii should not be larger than the
+    ones used to create the original list, and the original list
+    should not be restricted to a subset.
+
+    @param nb The neighbor list to filter
+    @param radii The new radii
+    @return a neigbor list. Returns NULL if there were problems
+      allocating memory.
+ */
+nb_list *
+freesasa_nb_filter(const nb_list *nb,
+                   const double *radii);
+
 /**
     Frees a neigbor list created by freesasa_nb_new().
 
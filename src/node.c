@@ -3,6 +3,7 @@
 #endif
 
 #include <assert.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -44,6 +45,11 @@ struct result_properties {
     int n_structures;
 };
 
+struct root_properties {
+    freesasa_arena *arena; /* all nodes of the tree are allocated here */
+    int owns_arena;
+};
+
 struct freesasa_node {
     char *name;
     freesasa_nodetype type;
@@ -53,6 +59,7 @@ struct freesasa_node {
         struct chain_properties chain;
         struct structure_properties structure;
         struct result_properties result;
+        struct root_properties root;
     } properties;
     freesasa_nodearea *area;
     freesasa_node *parent;
@@ -63,12 +70,14 @@ struct freesasa_node {
 const freesasa_nodearea freesasa_nodearea_null = {NULL, 0, 0, 0, 0, 0, 0};
 
 static freesasa_node *
-node_new(const char *name)
+node_new(freesasa_arena *arena,
+         const char *name)
 {
-    freesasa_node *node = malloc(sizeof(freesasa_node));
+    freesasa_node *node = freesasa_arena_alloc(arena, sizeof(freesasa_node));
 
     if (node == NULL) {
-        goto memerr;
+        fail_msg("");
+        return NULL;
     }
 
     node->name = NULL;
@@ -79,48 +88,32 @@ node_new(const char *name)
     node->next = NULL;
 
     if (name) {
-        node->name = strdup(name);
+        node->name = freesasa_arena_strdup(arena, name);
         if (node->name == NULL) {
-            goto memerr;
+            fail_msg("");
+            return NULL;
         }
     }
     return node;
-
-memerr:
-    free(node);
-    mem_fail();
-    return NULL;
 }
 
+/* The nodes are released with the arena of the tree, only the
+   selections of the structures are allocated separately. */
 static void
 node_free(freesasa_node *node)
 {
-    freesasa_node *current = NULL, *next = NULL;
+    freesasa_node *current = NULL;
     freesasa_selection **sel = NULL;
 
     if (node != NULL) {
-        current = node->children;
-        while (current) {
-            next = current->next;
-            node_free(current);
-            current = next;
-        }
-        free(node->name);
-        free(node->area);
-
         switch (node->type) {
-        case FREESASA_NODE_ATOM:
-            free(node->properties.atom.pdb_line);
-            free(node->properties.atom.res_name);
-            free(node->properties.atom.res_number);
-            break;
-        case FREESASA_NODE_RESIDUE:
-            free(node->properties.residue.reference);
-            free(node->properties.residue.number);
+        case FREESASA_NODE_ROOT:
+        case FREESASA_NODE_RESULT:
+            for (current = node->children; current; current = current->next) {
+                node_free(current);
+            }
             break;
         case FREESASA_NODE_STRUCTURE:
-            free(node->properties.structure.chain_labels);
-            freesasa_result_free(node->properties.structure.result);
             sel = node->properties.structure.selection;
             if (sel) {
                 while (*sel) {
@@ -129,23 +122,22 @@ node_free(freesasa_node *node)
                 }
             }
             free(node->properties.structure.selection);
-            break;
-        case FREESASA_NODE_RESULT:
-            free(node->properties.result.classified_by);
+            node->properties.structure.selection = NULL;
             break;
         default:
             break;
         }
-        free(node);
     }
 }
 
-typedef freesasa_node *(*node_generator)(const freesasa_structure *,
+typedef freesasa_node *(*node_generator)(freesasa_arena *,
+                                         const freesasa_structure *,
                                          const freesasa_result *,
                                          int index);
 
 static int
-node_add_area(freesasa_node *node,
+node_add_area(freesasa_arena *arena,
+              freesasa_node *node,
               const freesasa_structure *structure,
               const freesasa_result *result)
 {
@@ -155,9 +147,9 @@ node_add_area(freesasa_node *node,
         return FREESASA_SUCCESS;
     }
 
-    node->area = malloc(sizeof(freesasa_nodearea));
+    node->area = freesasa_arena_alloc(arena, sizeof(freesasa_nodearea));
     if (node->area == NULL) {
-        return mem_fail();
+        return fail_msg("");
     }
 
     *node->area = freesasa_nodearea_null;
@@ -173,7 +165,8 @@ node_add_area(freesasa_node *node,
 }
 
 static freesasa_node *
-node_gen_children(freesasa_node *parent,
+node_gen_children(freesasa_arena *arena,
+                  freesasa_node *parent,
                   const freesasa_structure *structure,
                   const freesasa_result *result,
                   int first,
@@ -183,7 +176,7 @@ node_gen_children(freesasa_node *parent,
     int i;
     freesasa_node *child, *first_child;
 
-    first_child = ng(structure, result, first);
+    first_child = ng(arena, structure, result, first);
 
     if (first_child == NULL) {
         fail_msg("");
@@ -194,7 +187,7 @@ node_gen_children(freesasa_node *parent,
     child = parent->children = first_child;
 
     for (i = first + 1; i <= last; ++i) {
-        child->next = ng(structure, result, i);
+        child->next = ng(arena, structure, result, i);
         if (child->next == NULL) {
             fail_msg("");
             return NULL;
@@ -204,19 +197,24 @@ node_gen_children(freesasa_node *parent,
     }
     child->next = NULL;
 
-    node_add_area(parent, structure, result);
+    if (node_add_area(arena, parent, structure, result)) {
+        fail_msg("");
+        return NULL;
+    }
 
     return first_child;
 }
 
 static freesasa_node *
-node_atom(const freesasa_structure *structure,
+node_atom(freesasa_arena *arena,
+          const freesasa_structure *structure,
           const freesasa_result *result,
           int atom_index)
 {
     freesasa_node *atom =
-        node_new(freesasa_structure_atom_name(structure, atom_index));
+        node_new(arena, freesasa_structure_atom_name(structure, atom_index));
     const char *line;
+    int line_length;
 
     if (atom == NULL) {
         fail_msg("");
@@ -225,52 +223,42 @@ node_atom(const freesasa_structure *structure,
 
     atom->type = FREESASA_NODE_ATOM;
     atom->properties.atom.pdb_line = NULL;
-    atom->properties.atom.res_number = NULL;
-    atom->properties.atom.res_name = NULL;
     atom->properties.atom.is_polar = freesasa_structure_atom_class(structure, atom_index) == FREESASA_ATOM_POLAR;
     atom->properties.atom.is_bb = freesasa_atom_is_backbone(atom->name);
     atom->properties.atom.radius = freesasa_structure_atom_radius(structure, atom_index);
     atom->properties.atom.chain = freesasa_structure_atom_chain(structure, atom_index);
 
-    atom->properties.atom.res_number = strdup(freesasa_structure_atom_res_number(structure, atom_index));
-    if (atom->properties.atom.res_number == NULL) {
-        mem_fail();
-        goto cleanup;
-    }
-
-    atom->properties.atom.res_name = strdup(freesasa_structure_atom_res_name(structure, atom_index));
-    if (atom->properties.atom.res_name == NULL) {
-        mem_fail();
-        goto cleanup;
+    atom->properties.atom.res_number = freesasa_arena_strdup(arena, freesasa_structure_atom_res_number(structure, atom_index));
+    atom->properties.atom.res_name = freesasa_arena_strdup(arena, freesasa_structure_atom_res_name(structure, atom_index));
+    if (atom->properties.atom.res_number == NULL || atom->properties.atom.res_name == NULL) {
+        fail_msg("");
+        return NULL;
     }
 
-    line = freesasa_structure_atom_pdb_line(structure, atom_index);
+    line = freesasa_structure_atom_pdb_line(structure, atom_index, &line_length);
     if (line != NULL) {
-        atom->properties.atom.pdb_line = strdup(line);
+        atom->properties.atom.pdb_line = freesasa_arena_strndup(arena, line, line_length);
         if (atom->properties.atom.pdb_line == NULL) {
-            mem_fail();
-            goto cleanup;
+            fail_msg("");
+            return NULL;
         }
     }
 
-    atom->area = malloc(sizeof(freesasa_nodearea));
+    atom->area = freesasa_arena_alloc(arena, sizeof(freesasa_nodearea));
     if (atom->area == NULL) {
-        mem_fail();
-        goto cleanup;
+        fail_msg("");
+        return NULL;
     }
 
     atom->area->name = atom->name;
     freesasa_atom_nodearea(atom->area, structure, result, atom_index);
 
     return atom;
-
-cleanup:
-    node_free(atom);
-    return NULL;
 }
 
 static freesasa_node *
-node_residue(const freesasa_structure *structure,
+node_residue(freesasa_arena *arena,
+             const freesasa_structure *structure,
              const freesasa_result *result,
              int residue_index)
 {
@@ -278,7 +266,7 @@ node_residue(const freesasa_structure *structure,
     const freesasa_nodearea *ref;
     int first, last;
 
-    residue = node_new(freesasa_structure_residue_name(structure, residue_index));
+    residue = node_new(arena, freesasa_structure_residue_name(structure, residue_index));
 
     if (residue == NULL) {
         fail_msg("");
@@ -291,37 +279,41 @@ node_residue(const freesasa_structure *structure,
     residue->properties.residue.n_atoms = last - first + 1;
     residue->properties.residue.reference = NULL;
 
-    residue->properties.residue.number = strdup(freesasa_structure_residue_number(structure, residue_index));
+    residue->properties.residue.number = freesasa_arena_strdup(arena, freesasa_structure_residue_number(structure, residue_index));
     if (residue->properties.residue.number == NULL) {
-        mem_fail();
-        goto cleanup;
+        fail_msg("");
+        return NULL;
     }
 
     ref = freesasa_structure_residue_reference(structure, residue_index);
     if (ref != NULL) {
-        residue->properties.residue.reference = malloc(sizeof(freesasa_nodearea));
+        residue->properties.residue.reference = freesasa_arena_alloc(arena, sizeof(freesasa_nodearea));
         if (residue->properties.residue.reference == NULL) {
-            mem_fail();
-            goto cleanup;
+            fail_msg("");
+            return NULL;
         }
-        // TODO copy name string too
         *residue->properties.residue.reference = *ref;
+        if (ref->name != NULL) {
+            residue->properties.residue.reference->name = freesasa_arena_strdup(arena, ref->name);
+            if (residue->properties.residue.reference->name == NULL) {
+                fail_msg("");
+                return NULL;
+            }
+        }
     }
 
-    if (node_gen_children(residue, structure, result, first,
+    if (node_gen_children(arena, residue, structure, result, first,
                           last, node_atom) == NULL) {
-        goto cleanup;
+        fail_msg("");
+        return NULL;
     }
 
     return residue;
-
-cleanup:
-    node_free(residue);
-    return NULL;
 }
 
 static freesasa_node *
-node_chain(const freesasa_structure *structure,
+node_chain(freesasa_arena *arena,
+           const freesasa_structure *structure,
            const freesasa_result *result,
            int chain_index)
 {
@@ -335,7 +327,7 @@ node_chain(const freesasa_structure *structure,
     freesasa_structure_chain_atoms(structure, chains[chain_index],
                                    &first_atom, &last_atom);
 
-    chain = node_new(name);
+    chain = node_new(arena, name);
     if (chain == NULL) {
         fail_msg("");
         return NULL;
@@ -346,24 +338,47 @@ node_chain(const freesasa_structure *structure,
                                       &first_residue, &last_residue);
     chain->properties.chain.n_residues = last_residue - first_residue + 1;
 
-    if (node_gen_children(chain, structure, result,
+    if (node_gen_children(arena, chain, structure, result,
                           first_residue, last_residue,
                           node_residue) == NULL) {
         fail_msg("");
-        node_free(chain);
         return NULL;
     }
 
     return chain;
 }
 
+/* copies the result into the arena */
+static freesasa_result *
+node_result_clone(freesasa_arena *arena,
+                  const freesasa_result *result)
+{
+    freesasa_result *clone = freesasa_arena_alloc(arena, sizeof(freesasa_result));
+
+    if (clone == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    *clone = *result;
+    clone->sasa = freesasa_arena_alloc(arena, sizeof(double) * (result->n_atoms + 1));
+    if (clone->sasa == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+    memcpy(clone->sasa, result->sasa, sizeof(double) * result->n_atoms);
+
+    return clone;
+}
+
 static freesasa_node *
-node_structure(const freesasa_structure *structure,
+node_structure(freesasa_arena *arena,
+               const freesasa_structure *structure,
                const freesasa_result *result,
                int dummy_index)
 {
     freesasa_node *node = NULL;
-    node = node_new(freesasa_structure_chain_labels(structure));
+    node = node_new(arena, freesasa_structure_chain_labels(structure));
 
     if (node == NULL) {
         fail_msg("");
@@ -375,52 +390,84 @@ node_structure(const freesasa_structure *structure,
     node->properties.structure.n_atoms = freesasa_structure_n(structure);
     node->properties.structure.result = NULL;
     node->properties.structure.selection = NULL;
-    node->properties.structure.chain_labels = strdup(freesasa_structure_chain_labels(structure));
+    node->properties.structure.chain_labels = freesasa_arena_strdup(arena, freesasa_structure_chain_labels(structure));
     node->properties.structure.model = freesasa_structure_model(structure);
 
     if (node->properties.structure.chain_labels == NULL) {
-        mem_fail();
-        goto cleanup;
+        fail_msg("");
+        return NULL;
     }
 
-    node->properties.structure.result = freesasa_result_clone(result);
+    node->properties.structure.result = node_result_clone(arena, result);
 
     if (node->properties.structure.result == NULL) {
         fail_msg("");
-        goto cleanup;
+        return NULL;
     }
 
-    if (node_gen_children(node, structure, result, 0,
+    if (node_gen_children(arena, node, structure, result, 0,
                           freesasa_structure_n_chains(structure) - 1,
                           node_chain) == NULL) {
         fail_msg("");
-        goto cleanup;
+        return NULL;
     }
 
     return node;
-cleanup:
-    node_free(node);
-    return NULL;
+}
+
+/* Creates a root node in the arena, that is released with the tree if
+   the tree owns it */
+static freesasa_node *
+tree_new(freesasa_arena *arena,
+         int owns_arena)
+{
+    freesasa_node *tree = node_new(arena, NULL);
+
+    if (tree == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    tree->type = FREESASA_NODE_ROOT;
+    tree->properties.root.arena = arena;
+    tree->properties.root.owns_arena = owns_arena;
+
+    return tree;
 }
 
 freesasa_node *
 freesasa_tree_new(void)
 {
-    freesasa_node *tree = node_new(NULL);
-    if (tree != NULL) {
-        tree->type = FREESASA_NODE_ROOT;
+    freesasa_arena *arena = freesasa_arena_new();
+    freesasa_node *tree;
+
+    if (arena == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    tree = tree_new(arena, 1);
+    if (tree == NULL) {
+        freesasa_arena_free(arena);
     }
+
     return tree;
 }
 
+freesasa_node *
+freesasa_tree_new_arena(freesasa_arena *arena)
+{
+    assert(arena);
+
+    return tree_new(arena, 0);
+}
+
 freesasa_node *
 freesasa_tree_init(const freesasa_result *result,
                    const freesasa_structure *structure,
                    const char *name)
 {
-    freesasa_node *tree = node_new(NULL);
-
-    tree->type = FREESASA_NODE_ROOT;
+    freesasa_node *tree = freesasa_tree_new();
 
     if (tree == NULL) {
         fail_msg("");
@@ -438,7 +485,16 @@ int freesasa_tree_add_result(freesasa_node *tree,
                              const freesasa_structure *structure,
                              const char *name)
 {
-    freesasa_node *node = node_new(name);
+    freesasa_arena *arena;
+    freesasa_node *node;
+
+    assert(tree);
+    assert(tree->type == FREESASA_NODE_ROOT);
+
+    /* on failure the nodes that were created are left unused in the
+       arena, until the tree is freed */
+    arena = tree->properties.root.arena;
+    node = node_new(arena, name);
 
     if (node == NULL) {
         goto cleanup;
@@ -447,14 +503,13 @@ int freesasa_tree_add_result(freesasa_node *tree,
     node->type = FREESASA_NODE_RESULT;
     node->properties.result.n_structures = 1;
     node->properties.result.parameters = result->parameters;
-    node->properties.result.classified_by = strdup(freesasa_structure_classifier_name(structure));
+    node->properties.result.classified_by = freesasa_arena_strdup(arena, freesasa_structure_classifier_name(structure));
 
     if (node->properties.result.classified_by == NULL) {
-        mem_fail();
         goto cleanup;
     }
 
-    if (node_gen_children(node, structure, result, 0, 0,
+    if (node_gen_children(arena, node, structure, result, 0, 0,
                           node_structure) == NULL) {
         goto cleanup;
     }
@@ -465,9 +520,7 @@ int freesasa_tree_add_result(freesasa_node *tree,
     return FREESASA_SUCCESS;
 
 cleanup:
-    node_free(node);
-    fail_msg("");
-    return FREESASA_FAIL;
+    return fail_msg("");
 }
 
 int freesasa_tree_join(freesasa_node *tree1,
@@ -491,7 +544,11 @@ int freesasa_tree_join(freesasa_node *tree1,
         tree1->children = (*tree2)->children;
     }
     // tree1 takes over ownership, tree2 is invalidated.
-    free(*tree2);
+    if ((*tree2)->properties.root.owns_arena &&
+        (*tree2)->properties.root.arena != tree1->properties.root.arena) {
+        freesasa_arena_adopt(tree1->properties.root.arena,
+                             (*tree2)->properties.root.arena);
+    }
     *tree2 = NULL;
 
     return FREESASA_SUCCESS;
@@ -502,7 +559,12 @@ int freesasa_node_free(freesasa_node *root)
     if (root) {
         if (root->parent)
             return fail_msg("can't free node that isn't the root of its tree");
+        if (root->type != FREESASA_NODE_ROOT)
+            return fail_msg("can only free nodes of type FREESASA_NODE_ROOT");
         node_free(root);
+        if (root->properties.root.owns_arena) {
+            freesasa_arena_free(root->properties.root.arena);
+        }
     }
     return FREESASA_SUCCESS;
 }
@@ -736,6 +798,14 @@ int freesasa_atom_nodearea(freesasa_nodearea *area,
 void freesasa_add_nodearea(freesasa_nodearea *sum,
                            const freesasa_nodearea *term)
 {
+    /* atoms that weren't calculated have area NaN, and so does
+       everything that includes them */
+    if (isnan(term->total)) {
+        sum->total = sum->side_chain = sum->main_chain = NAN;
+        sum->polar = sum->apolar = sum->unknown = NAN;
+        return;
+    }
+
     sum->total += term->total;
     sum->side_chain += term->side_chain;
     sum->main_chain += term->main_chain;
@@ -5,21 +5,167 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#if HAVE_MMAP
+#include <sys/mman.h>
+#endif
+#if USE_GZIP
+#include <zlib.h>
+#endif
+#if USE_ZSTD
+#include <zstd.h>
+#endif
+
+#if USE_THREADS
+#include <pthread.h>
+static pthread_mutex_t buffer_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
 #include "freesasa_internal.h"
 #include "pdb.h"
 
-/* len >= 6 */
+#define PDB_INDEX_HEADER "freesasa-pdb-index"
+#define PDB_INDEX_HEADER_STRL "18"
+#define PDB_INDEX_VERSION 2
+
+/* compressed input is decompressed in chunks that fit in 32 bit sizes */
+#define PDB_CHUNK_MAX ((size_t)1 << 30)
+/* size hints in compressed input beyond the maximal deflate ratio are not trusted */
+#define PDB_MAX_RATIO 1032
+
+/* largest mantissas that are exact as floats and doubles */
+#define PDB_FLOAT_MANTISSA ((1ULL << 24) - 1)
+#define PDB_DOUBLE_MANTISSA ((1ULL << 53) - 1)
+
+/* powers of ten that are exact as doubles */
+static const double pdb_pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/**
+    Length of an `ATOM` or `HETATM` line, as strlen() would give for
+    the line, or 0 if it's another type of record. All fields are
+    read through this, so that too short lines are handled the same
+    way by the freesasa_pdb_get_*() functions (on NUL-terminated
+    lines) and freesasa_pdb_decode_atom() (on lines in a buffer).
+ */
+static inline size_t
+pdb_record_length(const char *line, size_t length)
+{
+    if (length < 6) return 0;
+    if (strncmp("ATOM", line, 4) != 0 &&
+        strncmp("HETATM", line, 6) != 0) {
+        return 0;
+    }
+    return length;
+}
+
+/* length = strlen(line) >= len >= 6 */
 static inline int
 pdb_line_check(const char *line, size_t len)
 {
     assert(line);
     if (len < 6) return FREESASA_FAIL;
-    if (strlen(line) < len) return FREESASA_FAIL;
-    if (strncmp("ATOM", line, 4) != 0 &&
-        strncmp("HETATM", line, 6) != 0) {
+    if (pdb_record_length(line, strlen(line)) < len) return FREESASA_FAIL;
+    return FREESASA_SUCCESS;
+}
+
+/* same as strlen() of the line copied by freesasa_pdb_buffer_get_line() */
+static inline size_t
+pdb_buffer_line_length(const char *line, size_t length)
+{
+    const char *nul;
+
+    if (length > PDB_MAX_LINE_STRL - 1) length = PDB_MAX_LINE_STRL - 1;
+    nul = memchr(line, '\0', length);
+
+    return nul ? (size_t)(nul - line) : length;
+}
+
+/* copies a fixed width field, or sets empty string if the line is too short */
+static inline int
+pdb_get_field(char *field, const char *line, size_t record_length,
+              size_t offset, size_t width)
+{
+    if (record_length < offset + width) {
+        field[0] = '\0';
         return FREESASA_FAIL;
     }
+    memcpy(field, line + offset, width);
+    field[width] = '\0';
+    return FREESASA_SUCCESS;
+}
+
+/* a single character field, '\0' if the line is too short */
+static inline char
+pdb_get_char(const char *line, size_t record_length, size_t check, size_t offset)
+{
+    if (record_length < check || record_length <= offset) return '\0';
+    return line[offset];
+}
+
+/**
+    Parses a number in a fixed width field, of the form
+    `[spaces][sign]digits[.digits][spaces]`, as produced by `%f`. The
+    result is the correctly rounded quotient of two exact doubles,
+    which is the same as what strtod() (and sscanf()) gives. For
+    mantissas that are exact as floats (and at most 10 decimals) the
+    double rounding to float is also exact.
+
+    Returns ::FREESASA_FAIL if the field has any other form, or if the
+    character after the field could have continued the number, then
+    the caller should fall back to sscanf().
+ */
+static inline int
+pdb_parse_fixed(const char *field,
+                size_t width,
+                char next,
+                unsigned long long max_mantissa,
+                int max_decimals,
+                double *val)
+{
+    unsigned long long m = 0;
+    size_t i = 0;
+    int negative = 0, n_digits = 0, n_decimals = 0, point = 0;
+    double v;
+
+    while (i < width && field[i] == ' ')
+        ++i;
+    if (i < width && (field[i] == '-' || field[i] == '+')) {
+        negative = field[i] == '-';
+        ++i;
+    }
+    for (; i < width; ++i) {
+        if (field[i] >= '0' && field[i] <= '9') {
+            m = 10 * m + (field[i] - '0');
+            if (m > max_mantissa) return FREESASA_FAIL;
+            ++n_digits;
+            n_decimals += point;
+        } else if (field[i] == '.' && !point) {
+            point = 1;
+        } else {
+            break;
+        }
+    }
+    if (n_digits == 0 || n_decimals > max_decimals) return FREESASA_FAIL;
+
+    if (i == width) {
+        if ((next >= '0' && next <= '9') || next == '.' ||
+            next == 'e' || next == 'E' || next == 'x' || next == 'X') {
+            return FREESASA_FAIL;
+        }
+    } else {
+        for (; i < width; ++i)
+            if (field[i] != ' ') return FREESASA_FAIL;
+    }
+
+    v = (double)m / pdb_pow10[n_decimals];
+    *val = negative ? -v : v;
+
     return FREESASA_SUCCESS;
 }
 
@@ -34,9 +180,15 @@ pdb_get_double(const char *line, size_t width, double *val)
     /* allow truncated lines */
     char buf[PDB_LINE_STRL];
     float tmp;
+    double v;
 
     if (strlen(line) < width) width = strlen(line);
 
+    if (pdb_parse_fixed(line, width, '\0', PDB_FLOAT_MANTISSA, 10, &v) == FREESASA_SUCCESS) {
+        *val = (float)v;
+        return FREESASA_SUCCESS;
+    }
+
     memcpy(buf, line, width);
     buf[width] = '\0';
 
@@ -48,18 +200,408 @@ pdb_get_double(const char *line, size_t width, double *val)
     return FREESASA_FAIL;
 }
 
-int freesasa_pdb_get_models(FILE *pdb,
-                            struct file_range **ranges)
+/* the three 8 character coordinate fields, line has to be long enough */
+static inline int
+pdb_get_coord_fixed(double *xyz, const char *line)
 {
-    char line[PDB_MAX_LINE_STRL];
+    double v[3];
+
+    if (pdb_parse_fixed(line + 30, 8, line[38], PDB_DOUBLE_MANTISSA, 22, &v[0]) ||
+        pdb_parse_fixed(line + 38, 8, line[46], PDB_DOUBLE_MANTISSA, 22, &v[1]) ||
+        pdb_parse_fixed(line + 46, 8, '\0', PDB_DOUBLE_MANTISSA, 22, &v[2])) {
+        return FREESASA_FAIL;
+    }
+    xyz[0] = v[0];
+    xyz[1] = v[1];
+    xyz[2] = v[2];
+
+    return FREESASA_SUCCESS;
+}
+
+static inline int
+pdb_is_hydrogen(const char *line, size_t record_length, const char *symbol)
+{
+    if (record_length < 13) return FREESASA_FAIL;
+
+    /* Check symbol first */
+    if (strncmp(symbol, " H", 2) == 0) return 1;
+    if (strncmp(symbol, " D", 2) == 0) return 1;
+    /* If the symbol is not blank and not H or D */
+    if (!(strncmp(symbol, "  ", 2) == 0)) return 0;
+
+    /* When symbol is missing */
+    /* Cover elements such as Cd, Nd, Th, etc. ("CD  ", "ND  ") */
+    if (!(line[12] == ' ' || (line[12] >= '1' && line[12] <= '9'))) return 0;
+    /* Hydrogen, atom name "H**" or " H**" */
+    if (line[12] == 'H' || pdb_get_char(line, record_length, 13, 13) == 'H') return 1;
+    /* Deuterium */
+    if (line[12] == 'D' || pdb_get_char(line, record_length, 13, 13) == 'D') return 1;
+    return 0;
+}
+
+/* doubles the capacity of a growing buffer */
+static int
+pdb_buffer_grow(char **data, size_t *capacity)
+{
+    size_t new_capacity = *capacity ? 2 * *capacity : 1 << 16;
+    char *new_data = realloc(*data, new_capacity);
+
+    if (new_data == NULL) return mem_fail();
+
+    *data = new_data;
+    *capacity = new_capacity;
+
+    return FREESASA_SUCCESS;
+}
+
+/* reads a whole stream into an allocated buffer */
+static int
+pdb_buffer_read(struct pdb_buffer *buffer, FILE *pdb)
+{
+    char *data = NULL;
+    size_t size = 0, capacity = 0, n_read;
+
+    do {
+        if (size == capacity && pdb_buffer_grow(&data, &capacity)) {
+            free(data);
+            return FREESASA_FAIL;
+        }
+        n_read = fread(data + size, 1, capacity - size, pdb);
+        size += n_read;
+    } while (n_read > 0);
+
+    if (ferror(pdb)) {
+        free(data);
+        return fail_msg(strerror(errno));
+    }
+
+    buffer->data = data;
+    buffer->size = size;
+
+    return FREESASA_SUCCESS;
+}
+
+static void
+pdb_buffer_release_data(struct pdb_buffer *buffer)
+{
+#if HAVE_MMAP
+    if (buffer->is_mapped) {
+        munmap((void *)buffer->data, buffer->size);
+        buffer->data = NULL;
+        return;
+    }
+#endif
+    free((void *)buffer->data);
+    buffer->data = NULL;
+}
+
+#if USE_GZIP
+/* Decompresses gzip data, including several concatenated members */
+static int
+pdb_inflate(const unsigned char *in, size_t in_size, char **out, size_t *out_size)
+{
+    z_stream z;
+    const unsigned char *next;
+    char *data;
+    size_t size = 0, capacity = 2 * in_size, pos = 0, chunk, avail;
+    int ret, status = FREESASA_SUCCESS;
+
+    /* the last four bytes are the size of the last member modulo 2^32 */
+    if (in_size >= 4) {
+        chunk = (size_t)in[in_size - 4] | (size_t)in[in_size - 3] << 8 |
+                (size_t)in[in_size - 2] << 16 | (size_t)in[in_size - 1] << 24;
+        if (chunk > capacity && chunk / PDB_MAX_RATIO <= in_size) capacity = chunk;
+    }
+    if (capacity == 0) capacity = 1;
+
+    data = malloc(capacity);
+    if (data == NULL) return mem_fail();
+
+    memset(&z, 0, sizeof(z));
+    if (inflateInit2(&z, 15 + 16) != Z_OK) {
+        free(data);
+        return fail_msg("failed to initialize gzip decompression");
+    }
+
+    for (;;) {
+        /* the sizes in z_stream are 32 bit */
+        if (z.avail_in == 0 && pos < in_size) {
+            chunk = in_size - pos < PDB_CHUNK_MAX ? in_size - pos : PDB_CHUNK_MAX;
+            z.next_in = (Bytef *)(in + pos);
+            z.avail_in = (uInt)chunk;
+            pos += chunk;
+        }
+        if (size == capacity && pdb_buffer_grow(&data, &capacity)) {
+            status = FREESASA_FAIL;
+            break;
+        }
+        avail = capacity - size < PDB_CHUNK_MAX ? capacity - size : PDB_CHUNK_MAX;
+        z.next_out = (Bytef *)(data + size);
+        z.avail_out = (uInt)avail;
+
+        ret = inflate(&z, Z_NO_FLUSH);
+        size += avail - z.avail_out;
+
+        if (ret == Z_STREAM_END) {
+            /* continue if another member follows, trailing garbage is ignored, as by gzip */
+            next = z.avail_in > 0 ? z.next_in : in + pos;
+            if (in + in_size - next >= 2 && next[0] == 0x1f && next[1] == 0x8b) {
+                inflateReset(&z);
+                continue;
+            }
+            break;
+        } else if (ret == Z_MEM_ERROR) {
+            status = mem_fail();
+            break;
+        } else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            status = fail_msg("corrupt gzip input: %s", z.msg ? z.msg : "unknown error");
+            break;
+        } else if (z.avail_in == 0 && pos == in_size && z.avail_out > 0) {
+            status = fail_msg("gzip input is truncated");
+            break;
+        }
+    }
+
+    inflateEnd(&z);
+
+    if (status == FREESASA_FAIL) {
+        free(data);
+        return FREESASA_FAIL;
+    }
+
+    *out = data;
+    *out_size = size;
+
+    return FREESASA_SUCCESS;
+}
+#endif /* USE_GZIP */
+
+#if USE_ZSTD
+/* Decompresses zstd data, including several concatenated frames */
+static int
+pdb_zstd_decompress(const unsigned char *in, size_t in_size, char **out, size_t *out_size)
+{
+    ZSTD_DStream *z;
+    ZSTD_inBuffer input;
+    ZSTD_outBuffer output;
+    unsigned long long content_size;
+    char *data;
+    size_t size = 0, capacity = 2 * in_size, ret;
+    int status = FREESASA_SUCCESS;
+
+    /* the frame header usually has the decompressed size */
+    content_size = ZSTD_getFrameContentSize(in, in_size);
+    if (content_size != ZSTD_CONTENTSIZE_UNKNOWN &&
+        content_size != ZSTD_CONTENTSIZE_ERROR &&
+        content_size > capacity && content_size / PDB_MAX_RATIO <= in_size) {
+        capacity = (size_t)content_size;
+    }
+
+    data = malloc(capacity);
+    z = ZSTD_createDStream();
+    if (data == NULL || z == NULL) {
+        free(data);
+        ZSTD_freeDStream(z);
+        return mem_fail();
+    }
+    ZSTD_initDStream(z);
+
+    input.src = in;
+    input.size = in_size;
+    input.pos = 0;
+
+    for (;;) {
+        if (size == capacity && pdb_buffer_grow(&data, &capacity)) {
+            status = FREESASA_FAIL;
+            break;
+        }
+        output.dst = data + size;
+        output.size = capacity - size;
+        output.pos = 0;
+
+        ret = ZSTD_decompressStream(z, &output, &input);
+        size += output.pos;
+
+        if (ZSTD_isError(ret)) {
+            status = fail_msg("corrupt zstd input: %s", ZSTD_getErrorName(ret));
+            break;
+        }
+        /* 0 means that a frame has been decoded and flushed */
+        if (input.pos == input.size) {
+            if (ret == 0) break;
+            if (output.pos < output.size) {
+                status = fail_msg("zstd input is truncated");
+                break;
+            }
+        }
+    }
+
+    ZSTD_freeDStream(z);
+
+    if (status == FREESASA_FAIL) {
+        free(data);
+        return FREESASA_FAIL;
+    }
+
+    *out = data;
+    *out_size = size;
+
+    return FREESASA_SUCCESS;
+}
+#endif /* USE_ZSTD */
+
+/* Replaces compressed contents of the buffer with the decompressed data */
+static int
+pdb_buffer_decompress(struct pdb_buffer *buffer)
+{
+    const unsigned char *in = (const unsigned char *)buffer->data;
+    char *data = NULL;
+    size_t size = 0;
+
+    if (buffer->size >= 2 && in[0] == 0x1f && in[1] == 0x8b) {
+#if USE_GZIP
+        if (pdb_inflate(in, buffer->size, &data, &size)) return FREESASA_FAIL;
+#else
+        return fail_msg("input is gzip-compressed, but FreeSASA was built without gzip support");
+#endif
+    } else if (buffer->size >= 4 && in[0] == 0x28 && in[1] == 0xb5 &&
+               in[2] == 0x2f && in[3] == 0xfd) {
+#if USE_ZSTD
+        if (pdb_zstd_decompress(in, buffer->size, &data, &size)) return FREESASA_FAIL;
+#else
+        return fail_msg("input is zstd-compressed, but FreeSASA was built without zstd support");
+#endif
+    } else {
+        return FREESASA_SUCCESS;
+    }
+
+    pdb_buffer_release_data(buffer);
+    buffer->data = data;
+    buffer->size = size;
+    buffer->is_mapped = 0;
+
+    return FREESASA_SUCCESS;
+}
+
+struct pdb_buffer *
+freesasa_pdb_buffer_new(FILE *pdb)
+{
+    struct pdb_buffer *buffer;
+#if HAVE_SYS_STAT_H
+    struct stat st;
+    int fd;
+#if HAVE_MMAP
+    char *data;
+#endif
+#endif
+
+    assert(pdb);
+
+    buffer = malloc(sizeof(struct pdb_buffer));
+    if (buffer == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    buffer->data = NULL;
+    buffer->size = 0;
+    buffer->is_mapped = 0;
+    buffer->refcount = 1;
+    buffer->mtime = 0;
+    buffer->mtime_nsec = 0;
+
+    /* also flushes any pending output */
+    rewind(pdb);
+
+#if HAVE_SYS_STAT_H
+    fd = fileno(pdb);
+    if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+        buffer->mtime = (long)st.st_mtime;
+        /* a file can be rewritten within a second, so use the full
+           resolution where available */
+#if HAVE_STRUCT_STAT_ST_MTIM
+        buffer->mtime_nsec = st.st_mtim.tv_nsec;
+#elif HAVE_STRUCT_STAT_ST_MTIMESPEC
+        buffer->mtime_nsec = st.st_mtimespec.tv_nsec;
+#endif
+        if (st.st_size == 0) return buffer;
+#if HAVE_MMAP
+        data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+            madvise(data, st.st_size, MADV_SEQUENTIAL);
+#endif
+            buffer->data = data;
+            buffer->size = st.st_size;
+            buffer->is_mapped = 1;
+        }
+#endif
+    }
+#endif
+
+    /* can't be mapped, read everything into one buffer */
+    if (!buffer->is_mapped && pdb_buffer_read(buffer, pdb)) {
+        free(buffer);
+        return NULL;
+    }
+
+    if (pdb_buffer_decompress(buffer)) {
+        pdb_buffer_release_data(buffer);
+        free(buffer);
+        return NULL;
+    }
+
+    return buffer;
+}
+
+struct pdb_buffer *
+freesasa_pdb_buffer_ref(struct pdb_buffer *buffer)
+{
+    assert(buffer);
+#if USE_THREADS
+    pthread_mutex_lock(&buffer_lock);
+#endif
+    ++buffer->refcount;
+#if USE_THREADS
+    pthread_mutex_unlock(&buffer_lock);
+#endif
+    return buffer;
+}
+
+void freesasa_pdb_buffer_free(struct pdb_buffer *buffer)
+{
+    int refcount;
+
+    if (buffer == NULL) return;
+
+#if USE_THREADS
+    pthread_mutex_lock(&buffer_lock);
+#endif
+    refcount = --buffer->refcount;
+#if USE_THREADS
+    pthread_mutex_unlock(&buffer_lock);
+#endif
+
+    if (refcount > 0) return;
+
+    pdb_buffer_release_data(buffer);
+    free(buffer);
+}
+
+int freesasa_pdb_buffer_models(const struct pdb_buffer *buffer,
+                               struct file_range **ranges)
+{
+    const char *line;
+    size_t pos, next;
     int n = 0, n_end = 0, error = 0;
-    long last_pos = ftell(pdb);
     struct file_range *it = NULL, *itb;
 
-    assert(pdb != NULL);
+    assert(buffer != NULL);
 
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb) != NULL) {
-        if (strncmp("MODEL", line, 5) == 0) {
+    for (pos = 0; pos < buffer->size; pos = next) {
+        next = freesasa_pdb_buffer_next_line(buffer, pos);
+        line = buffer->data + pos;
+        if (next - pos >= 5 && strncmp("MODEL", line, 5) == 0) {
             ++n;
             itb = it;
             it = realloc(it, sizeof(struct file_range) * n);
@@ -68,17 +610,16 @@ int freesasa_pdb_get_models(FILE *pdb,
                 error = mem_fail();
                 break;
             }
-            it[n - 1].begin = last_pos;
+            it[n - 1].begin = pos;
         }
-        if (strncmp("ENDMDL", line, 6) == 0) {
+        if (next - pos >= 6 && strncmp("ENDMDL", line, 6) == 0) {
             ++n_end;
             if (n != n_end) {
                 error = fail_msg("mismatch between MODEL and ENDMDL in input");
                 break;
             }
-            it[n - 1].end = ftell(pdb);
+            it[n - 1].end = next;
         }
-        last_pos = ftell(pdb);
     }
     if (n == 0) { /* when there are no models, the whole file is the model */
         free(it);
@@ -93,34 +634,38 @@ int freesasa_pdb_get_models(FILE *pdb,
     return n;
 }
 
-int freesasa_pdb_get_chains(FILE *pdb,
-                            struct file_range model,
-                            struct file_range **ranges,
-                            int options)
+int freesasa_pdb_buffer_chains(const struct pdb_buffer *buffer,
+                               struct file_range model,
+                               struct file_range **ranges,
+                               int options)
 {
-    /* it is assumed that 'model' is valid for 'pdb' */
+    /* it is assumed that 'model' is valid for 'buffer' */
 
     int n_chains = 0;
-    char line[PDB_MAX_LINE_STRL];
+    const char *line;
     struct file_range *chains = NULL, *chb;
     char last_chain = '\0';
-    long last_pos = model.begin;
+    size_t pos, next, end = model.end;
 
-    assert(pdb);
+    assert(buffer);
     assert(ranges);
 
     *ranges = NULL;
 
-    /* for each model, find file ranges for each chain, store them
-       in the dynamically growing array chains */
-    fseek(pdb, model.begin, SEEK_SET);
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb) != NULL &&
-           ftell(pdb) < model.end) {
-        if (strncmp("ATOM", line, 4) == 0 || ((options & FREESASA_INCLUDE_HETATM) &&
-                                              (strncmp("HETATM", line, 6) == 0))) {
-            char chain = freesasa_pdb_get_chain_label(line);
+    if (end > buffer->size) end = buffer->size;
+
+    /* for each model, find ranges for each chain, store them in the
+       dynamically growing array chains */
+    for (pos = model.begin; pos < end; pos = next) {
+        next = freesasa_pdb_buffer_next_line(buffer, pos);
+        if (next >= end) break;
+        line = buffer->data + pos;
+        if ((next - pos >= 4 && strncmp("ATOM", line, 4) == 0) ||
+            ((options & FREESASA_INCLUDE_HETATM) &&
+             (next - pos >= 6 && strncmp("HETATM", line, 6) == 0))) {
+            char chain = next - pos > 21 ? line[21] : '\0';
             if (chain != last_chain) {
-                if (n_chains > 0) chains[n_chains - 1].end = last_pos;
+                if (n_chains > 0) chains[n_chains - 1].end = pos;
                 ++n_chains;
                 chb = chains;
                 chains = realloc(chains, sizeof(struct file_range) * n_chains);
@@ -128,15 +673,14 @@ int freesasa_pdb_get_chains(FILE *pdb,
                     free(chb);
                     return mem_fail();
                 }
-                chains[n_chains - 1].begin = last_pos;
+                chains[n_chains - 1].begin = pos;
                 last_chain = chain;
             }
         }
-        last_pos = ftell(pdb);
     }
 
     if (n_chains > 0) {
-        chains[n_chains - 1].end = last_pos;
+        chains[n_chains - 1].end = pos;
         chains[0].begin = model.begin; /* preserve model info */
         *ranges = chains;
     } else {
@@ -145,18 +689,362 @@ int freesasa_pdb_get_chains(FILE *pdb,
     return n_chains;
 }
 
+static inline int
+pdb_is_atom_record(const char *line, size_t len, int hetatm)
+{
+    return (len >= 4 && strncmp("ATOM", line, 4) == 0) ||
+           (hetatm && len >= 6 && strncmp("HETATM", line, 6) == 0);
+}
+
+static struct pdb_index *
+pdb_index_alloc(int n_models, int n_chains)
+{
+    struct pdb_index *index = malloc(sizeof(struct pdb_index));
+
+    if (index == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    /* always room for the implicit model */
+    if (n_models < 1) n_models = 1;
+
+    index->n_models = 0;
+    index->n_chains = 0;
+    index->hetatm = 0;
+    index->size = 0;
+    index->mtime = 0;
+    index->mtime_nsec = 0;
+    index->models = malloc(sizeof(struct file_range) * n_models);
+    index->atoms = malloc(sizeof(struct file_range) * n_models);
+    index->model_chains = malloc(sizeof(int) * (n_models + 1));
+    index->chains = malloc(sizeof(struct file_range) * (n_chains > 0 ? n_chains : 1));
+
+    if (!index->models || !index->atoms || !index->model_chains || !index->chains) {
+        freesasa_pdb_index_free(index);
+        mem_fail();
+        return NULL;
+    }
+
+    return index;
+}
+
+void freesasa_pdb_index_free(struct pdb_index *index)
+{
+    if (index) {
+        free(index->models);
+        free(index->atoms);
+        free(index->model_chains);
+        free(index->chains);
+        free(index);
+    }
+}
+
+static int
+pdb_index_resize(void **array, int n, size_t size)
+{
+    void *tmp = realloc(*array, size * n);
+
+    if (tmp == NULL) return mem_fail();
+    *array = tmp;
+
+    return FREESASA_SUCCESS;
+}
+
+struct pdb_index *
+freesasa_pdb_index_new(const struct pdb_buffer *buffer,
+                       int options)
+{
+    struct pdb_index *index;
+    const char *line;
+    size_t pos, next, len;
+    int *chain_model = NULL;
+    int model_capacity = 16, chain_capacity = 16;
+    int m = -1, in_model = 0, chain_open = 0, n_chains = 0, i, j;
+    int hetatm = (options & FREESASA_INCLUDE_HETATM) ? 1 : 0;
+    struct file_range outside = {-1, -1};
+    char chain, last_chain = '\0';
+
+    assert(buffer);
+
+    index = pdb_index_alloc(model_capacity, chain_capacity);
+    if (index == NULL) return NULL;
+
+    chain_model = malloc(sizeof(int) * chain_capacity);
+    if (chain_model == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    index->hetatm = hetatm;
+    index->size = buffer->size;
+    index->mtime = buffer->mtime;
+    index->mtime_nsec = buffer->mtime_nsec;
+
+    for (pos = 0; pos < buffer->size; pos = next) {
+        next = freesasa_pdb_buffer_next_line(buffer, pos);
+        line = buffer->data + pos;
+        len = next - pos;
+
+        if (len >= 5 && strncmp("MODEL", line, 5) == 0) {
+            if (in_model) {
+                fail_msg("mismatch between MODEL and ENDMDL in input");
+                goto cleanup;
+            }
+            if (++m == model_capacity) {
+                model_capacity *= 2;
+                if (pdb_index_resize((void **)&index->models, model_capacity, sizeof(struct file_range)) ||
+                    pdb_index_resize((void **)&index->atoms, model_capacity, sizeof(struct file_range)) ||
+                    pdb_index_resize((void **)&index->model_chains, model_capacity + 1, sizeof(int))) {
+                    goto cleanup;
+                }
+            }
+            index->models[m].begin = pos;
+            index->models[m].end = buffer->size;
+            index->atoms[m].begin = index->atoms[m].end = -1;
+            in_model = 1;
+            chain_open = 0;
+        } else if (len >= 6 && strncmp("ENDMDL", line, 6) == 0) {
+            if (!in_model) {
+                fail_msg("mismatch between MODEL and ENDMDL in input");
+                goto cleanup;
+            }
+            index->models[m].end = next;
+            in_model = 0;
+            chain_open = 0;
+        } else if (pdb_is_atom_record(line, len, 1)) {
+            struct file_range *atoms = in_model ? &index->atoms[m] : &outside;
+            if (atoms->begin < 0) atoms->begin = pos;
+            atoms->end = next;
+
+            if (!pdb_is_atom_record(line, len, hetatm)) continue;
+
+            chain = len > 21 ? line[21] : '\0';
+            if (!chain_open || chain != last_chain) {
+                if (n_chains == chain_capacity) {
+                    chain_capacity *= 2;
+                    if (pdb_index_resize((void **)&index->chains, chain_capacity, sizeof(struct file_range)) ||
+                        pdb_index_resize((void **)&chain_model, chain_capacity, sizeof(int))) {
+                        goto cleanup;
+                    }
+                }
+                index->chains[n_chains].begin = pos;
+                chain_model[n_chains] = in_model ? m : -1;
+                ++n_chains;
+                chain_open = 1;
+                last_chain = chain;
+            }
+            index->chains[n_chains - 1].end = next;
+        }
+    }
+
+    index->n_models = m + 1;
+
+    if (index->n_models == 0) {
+        /* the whole file is the model */
+        index->models[0].begin = 0;
+        index->models[0].end = buffer->size;
+        index->atoms[0] = outside;
+        for (j = 0; j < n_chains; ++j)
+            chain_model[j] = 0;
+    }
+
+    /* atoms outside of models are ignored if there are models */
+    for (i = 0, j = 0; j < n_chains; ++j) {
+        if (chain_model[j] >= 0) {
+            index->chains[i] = index->chains[j];
+            chain_model[i] = chain_model[j];
+            ++i;
+        }
+    }
+    index->n_chains = n_chains = i;
+
+    for (i = 0, j = 0; i < freesasa_pdb_index_n_models(index); ++i) {
+        if (index->atoms[i].begin < 0) {
+            index->atoms[i].begin = index->atoms[i].end = index->models[i].begin;
+        }
+        index->model_chains[i] = j;
+        while (j < n_chains && chain_model[j] == i)
+            ++j;
+    }
+    index->model_chains[i] = j;
+
+    free(chain_model);
+
+    return index;
+
+cleanup:
+    free(chain_model);
+    freesasa_pdb_index_free(index);
+    return NULL;
+}
+
+int freesasa_pdb_index_write(FILE *output,
+                             const struct pdb_index *index)
+{
+    int i, j;
+
+    assert(output);
+    assert(index);
+
+    fprintf(output, "%s %d\n", PDB_INDEX_HEADER, PDB_INDEX_VERSION);
+    fprintf(output, "size %lu mtime %ld %ld hetatm %d\n",
+            (unsigned long)index->size, index->mtime, index->mtime_nsec, index->hetatm);
+    fprintf(output, "models %d chains %d\n", index->n_models, index->n_chains);
+
+    for (i = 0; i < freesasa_pdb_index_n_models(index); ++i) {
+        fprintf(output, "model %ld %ld %ld %ld %d\n",
+                index->models[i].begin, index->models[i].end,
+                index->atoms[i].begin, index->atoms[i].end,
+                index->model_chains[i + 1] - index->model_chains[i]);
+        for (j = index->model_chains[i]; j < index->model_chains[i + 1]; ++j) {
+            fprintf(output, "chain %ld %ld\n",
+                    index->chains[j].begin, index->chains[j].end);
+        }
+    }
+
+    fflush(output);
+    if (ferror(output)) return fail_msg(strerror(errno));
+
+    return FREESASA_SUCCESS;
+}
+
+/* checks that a range from an index fits the buffer, and starts with
+   one of the given records (if not empty) */
+static int
+pdb_index_check_range(const struct pdb_buffer *buffer,
+                      struct file_range range,
+                      const char *record1,
+                      const char *record2)
+{
+    size_t pos = range.begin, len;
+
+    if (range.begin < 0 || range.begin > range.end || (size_t)range.end > buffer->size) return 0;
+    if (range.begin == range.end) return 1;
+    if (pos > 0 && buffer->data[pos - 1] != '\n') return 0;
+
+    len = freesasa_pdb_buffer_next_line(buffer, pos) - pos;
+    return (len >= strlen(record1) && strncmp(record1, buffer->data + pos, strlen(record1)) == 0) ||
+           (record2 && len >= strlen(record2) && strncmp(record2, buffer->data + pos, strlen(record2)) == 0);
+}
+
+struct pdb_index *
+freesasa_pdb_index_read(FILE *input,
+                        const struct pdb_buffer *buffer,
+                        int options)
+{
+    struct pdb_index *index = NULL;
+    char header[sizeof(PDB_INDEX_HEADER)];
+    unsigned long size;
+    long mtime, mtime_nsec;
+    int version, hetatm, n_models, n_chains, n_model_chains, i, j;
+
+    assert(input);
+    assert(buffer);
+
+    if (fscanf(input, "%" PDB_INDEX_HEADER_STRL "s %d", header, &version) != 2 ||
+        strcmp(header, PDB_INDEX_HEADER) != 0 || version != PDB_INDEX_VERSION) {
+        return NULL;
+    }
+    if (fscanf(input, " size %lu mtime %ld %ld hetatm %d", &size, &mtime, &mtime_nsec, &hetatm) != 4 ||
+        fscanf(input, " models %d chains %d", &n_models, &n_chains) != 2) {
+        return NULL;
+    }
+    if (size != buffer->size || mtime != buffer->mtime || mtime_nsec != buffer->mtime_nsec ||
+        hetatm != ((options & FREESASA_INCLUDE_HETATM) ? 1 : 0) ||
+        n_models < 0 || n_chains < 0) {
+        return NULL;
+    }
+    /* every model needs at least a "MODEL\n" line and every chain an
+       "ATOM\n" line, don't allocate for counts the file can't hold */
+    if ((size_t)n_models > buffer->size / strlen("MODEL\n") ||
+        (size_t)n_chains > buffer->size / strlen("ATOM\n")) {
+        return NULL;
+    }
+
+    index = pdb_index_alloc(n_models, n_chains);
+    if (index == NULL) return NULL;
+
+    index->n_models = n_models;
+    index->hetatm = hetatm;
+    index->size = buffer->size;
+    index->mtime = buffer->mtime;
+    index->mtime_nsec = buffer->mtime_nsec;
+
+    for (i = 0, j = 0; i < freesasa_pdb_index_n_models(index); ++i) {
+        if (fscanf(input, " model %ld %ld %ld %ld %d",
+                   &index->models[i].begin, &index->models[i].end,
+                   &index->atoms[i].begin, &index->atoms[i].end,
+                   &n_model_chains) != 5 ||
+            n_model_chains < 0 || j + n_model_chains > n_chains ||
+            !pdb_index_check_range(buffer, index->models[i], n_models > 0 ? "MODEL" : "", NULL) ||
+            !pdb_index_check_range(buffer, index->atoms[i], "ATOM", "HETATM")) {
+            goto mismatch;
+        }
+        index->model_chains[i] = j;
+        for (n_model_chains += j; j < n_model_chains; ++j) {
+            if (fscanf(input, " chain %ld %ld",
+                       &index->chains[j].begin, &index->chains[j].end) != 2 ||
+                !pdb_index_check_range(buffer, index->chains[j], "ATOM", hetatm ? "HETATM" : NULL)) {
+                goto mismatch;
+            }
+        }
+    }
+    if (j != n_chains) goto mismatch;
+    index->model_chains[i] = j;
+    index->n_chains = n_chains;
+
+    return index;
+
+mismatch:
+    freesasa_pdb_index_free(index);
+    return NULL;
+}
+
+int freesasa_pdb_get_models(FILE *pdb,
+                            struct file_range **ranges)
+{
+    struct pdb_buffer *buffer;
+    int n;
+
+    assert(pdb != NULL);
+
+    buffer = freesasa_pdb_buffer_new(pdb);
+    if (buffer == NULL) return fail_msg("");
+
+    n = freesasa_pdb_buffer_models(buffer, ranges);
+    freesasa_pdb_buffer_free(buffer);
+
+    return n;
+}
+
+int freesasa_pdb_get_chains(FILE *pdb,
+                            struct file_range model,
+                            struct file_range **ranges,
+                            int options)
+{
+    struct pdb_buffer *buffer;
+    int n;
+
+    assert(pdb);
+    assert(ranges);
+
+    buffer = freesasa_pdb_buffer_new(pdb);
+    if (buffer == NULL) return fail_msg("");
+
+    n = freesasa_pdb_buffer_chains(buffer, model, ranges, options);
+    freesasa_pdb_buffer_free(buffer);
+
+    return n;
+}
+
 int freesasa_pdb_get_atom_name(char *name,
                                const char *line)
 {
     assert(name);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_NAME_STRL + 12) == FREESASA_FAIL) {
-        name[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(name, line + 12, PDB_ATOM_NAME_STRL);
-    name[PDB_ATOM_NAME_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(name, line, pdb_record_length(line, strlen(line)),
+                         12, PDB_ATOM_NAME_STRL);
 }
 
 int freesasa_pdb_get_res_name(char *name,
@@ -164,13 +1052,8 @@ int freesasa_pdb_get_res_name(char *name,
 {
     assert(name);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_RES_NAME_STRL + 17) == FREESASA_FAIL) {
-        name[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(name, line + 17, PDB_ATOM_RES_NAME_STRL);
-    name[PDB_ATOM_RES_NAME_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(name, line, pdb_record_length(line, strlen(line)),
+                         17, PDB_ATOM_RES_NAME_STRL);
 }
 
 int freesasa_pdb_get_coord(double *xyz,
@@ -186,6 +1069,10 @@ int freesasa_pdb_get_coord(double *xyz,
         return FREESASA_FAIL;
     }
 
+    if (pdb_get_coord_fixed(xyz, line) == FREESASA_SUCCESS) {
+        return FREESASA_SUCCESS;
+    }
+
     strncpy(coord_section, line + 30, n_coord);
     coord_section[n_coord] = '\0';
 
@@ -201,39 +1088,28 @@ int freesasa_pdb_get_res_number(char *number,
 {
     assert(number);
     assert(line);
-    if (pdb_line_check(line, PDB_ATOM_RES_NUMBER_STRL + 22) == FREESASA_FAIL) {
-        number[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(number, line + 22, PDB_ATOM_RES_NUMBER_STRL);
-    number[PDB_ATOM_RES_NUMBER_STRL] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(number, line, pdb_record_length(line, strlen(line)),
+                         22, PDB_ATOM_RES_NUMBER_STRL);
 }
+
 char freesasa_pdb_get_chain_label(const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 21) == FREESASA_FAIL) return '\0';
-    return line[21];
+    return pdb_get_char(line, pdb_record_length(line, strlen(line)), 21, 21);
 }
 
 char freesasa_pdb_get_alt_coord_label(const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 16) == FREESASA_FAIL) return '\0';
-    return line[16];
+    return pdb_get_char(line, pdb_record_length(line, strlen(line)), 16, 16);
 }
 
 int freesasa_pdb_get_symbol(char *symbol,
                             const char *line)
 {
     assert(line);
-    if (pdb_line_check(line, 76 + PDB_ATOM_SYMBOL_STRL) == FREESASA_FAIL) {
-        symbol[0] = '\0';
-        return FREESASA_FAIL;
-    }
-    strncpy(symbol, line + 76, 2);
-    symbol[2] = '\0';
-    return FREESASA_SUCCESS;
+    return pdb_get_field(symbol, line, pdb_record_length(line, strlen(line)),
+                         76, PDB_ATOM_SYMBOL_STRL);
 }
 
 int freesasa_pdb_get_occupancy(double *occ,
@@ -258,26 +1134,82 @@ int freesasa_pdb_get_bfactor(double *bfac,
 
 int freesasa_pdb_ishydrogen(const char *line)
 {
-    assert(line);
     char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    freesasa_pdb_get_symbol(symbol, line);
+    size_t length;
 
-    if (pdb_line_check(line, 13) == FREESASA_FAIL) return FREESASA_FAIL;
+    assert(line);
 
-    /* Check symbol first */
-    if (strncmp(symbol, " H", 2) == 0) return 1;
-    if (strncmp(symbol, " D", 2) == 0) return 1;
-    /* If the symbol is not blank and not H or D */
-    if (!(strncmp(symbol, "  ", 2) == 0)) return 0;
+    length = pdb_record_length(line, strlen(line));
+    pdb_get_field(symbol, line, length, 76, PDB_ATOM_SYMBOL_STRL);
 
-    /* When symbol is missing */
-    /* Cover elements such as Cd, Nd, Th, etc. ("CD  ", "ND  ") */
-    if (!(line[12] == ' ' || (line[12] >= '1' && line[12] <= '9'))) return 0;
-    /* Hydrogen, atom name "H**" or " H**" */
-    if (line[12] == 'H' || line[13] == 'H') return 1;
-    /* Deuterium */
-    if (line[12] == 'D' || line[13] == 'D') return 1;
-    return 0;
+    return pdb_is_hydrogen(line, length, symbol);
+}
+
+void freesasa_pdb_decode_atom(struct pdb_atom_record *record,
+                              const char *line,
+                              size_t length)
+{
+    assert(record);
+    assert(line);
+
+    length = pdb_record_length(line, pdb_buffer_line_length(line, length));
+
+    pdb_get_field(record->atom_name, line, length, 12, PDB_ATOM_NAME_STRL);
+    pdb_get_field(record->res_name, line, length, 17, PDB_ATOM_RES_NAME_STRL);
+    pdb_get_field(record->res_number, line, length, 22, PDB_ATOM_RES_NUMBER_STRL);
+    record->has_symbol = pdb_get_field(record->symbol, line, length, 76, PDB_ATOM_SYMBOL_STRL);
+    record->chain_label = pdb_get_char(line, length, 21, 21);
+    record->alt_label = pdb_get_char(line, length, 16, 16);
+    record->is_hydrogen = pdb_is_hydrogen(line, length, record->symbol);
+}
+
+int freesasa_pdb_decode_coord(double *xyz,
+                              const char *line,
+                              size_t length)
+{
+    char copy[PDB_MAX_LINE_STRL];
+
+    assert(xyz);
+    assert(line);
+
+    if (pdb_record_length(line, pdb_buffer_line_length(line, length)) >= 54 &&
+        pdb_get_coord_fixed(xyz, line) == FREESASA_SUCCESS) {
+        return FREESASA_SUCCESS;
+    }
+
+    /* non-standard format, or error */
+    if (length > PDB_MAX_LINE_STRL - 1) length = PDB_MAX_LINE_STRL - 1;
+    memcpy(copy, line, length);
+    copy[length] = '\0';
+
+    return freesasa_pdb_get_coord(xyz, copy);
+}
+
+int freesasa_pdb_decode_occupancy(double *occ,
+                                  const char *line,
+                                  size_t length)
+{
+    char copy[PDB_MAX_LINE_STRL];
+    size_t record_length, width;
+
+    assert(occ);
+    assert(line);
+
+    record_length = pdb_record_length(line, pdb_buffer_line_length(line, length));
+    if (record_length >= 55) {
+        width = record_length - 54 < 6 ? record_length - 54 : 6;
+        if (pdb_parse_fixed(line + 54, width, '\0', PDB_FLOAT_MANTISSA, 10, occ) == FREESASA_SUCCESS) {
+            *occ = (float)*occ;
+            return FREESASA_SUCCESS;
+        }
+    }
+
+    /* non-standard format, or error */
+    if (length > PDB_MAX_LINE_STRL - 1) length = PDB_MAX_LINE_STRL - 1;
+    memcpy(copy, line, length);
+    copy[length] = '\0';
+
+    return freesasa_pdb_get_occupancy(occ, copy);
 }
 
 static int
@@ -317,7 +1249,8 @@ write_pdb_impl(FILE *output,
                 }
 
                 strncpy(buf, line, PDB_LINE_STRL);
-                sprintf(&buf[54], "%6.2f%6.2f", radius, area->total);
+                sprintf(&buf[54], "%6.2f", radius);
+                freesasa_area_str(&buf[60], area->total, 6, 2);
                 fprintf(output, "%s\n", buf);
 
                 atom = freesasa_node_next(atom);
@@ -1,9 +1,15 @@
 #ifndef FREESASA_PDB_H
 #define FREESASA_PDB_H
 
+#include <string.h>
+
 #include "freesasa.h"
 #include "freesasa_internal.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
     @file
     @author Simon Mitternacht
@@ -21,6 +27,287 @@
 #define PDB_LINE_STRL 80           /**< Length of a line in PDB file. */
 #define PDB_MAX_LINE_STRL 120      /**< for reading, allows nonstandard input with extra fields. */
 
+/**
+    The contents of a PDB file in memory.
+
+    Regular files are memory-mapped, other streams (pipes etc) are
+    read into a single buffer. Input compressed with gzip or zstd is
+    recognized by its magic number and decompressed into the buffer
+    (if support was compiled in). Structures read from the buffer keep a
+    reference to it and point to their `ATOM` lines in it instead of
+    copying them. Positions in the buffer are byte offsets, and can be
+    used in a ::file_range.
+ */
+struct pdb_buffer {
+    const char *data; /**< The file contents, not NUL-terminated. */
+    size_t size;      /**< Size of data in bytes. */
+    int is_mapped;    /**< If data is memory-mapped or allocated. */
+    int refcount;     /**< Number of references, see freesasa_pdb_buffer_ref(). */
+    long mtime;       /**< Modification time of the file, 0 if not a regular file. */
+    long mtime_nsec;  /**< Nanoseconds of the modification time, 0 if not available. */
+};
+
+/**
+    Index of the models and chains in a PDB buffer.
+
+    Built in one pass over the buffer by freesasa_pdb_index_new(), and
+    can be saved to and loaded from a sidecar file, so that input
+    which is read repeatedly doesn't have to be scanned again. The
+    chains of model `i` are `chains[model_chains[i]]` to
+    `chains[model_chains[i+1]-1]`.
+
+    If the buffer has no `MODEL` records, the whole buffer is treated
+    as one model, and `n_models` is 0, as for
+    freesasa_pdb_buffer_models(). The arrays always have room for at
+    least one model.
+ */
+struct pdb_index {
+    int n_models;              /**< Number of `MODEL` records. */
+    struct file_range *models; /**< From `MODEL` to after `ENDMDL`. */
+    struct file_range *atoms;  /**< First to last `ATOM`/`HETATM` record of each model. */
+    int *model_chains;         /**< Offset of the first chain of each model in chains. */
+    int n_chains;              /**< Total number of chains. */
+    struct file_range *chains; /**< First to last atom record of each chain. */
+    int hetatm;                /**< If `HETATM` records were included in the chains. */
+    size_t size;               /**< Size of the indexed buffer. */
+    long mtime;                /**< Modification time of the indexed file. */
+    long mtime_nsec;           /**< Nanoseconds of the modification time. */
+};
+
+/**
+    The text fields of an `ATOM` or `HETATM` record.
+
+    Filled in by freesasa_pdb_decode_atom(), each field has the same
+    value as the corresponding freesasa_pdb_get_*() function would
+    give for the line.
+ */
+struct pdb_atom_record {
+    char atom_name[PDB_ATOM_NAME_STRL + 1];        /**< See freesasa_pdb_get_atom_name(). */
+    char res_name[PDB_ATOM_RES_NAME_STRL + 1];     /**< See freesasa_pdb_get_res_name(). */
+    char res_number[PDB_ATOM_RES_NUMBER_STRL + 1]; /**< See freesasa_pdb_get_res_number(). */
+    char symbol[PDB_ATOM_SYMBOL_STRL + 1];         /**< See freesasa_pdb_get_symbol(). */
+    int has_symbol;                                /**< Return value of freesasa_pdb_get_symbol(). */
+    char chain_label;                              /**< See freesasa_pdb_get_chain_label(). */
+    char alt_label;                                /**< See freesasa_pdb_get_alt_coord_label(). */
+    int is_hydrogen;                               /**< See freesasa_pdb_ishydrogen(). */
+};
+
+/**
+    Reads a whole PDB file into memory.
+
+    The file is rewound first, as is done by freesasa_whole_file().
+
+    @param pdb The file.
+    @return The buffer, with one reference, NULL if the file couldn't
+      be read (or malloc failure).
+ */
+struct pdb_buffer *
+freesasa_pdb_buffer_new(FILE *pdb);
+
+/**
+    Adds a reference to a buffer.
+
+    @param buffer The buffer.
+    @return The buffer.
+ */
+struct pdb_buffer *
+freesasa_pdb_buffer_ref(struct pdb_buffer *buffer);
+
+/**
+    Removes a reference to a buffer, the buffer is unmapped or freed
+    when there are no references left.
+
+    @param buffer The buffer, can be NULL.
+ */
+void freesasa_pdb_buffer_free(struct pdb_buffer *buffer);
+
+/**
+    The position of the line after the one starting at pos.
+
+    @param buffer The buffer.
+    @param pos Beginning of a line.
+    @return Position after the newline ending the line, or the size
+      of the buffer if the line is the last one.
+ */
+static inline size_t
+freesasa_pdb_buffer_next_line(const struct pdb_buffer *buffer,
+                              size_t pos)
+{
+    const char *nl = (const char *)memchr(buffer->data + pos, '\n', buffer->size - pos);
+    return nl ? (size_t)(nl - buffer->data) + 1 : buffer->size;
+}
+
+/**
+    Copies a line from a buffer to a NUL-terminated string.
+
+    Like fgets() the newline is kept. Lines longer than
+    ::PDB_MAX_LINE_STRL are truncated.
+
+    @param line Output string, should have room for
+      ::PDB_MAX_LINE_STRL characters.
+    @param buffer The buffer.
+    @param begin Beginning of line.
+    @param end Beginning of next line (see freesasa_pdb_buffer_next_line()).
+ */
+static inline void
+freesasa_pdb_buffer_get_line(char *line,
+                             const struct pdb_buffer *buffer,
+                             size_t begin,
+                             size_t end)
+{
+    size_t len = end - begin;
+    if (len > PDB_MAX_LINE_STRL - 1) len = PDB_MAX_LINE_STRL - 1;
+    memcpy(line, buffer->data + begin, len);
+    line[len] = '\0';
+}
+
+/**
+    Finds the location of all MODEL entries in a buffer.
+
+    See freesasa_pdb_get_models(), the ranges are positions in the
+    buffer.
+
+    @param buffer The buffer.
+    @param ranges Ranges of the models.
+    @return Number of models, or ::FREESASA_FAIL.
+ */
+int freesasa_pdb_buffer_models(const struct pdb_buffer *buffer,
+                               struct file_range **ranges);
+
+/**
+    Finds the location of all chains within a model in a buffer.
+
+    See freesasa_pdb_get_chains(), the ranges are positions in the
+    buffer.
+
+    @param buffer The buffer.
+    @param model The ::file_range to search for chains within.
+    @param ranges Ranges of the chains.
+    @param options Bitfield, can be used to set
+      ::FREESASA_INCLUDE_HETATM.
+    @return Number of chains, or ::FREESASA_FAIL.
+ */
+int freesasa_pdb_buffer_chains(const struct pdb_buffer *buffer,
+                               struct file_range model,
+                               struct file_range **ranges,
+                               int options);
+
+/**
+    Decodes the text fields of an `ATOM` or `HETATM` line in a buffer.
+
+    Extracts all fields in one pass at their fixed columns, without
+    copying the line first. The result is the same as calling the
+    freesasa_pdb_get_*() functions on a copy made by
+    freesasa_pdb_buffer_get_line().
+
+    @param record The fields are written here.
+    @param line Beginning of line in buffer.
+    @param length Length of line, including newline (see
+      freesasa_pdb_buffer_next_line()).
+ */
+void freesasa_pdb_decode_atom(struct pdb_atom_record *record,
+                              const char *line,
+                              size_t length);
+
+/**
+    Decodes the coordinates of an `ATOM` or `HETATM` line in a buffer.
+
+    Coordinates in the standard `%8.3f` format (or any other plain
+    decimal format within the columns) are parsed directly, other
+    input falls back to freesasa_pdb_get_coord(). The result is
+    identical in both cases.
+
+    @param xyz The coordinates are written here.
+    @param line Beginning of line in buffer.
+    @param length Length of line, including newline.
+    @return ::FREESASA_SUCCESS if input is readable, else ::FREESASA_FAIL.
+ */
+int freesasa_pdb_decode_coord(double *xyz,
+                              const char *line,
+                              size_t length);
+
+/**
+    Decodes the occupancy of an `ATOM` or `HETATM` line in a buffer.
+
+    Like freesasa_pdb_decode_coord(), but for
+    freesasa_pdb_get_occupancy().
+
+    @param occ The occupancy is written here.
+    @param line Beginning of line in buffer.
+    @param length Length of line, including newline.
+    @return ::FREESASA_SUCCESS if input is readable, else ::FREESASA_FAIL.
+ */
+int freesasa_pdb_decode_occupancy(double *occ,
+                                  const char *line,
+                                  size_t length);
+
+/**
+    Indexes the models, chains and atom records of a buffer in one
+    pass.
+
+    Chain ranges are the same as those found by
+    freesasa_pdb_buffer_chains(), except that they start and end at
+    atom records.
+
+    @param buffer The buffer.
+    @param options Bitfield, can be used to set
+      ::FREESASA_INCLUDE_HETATM.
+    @return The index, or NULL if input is invalid or malloc failure.
+ */
+struct pdb_index *
+freesasa_pdb_index_new(const struct pdb_buffer *buffer,
+                       int options);
+
+/**
+    Frees an index.
+
+    @param index The index, can be NULL.
+ */
+void freesasa_pdb_index_free(struct pdb_index *index);
+
+/**
+    Number of models in an index (at least 1).
+
+    @param index The index.
+    @return The number of models.
+ */
+static inline int
+freesasa_pdb_index_n_models(const struct pdb_index *index)
+{
+    return index->n_models > 0 ? index->n_models : 1;
+}
+
+/**
+    Writes an index to a sidecar file.
+
+    @param output The file.
+    @param index The index.
+    @return ::FREESASA_SUCCESS, or ::FREESASA_FAIL if there were
+      problems writing.
+ */
+int freesasa_pdb_index_write(FILE *output,
+                             const struct pdb_index *index);
+
+/**
+    Reads an index from a sidecar file.
+
+    The index is checked against the buffer: the size and modification
+    time of the file have to match, and the ranges have to begin at
+    the right type of records. No error messages are printed if the
+    index doesn't match, it is then simply out of date.
+
+    @param input The sidecar file.
+    @param buffer The buffer to check the index against.
+    @param options Bitfield, the index has to have been built with the
+      same value of ::FREESASA_INCLUDE_HETATM.
+    @return The index, or NULL if it doesn't match the buffer, can't
+      be read or malloc failure.
+ */
+struct pdb_index *
+freesasa_pdb_index_read(FILE *input,
+                        const struct pdb_buffer *buffer,
+                        int options);
+
 /**
     Finds the location of all MODEL entries in the file pdb, returns
     the number of models found.
@@ -184,4 +471,8 @@ int freesasa_pdb_get_bfactor(double *bfac,
  */
 int freesasa_pdb_ishydrogen(const char *line);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* FREESASA_PDB_H */
@@ -0,0 +1,524 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if USE_THREADS
+#include <pthread.h>
+#define MAX_POSE_THREADS 16
+#else
+#define MAX_POSE_THREADS 1
+#endif
+
+#include "freesasa_internal.h"
+#include "nb.h"
+
+/**
+   A receptor is preprocessed once: its coordinates, a neighbor list
+   for receptor-receptor contacts, a grid for finding receptor atoms
+   close to a ligand, and the SASA of the isolated receptor. When a
+   ligand pose is scored only the receptor atoms that are in contact
+   with the ligand (and the ligand atoms) need to be recalculated,
+   together with the receptor atoms that shield them, all other
+   receptor atoms keep their preprocessed SASA.
+ */
+struct freesasa_receptor {
+    int n_atoms;
+    coord_t *xyz;
+    double *radii;     /* without probe */
+    double *sasa;      /* SASA of isolated receptor */
+    double total;      /* total SASA of isolated receptor */
+    double max_radius; /* largest radius, including probe */
+    nb_list *nb;       /* receptor-receptor contacts */
+    freesasa_parameters parameters;
+
+    /* grid, atoms sorted by cell */
+    double d;        /* cell size */
+    double min[3];   /* lower corner of grid */
+    int nx, ny, nz;  /* number of cells along each axis */
+    int *cell_start; /* cell_atom[cell_start[c]] is first atom in cell c */
+    int *cell_atom;
+};
+
+/* scoring data for a range of poses (one per thread) */
+typedef struct {
+    const freesasa_receptor *receptor;
+    const double *ligand_xyz;
+    const double *ligand_radii;
+    int n_ligand;
+    const double *transforms;
+    int first_pose, last_pose; /* last_pose not included */
+    double *complex_sasa;
+    double *buried_area;
+    int return_value;
+} pose_batch;
+
+#if USE_THREADS
+static int pose_do_threads(int n_threads, const pose_batch *batch, int n_poses);
+static void *pose_thread(void *arg);
+#endif
+
+static int
+grid_coordinate(const freesasa_receptor *receptor,
+                double x,
+                int axis,
+                int n)
+{
+    int i = (int)floor((x - receptor->min[axis]) / receptor->d);
+    if (i < 0) return 0;
+    if (i >= n) return n - 1;
+    return i;
+}
+
+static int
+grid_cell(const freesasa_receptor *receptor,
+          const double *xyz)
+{
+    int ix = grid_coordinate(receptor, xyz[0], 0, receptor->nx),
+        iy = grid_coordinate(receptor, xyz[1], 1, receptor->ny),
+        iz = grid_coordinate(receptor, xyz[2], 2, receptor->nz);
+    return ix + receptor->nx * (iy + receptor->ny * iz);
+}
+
+/** Sorts the receptor atoms into cells with a counting sort */
+static int
+init_grid(freesasa_receptor *receptor)
+{
+    const int n = receptor->n_atoms;
+    const double *v = freesasa_coord_all(receptor->xyz);
+    double max[3];
+    int i, j, c, n_cells;
+    int *fill = NULL;
+
+    for (j = 0; j < 3; ++j) {
+        receptor->min[j] = max[j] = v[j];
+    }
+    for (i = 1; i < n; ++i) {
+        for (j = 0; j < 3; ++j) {
+            receptor->min[j] = fmin(receptor->min[j], v[3 * i + j]);
+            max[j] = fmax(max[j], v[3 * i + j]);
+        }
+    }
+
+    receptor->d = 2 * receptor->max_radius;
+    receptor->nx = (int)floor((max[0] - receptor->min[0]) / receptor->d) + 1;
+    receptor->ny = (int)floor((max[1] - receptor->min[1]) / receptor->d) + 1;
+    receptor->nz = (int)floor((max[2] - receptor->min[2]) / receptor->d) + 1;
+    n_cells = receptor->nx * receptor->ny * receptor->nz;
+
+    receptor->cell_start = calloc(n_cells + 1, sizeof(int));
+    receptor->cell_atom = malloc(sizeof(int) * n);
+    fill = calloc(n_cells, sizeof(int));
+    if (!receptor->cell_start || !receptor->cell_atom || !fill) {
+        free(fill);
+        return mem_fail();
+    }
+
+    for (i = 0; i < n; ++i) {
+        ++receptor->cell_start[grid_cell(receptor, v + 3 * i) + 1];
+    }
+    for (c = 0; c < n_cells; ++c) {
+        receptor->cell_start[c + 1] += receptor->cell_start[c];
+    }
+    for (i = 0; i < n; ++i) {
+        c = grid_cell(receptor, v + 3 * i);
+        receptor->cell_atom[receptor->cell_start[c] + fill[c]++] = i;
+    }
+
+    free(fill);
+    return FREESASA_SUCCESS;
+}
+
+freesasa_receptor *
+freesasa_receptor_new(const double *xyz,
+                      const double *radii,
+                      int n,
+                      const freesasa_parameters *parameters)
+{
+    freesasa_receptor *receptor;
+    freesasa_result *result = NULL;
+    double *r_probe = NULL;
+    int i;
+
+    assert(xyz);
+    assert(radii);
+
+    if (n <= 0) {
+        fail_msg("receptor has no atoms");
+        return NULL;
+    }
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    if (freesasa_parameters_box(parameters) != NULL) {
+        fail_msg("pose scoring does not support periodic boxes");
+        return NULL;
+    }
+
+    receptor = malloc(sizeof(freesasa_receptor));
+    if (receptor == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    receptor->n_atoms = n;
+    receptor->parameters = *parameters;
+    receptor->max_radius = 0;
+    receptor->xyz = NULL;
+    receptor->radii = NULL;
+    receptor->sasa = NULL;
+    receptor->nb = NULL;
+    receptor->cell_start = NULL;
+    receptor->cell_atom = NULL;
+
+    receptor->xyz = freesasa_coord_new();
+    receptor->radii = malloc(sizeof(double) * n);
+    r_probe = malloc(sizeof(double) * n);
+    if (receptor->xyz == NULL || receptor->radii == NULL || r_probe == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    if (freesasa_coord_append(receptor->xyz, xyz, n)) goto cleanup;
+
+    memcpy(receptor->radii, radii, sizeof(double) * n);
+    for (i = 0; i < n; ++i) {
+        r_probe[i] = radii[i] + parameters->probe_radius;
+        receptor->max_radius = fmax(receptor->max_radius, r_probe[i]);
+    }
+
+    receptor->nb = freesasa_nb_new(receptor->xyz, r_probe);
+    if (receptor->nb == NULL) goto cleanup;
+
+    if (init_grid(receptor)) goto cleanup;
+
+    result = freesasa_calc(receptor->xyz, receptor->radii, parameters);
+    if (result == NULL) goto cleanup;
+
+    /* steal the array */
+    receptor->sasa = result->sasa;
+    receptor->total = result->total;
+    result->sasa = NULL;
+    freesasa_result_free(result);
+    free(r_probe);
+
+    return receptor;
+
+cleanup:
+    fail_msg("");
+    free(r_probe);
+    freesasa_receptor_free(receptor);
+    return NULL;
+}
+
+void freesasa_receptor_free(freesasa_receptor *receptor)
+{
+    if (receptor) {
+        freesasa_coord_free(receptor->xyz);
+        freesasa_nb_free(receptor->nb);
+        free(receptor->radii);
+        free(receptor->sasa);
+        free(receptor->cell_start);
+        free(receptor->cell_atom);
+        free(receptor);
+    }
+}
+
+double
+freesasa_receptor_area(const freesasa_receptor *receptor)
+{
+    assert(receptor);
+    return receptor->total;
+}
+
+/** Applies the rigid transform t (rotation matrix followed by translation) */
+static void
+transform_ligand(double *out,
+                 const double *xyz,
+                 int n,
+                 const double *t)
+{
+    int i;
+    const double *p;
+
+    for (i = 0; i < n; ++i) {
+        p = xyz + 3 * i;
+        out[3 * i] = t[0] * p[0] + t[1] * p[1] + t[2] * p[2] + t[9];
+        out[3 * i + 1] = t[3] * p[0] + t[4] * p[1] + t[5] * p[2] + t[10];
+        out[3 * i + 2] = t[6] * p[0] + t[7] * p[1] + t[8] * p[2] + t[11];
+    }
+}
+
+/**
+    Finds the receptor atoms in contact with a ligand. They are
+    appended to `subset`, and marked with `stamp`. Returns the number
+    of atoms found.
+ */
+static int
+find_interface(const freesasa_receptor *receptor,
+               const double *lig,
+               const double *lig_radii,
+               int n_ligand,
+               int *subset,
+               int *mark,
+               int stamp)
+{
+    const double *v = freesasa_coord_all(receptor->xyz);
+    const double probe = receptor->parameters.probe_radius;
+    const double d = receptor->d;
+    int n = 0, i, j, k, ix, iy, iz, cell, reach;
+    int x1, x2, y1, y2, z1, z2;
+    double rl, cut, dx, dy, dz;
+    const double *p;
+
+    for (i = 0; i < n_ligand; ++i) {
+        p = lig + 3 * i;
+        rl = lig_radii[i] + probe;
+        reach = (int)ceil((rl + receptor->max_radius) / d);
+
+        /* skip ligand atoms that can't reach the grid */
+        ix = (int)floor((p[0] - receptor->min[0]) / d);
+        iy = (int)floor((p[1] - receptor->min[1]) / d);
+        iz = (int)floor((p[2] - receptor->min[2]) / d);
+        x1 = ix - reach > 0 ? ix - reach : 0;
+        y1 = iy - reach > 0 ? iy - reach : 0;
+        z1 = iz - reach > 0 ? iz - reach : 0;
+        x2 = ix + reach < receptor->nx - 1 ? ix + reach : receptor->nx - 1;
+        y2 = iy + reach < receptor->ny - 1 ? iy + reach : receptor->ny - 1;
+        z2 = iz + reach < receptor->nz - 1 ? iz + reach : receptor->nz - 1;
+
+        for (iz = z1; iz <= z2; ++iz) {
+            for (iy = y1; iy <= y2; ++iy) {
+                for (ix = x1; ix <= x2; ++ix) {
+                    cell = ix + receptor->nx * (iy + receptor->ny * iz);
+                    for (k = receptor->cell_start[cell]; k < receptor->cell_start[cell + 1]; ++k) {
+                        j = receptor->cell_atom[k];
+                        if (mark[j] == stamp) continue;
+                        cut = rl + receptor->radii[j] + probe;
+                        dx = v[3 * j] - p[0];
+                        dy = v[3 * j + 1] - p[1];
+                        dz = v[3 * j + 2] - p[2];
+                        if (dx * dx + dy * dy + dz * dz < cut * cut) {
+                            mark[j] = stamp;
+                            subset[n++] = j;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return n;
+}
+
+/**
+    Scores the poses in a batch.
+
+    For each pose the SASA is calculated for a subsystem consisting
+    of the ligand, the receptor atoms in contact with it and their
+    receptor neighbors. Only the SASA of the ligand and the interface
+    atoms is used, the surrounding receptor atoms are only there to
+    occlude them as they would in the full complex.
+ */
+static int
+score_batch(pose_batch *batch)
+{
+    const freesasa_receptor *receptor = batch->receptor;
+    const int n_rec = receptor->n_atoms, n_lig = batch->n_ligand;
+    const double *v = freesasa_coord_all(receptor->xyz);
+    freesasa_parameters param = receptor->parameters;
+    freesasa_result *complex = NULL, *ligand = NULL;
+    double *lig = NULL, *sub_xyz = NULL, *sub_r = NULL;
+    int *subset = NULL, *mark = NULL;
+    int pose, n_interface, n_sub, i, j, k;
+    double area;
+
+    param.n_threads = 1;
+
+    lig = malloc(sizeof(double) * 3 * n_lig);
+    sub_xyz = malloc(sizeof(double) * 3 * (n_rec + n_lig));
+    sub_r = malloc(sizeof(double) * (n_rec + n_lig));
+    subset = malloc(sizeof(int) * n_rec);
+    mark = malloc(sizeof(int) * n_rec);
+
+    if (!lig || !sub_xyz || !sub_r || !subset || !mark) {
+        batch->return_value = mem_fail();
+        goto cleanup;
+    }
+
+    for (i = 0; i < n_rec; ++i) {
+        mark[i] = -1;
+    }
+
+    for (pose = batch->first_pose; pose < batch->last_pose; ++pose) {
+        transform_ligand(lig, batch->ligand_xyz, n_lig, batch->transforms + 12 * pose);
+
+        n_interface = find_interface(receptor, lig, batch->ligand_radii, n_lig,
+                                     subset, mark, pose);
+
+        /* add the atoms that shield the interface atoms */
+        n_sub = n_interface;
+        for (i = 0; i < n_interface; ++i) {
+            for (k = 0; k < receptor->nb->nn[subset[i]]; ++k) {
+                j = receptor->nb->nb[subset[i]][k];
+                if (mark[j] != pose) {
+                    mark[j] = pose;
+                    subset[n_sub++] = j;
+                }
+            }
+        }
+
+        for (i = 0; i < n_sub; ++i) {
+            memcpy(sub_xyz + 3 * i, v + 3 * subset[i], sizeof(double) * 3);
+            sub_r[i] = receptor->radii[subset[i]];
+        }
+        memcpy(sub_xyz + 3 * n_sub, lig, sizeof(double) * 3 * n_lig);
+        memcpy(sub_r + n_sub, batch->ligand_radii, sizeof(double) * n_lig);
+
+        ligand = freesasa_calc_coord(lig, batch->ligand_radii, n_lig, &param);
+        if (ligand == NULL) {
+            batch->return_value = fail_msg("");
+            goto cleanup;
+        }
+
+        area = receptor->total;
+        if (n_interface == 0) {
+            /* no contact, nothing is buried */
+            area += ligand->total;
+        } else {
+            complex = freesasa_calc_coord(sub_xyz, sub_r, n_sub + n_lig, &param);
+            if (complex == NULL) {
+                batch->return_value = fail_msg("");
+                goto cleanup;
+            }
+            for (i = 0; i < n_interface; ++i) {
+                area += complex->sasa[i] - receptor->sasa[subset[i]];
+            }
+            for (i = 0; i < n_lig; ++i) {
+                area += complex->sasa[n_sub + i];
+            }
+        }
+
+        batch->complex_sasa[pose] = area;
+        batch->buried_area[pose] = receptor->total + ligand->total - area;
+
+        freesasa_result_free(complex);
+        freesasa_result_free(ligand);
+        complex = ligand = NULL;
+    }
+
+cleanup:
+    freesasa_result_free(complex);
+    freesasa_result_free(ligand);
+    free(lig);
+    free(sub_xyz);
+    free(sub_r);
+    free(subset);
+    free(mark);
+
+    return batch->return_value;
+}
+
+int freesasa_receptor_score_poses(const freesasa_receptor *receptor,
+                                  const double *ligand_xyz,
+                                  const double *ligand_radii,
+                                  int n_ligand,
+                                  const double *transforms,
+                                  int n_poses,
+                                  double *complex_sasa,
+                                  double *buried_area)
+{
+    pose_batch batch;
+    int n_threads;
+
+    assert(receptor);
+    assert(ligand_xyz);
+    assert(ligand_radii);
+    assert(transforms);
+    assert(complex_sasa);
+    assert(buried_area);
+
+    if (n_ligand <= 0) return fail_msg("ligand has no atoms");
+    if (n_poses <= 0) return freesasa_warn("in %s(): no poses to score", __func__);
+
+    n_threads = receptor->parameters.n_threads;
+    if (n_threads > MAX_POSE_THREADS) {
+        return fail_msg("pose scoring does not support more than %d threads", MAX_POSE_THREADS);
+    }
+    if (n_threads > n_poses) n_threads = n_poses;
+
+    batch.receptor = receptor;
+    batch.ligand_xyz = ligand_xyz;
+    batch.ligand_radii = ligand_radii;
+    batch.n_ligand = n_ligand;
+    batch.transforms = transforms;
+    batch.first_pose = 0;
+    batch.last_pose = n_poses;
+    batch.complex_sasa = complex_sasa;
+    batch.buried_area = buried_area;
+    batch.return_value = FREESASA_SUCCESS;
+
+    if (n_threads > 1) {
+#if USE_THREADS
+        return pose_do_threads(n_threads, &batch, n_poses);
+#else
+        freesasa_warn("in %s(): program compiled for single-threaded use, "
+                      "but multiple threads were requested, will "
+                      "proceed in single-threaded mode\n",
+                      __func__);
+#endif
+    }
+
+    return score_batch(&batch);
+}
+
+#if USE_THREADS
+static int
+pose_do_threads(int n_threads,
+                const pose_batch *batch,
+                int n_poses)
+{
+    pthread_t thread[MAX_POSE_THREADS];
+    pose_batch bt[MAX_POSE_THREADS];
+    int block_size = n_poses / n_threads;
+    int res, return_value = FREESASA_SUCCESS;
+    int threads_created = 0, t;
+
+    /* divide poses evenly over threads */
+    for (t = 0; t < n_threads; ++t) {
+        bt[t] = *batch;
+        bt[t].first_pose = t * block_size;
+        if (t == n_threads - 1)
+            bt[t].last_pose = n_poses;
+        else
+            bt[t].last_pose = (t + 1) * block_size;
+        res = pthread_create(&thread[t], NULL, pose_thread, (void *)&bt[t]);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+            break;
+        }
+        ++threads_created;
+    }
+    for (t = 0; t < threads_created; ++t) {
+        res = pthread_join(thread[t], NULL);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+        }
+        if (bt[t].return_value == FREESASA_FAIL) {
+            return_value = FREESASA_FAIL;
+        }
+    }
+    return return_value;
+}
+
+static void *
+pose_thread(void *arg)
+{
+    /* each thread writes to its own range of poses */
+    score_batch((pose_batch *)arg);
+    pthread_exit(NULL);
+}
+#endif /* USE_THREADS */
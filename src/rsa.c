@@ -59,7 +59,9 @@ rsa_print_abs_rel(FILE *output,
                   double abs,
                   double rel)
 {
-    fprintf(output, "%7.2f", abs);
+    char buf[32];
+
+    fprintf(output, "%s", freesasa_area_str(buf, abs, 7, 2));
     if (isfinite(rel))
         fprintf(output, "%6.1f", rel);
     else
@@ -70,10 +72,26 @@ static inline void
 rsa_print_abs_only(FILE *output,
                    double abs)
 {
-    fprintf(output, "%7.2f", abs);
+    char buf[32];
+
+    fprintf(output, "%s", freesasa_area_str(buf, abs, 7, 2));
     fprintf(output, "   N/A");
 }
 
+/* The columns of the CHAIN and TOTAL lines */
+static void
+rsa_print_sums(FILE *output,
+               const freesasa_nodearea *abs)
+{
+    char buf[32];
+
+    fprintf(output, " %s", freesasa_area_str(buf, abs->total, 10, 1));
+    fprintf(output, "   %s", freesasa_area_str(buf, abs->side_chain, 10, 1));
+    fprintf(output, "   %s", freesasa_area_str(buf, abs->main_chain, 10, 1));
+    fprintf(output, "   %s", freesasa_area_str(buf, abs->apolar, 10, 1));
+    fprintf(output, "   %s\n", freesasa_area_str(buf, abs->polar, 10, 1));
+}
+
 static int
 rsa_print_residue(FILE *output,
                   int iaa,
@@ -152,9 +170,8 @@ int freesasa_write_rsa(FILE *output,
         const char *name = freesasa_node_name(chain);
         abs = freesasa_node_area(chain);
 
-        fprintf(output, "CHAIN%3d %c %10.1f   %10.1f   %10.1f   %10.1f   %10.1f\n",
-                chain_index + 1, name[0], abs->total, abs->side_chain,
-                abs->main_chain, abs->apolar, abs->polar);
+        fprintf(output, "CHAIN%3d %c", chain_index + 1, name[0]);
+        rsa_print_sums(output, abs);
 
         ++chain_index;
         chain = freesasa_node_next(chain);
@@ -162,8 +179,8 @@ int freesasa_write_rsa(FILE *output,
 
     abs = freesasa_node_area(structure_node);
     fprintf(output, "END  Absolute sums over all chains\n");
-    fprintf(output, "TOTAL      %10.1f   %10.1f   %10.1f   %10.1f   %10.1f\n",
-            abs->total, abs->side_chain, abs->main_chain, abs->apolar, abs->polar);
+    fprintf(output, "TOTAL     ");
+    rsa_print_sums(output, abs);
 
     fflush(output);
     if (ferror(output)) {
@@ -27,9 +27,12 @@ const double TWOPI = 2 * M_PI;
 /* calculation parameters and data (results stored in *sasa) */
 typedef struct {
     int n_atoms;
+    int n_calc;    /* number of atoms to calculate SASA for */
+    int *atom;     /* atoms to calculate SASA for, NULL means all */
     double *radii; /* including probe */
     const coord_t *xyz;
     nb_list *adj;
+    int periodic; /* if the neighbor list is for a periodic box */
     int n_slices_per_atom;
     double *sasa; /* results */
     double *arc[MAX_LR_THREADS], *z_nb[MAX_LR_THREADS], *R_nb[MAX_LR_THREADS];
@@ -37,7 +40,7 @@ typedef struct {
 } lr_data;
 
 typedef struct {
-    int first_atom;
+    int first_atom; /* indices in lr->atom if not NULL */
     int last_atom;
     int thread_id;
     lr_data *lr;
@@ -48,6 +51,10 @@ static int lr_do_threads(int n_threads, lr_data *);
 static void *lr_thread(void *arg);
 #endif
 
+/** Calculates the area of all atoms in lr, using threads if requested */
+static int
+lr_run(lr_data *lr, int n_threads);
+
 /** Returns the are of atom i */
 static double
 atom_area(lr_data *lr, int i, int thread_id);
@@ -64,8 +71,10 @@ release_lr(lr_data *lr)
     int i;
 
     free(lr->radii);
+    free(lr->atom);
     freesasa_nb_free(lr->adj);
     lr->radii = NULL;
+    lr->atom = NULL;
     lr->adj = NULL;
 
     for (i = 0; i < lr->n_threads; ++i) {
@@ -100,12 +109,17 @@ alloc_lr_calc_arrays(lr_data *lr, int n_threads)
     return FREESASA_SUCCESS;
 }
 
-/** Initialize object to be used for L&R calculation */
+/** Initialize object to be used for L&R calculation. If base is
+    not NULL, the neighbor list is obtained by filtering it instead of
+    being calculated from scratch. */
 static int
 init_lr(lr_data *lr,
         double *sasa,
         const coord_t *xyz,
         const double *atom_radii,
+        const int *target,
+        const nb_list *base,
+        const double *box,
         double probe_radius,
         int n_slices_per_atom,
         int n_threads)
@@ -114,8 +128,11 @@ init_lr(lr_data *lr,
     int i;
 
     lr->n_atoms = n_atoms;
+    lr->n_calc = n_atoms;
+    lr->atom = NULL;
     lr->xyz = xyz;
     lr->adj = NULL;
+    lr->periodic = box != NULL;
     lr->n_slices_per_atom = n_slices_per_atom;
     lr->sasa = sasa;
     lr->n_threads = n_threads;
@@ -137,8 +154,23 @@ init_lr(lr_data *lr,
         sasa[i] = 0.;
     }
 
+    if (target != NULL) {
+        lr->atom = malloc(sizeof(int) * n_atoms);
+        if (lr->atom == NULL) {
+            release_lr(lr);
+            return mem_fail();
+        }
+        lr->n_calc = 0;
+        for (i = 0; i < n_atoms; ++i) {
+            if (target[i]) lr->atom[lr->n_calc++] = i;
+        }
+    }
+
     /* determine which atoms are neighbours */
-    lr->adj = freesasa_nb_new(xyz, lr->radii);
+    if (base != NULL)
+        lr->adj = freesasa_nb_filter(base, lr->radii);
+    else
+        lr->adj = freesasa_nb_new_subset(xyz, lr->radii, target, box);
 
     if (lr->adj == NULL) {
         release_lr(lr);
@@ -156,9 +188,10 @@ init_lr(lr_data *lr,
 int freesasa_lee_richards(double *sasa,
                           const coord_t *xyz,
                           const double *atom_radii,
+                          const int *target,
                           const freesasa_parameters *param)
 {
-    int return_value, n_atoms, n_threads, resolution, i;
+    int return_value, n_atoms, n_threads, resolution;
     double probe_radius;
     lr_data lr;
 
@@ -192,12 +225,97 @@ int freesasa_lee_richards(double *sasa,
                       n_threads);
     }
 
-    if (init_lr(&lr, sasa, xyz, atom_radii, probe_radius, resolution, n_threads))
+    if (init_lr(&lr, sasa, xyz, atom_radii, target, NULL, freesasa_parameters_box(param),
+                probe_radius, resolution, n_threads))
         return FREESASA_FAIL;
 
+    return_value = lr_run(&lr, n_threads);
+
+    release_lr(&lr);
+    return return_value;
+}
+
+int freesasa_lee_richards_sweep(double *sasa,
+                                const coord_t *xyz,
+                                const double *atom_radii,
+                                const double *probes,
+                                int n_probes,
+                                const freesasa_parameters *param)
+{
+    int return_value, n_atoms, n_threads, resolution, i, p;
+    double max_probe, *r_max = NULL;
+    nb_list *base = NULL;
+    lr_data lr;
+
+    assert(sasa);
+    assert(xyz);
+    assert(atom_radii);
+    assert(probes);
+    assert(n_probes > 0);
+
+    if (param == NULL) param = &freesasa_default_parameters;
+
+    return_value = FREESASA_SUCCESS;
+    n_atoms = freesasa_coord_n(xyz);
+    n_threads = param->n_threads;
+    resolution = param->lee_richards_n_slices;
+
+    if (n_threads > MAX_LR_THREADS) {
+        return fail_msg("L&R does not support more than %d threads", MAX_LR_THREADS);
+    }
+
+    if (resolution <= 0) {
+        return fail_msg("%f slices per atom invalid resolution in L&R, must be > 0\n", resolution);
+    }
+
+    if (n_atoms == 0) {
+        return freesasa_warn("in %s(): empty coordinates", __func__);
+    }
+
+    if (n_threads > n_atoms) n_threads = n_atoms;
+
+    /* the neighbor list for the largest probe contains all the
+       contacts for the smaller ones */
+    max_probe = probes[0];
+    for (p = 1; p < n_probes; ++p) {
+        if (probes[p] > max_probe) max_probe = probes[p];
+    }
+
+    r_max = malloc(sizeof(double) * n_atoms);
+    if (r_max == NULL) return mem_fail();
+    for (i = 0; i < n_atoms; ++i) {
+        r_max[i] = atom_radii[i] + max_probe;
+    }
+    base = freesasa_nb_new_subset(xyz, r_max, NULL, freesasa_parameters_box(param));
+    free(r_max);
+    if (base == NULL) return fail_msg("");
+
+    for (p = 0; p < n_probes; ++p) {
+        if (init_lr(&lr, sasa + p * n_atoms, xyz, atom_radii, NULL, base,
+                    freesasa_parameters_box(param), probes[p], resolution, n_threads)) {
+            return_value = FREESASA_FAIL;
+            break;
+        }
+        if (lr_run(&lr, n_threads) == FREESASA_FAIL) return_value = FREESASA_FAIL;
+        release_lr(&lr);
+        if (return_value == FREESASA_FAIL) break;
+    }
+
+    freesasa_nb_free(base);
+    return return_value;
+}
+
+static int
+lr_run(lr_data *lr,
+       int n_threads)
+{
+    int return_value = FREESASA_SUCCESS, i, k;
+
+    if (n_threads > lr->n_calc && lr->n_calc > 0) n_threads = lr->n_calc;
+
     if (n_threads > 1) {
 #if USE_THREADS
-        return_value = lr_do_threads(n_threads, &lr);
+        return_value = lr_do_threads(n_threads, lr);
 #else
         return_value = freesasa_warn("in %s(): program compiled for single-threaded use, "
                                      "but multiple threads were requested, will "
@@ -207,11 +325,11 @@ int freesasa_lee_richards(double *sasa,
 #endif /* pthread */
     }
     if (n_threads == 1) {
-        for (i = 0; i < lr.n_atoms; ++i) {
-            lr.sasa[i] = atom_area(&lr, i, 0);
+        for (k = 0; k < lr->n_calc; ++k) {
+            i = lr->atom ? lr->atom[k] : k;
+            lr->sasa[i] = atom_area(lr, i, 0);
         }
     }
-    release_lr(&lr);
     return return_value;
 }
 
@@ -222,14 +340,14 @@ lr_do_threads(int n_threads,
 {
     pthread_t thread[MAX_LR_THREADS];
     lr_thread_interval t_data[MAX_LR_THREADS];
-    int n_perthread = lr->n_atoms / n_threads, res;
+    int n_perthread = lr->n_calc / n_threads, res;
     int threads_created = 0, return_value = FREESASA_SUCCESS;
     int t;
 
     for (t = 0; t < n_threads; ++t) {
         t_data[t].first_atom = t * n_perthread;
         if (t == n_threads - 1) {
-            t_data[t].last_atom = lr->n_atoms - 1;
+            t_data[t].last_atom = lr->n_calc - 1;
         } else {
             t_data[t].last_atom = (t + 1) * n_perthread - 1;
         }
@@ -255,10 +373,11 @@ lr_do_threads(int n_threads,
 static void *
 lr_thread(void *arg)
 {
-    int i;
+    int i, k;
     lr_thread_interval *ti = ((lr_thread_interval *)arg);
 
-    for (i = ti->first_atom; i <= ti->last_atom; ++i) {
+    for (k = ti->first_atom; k <= ti->last_atom; ++k) {
+        i = ti->lr->atom ? ti->lr->atom[k] : k;
         /* the different threads write to different parts of the
            array, so locking shouldn't be necessary */
         ti->lr->sasa[i] = atom_area(ti->lr, i, ti->thread_id);
@@ -297,7 +416,8 @@ atom_area(lr_data *lr,
     double zj, di, dj, dij, Rj, Ri_prime2, Ri_prime, Rj_prime2, Rj_prime;
 
     for (j = 0; j < nni; ++j) {
-        z_nb[j] = v[3 * nbi[j] + 2];
+        /* in a periodic box, the nearest image */
+        z_nb[j] = lr->periodic ? zi + lr->adj->zd[i][j] : v[3 * nbi[j] + 2];
         R_nb[j] = R[nbi[j]];
     }
 
@@ -29,9 +29,11 @@
 
 /* calculation parameters (results stored in *sasa) */
 typedef struct {
-    int i1, i2; /* for multithreading, range of atoms */
+    int i1, i2; /* for multithreading, range of atoms (indices in atom if not NULL) */
     int thread_index;
     int n_atoms;
+    int n_calc; /* number of atoms to calculate SASA for */
+    int *atom;  /* atoms to calculate SASA for, NULL means all */
     int n_points;
     int n_threads;
     double probe_radius;
@@ -39,10 +41,21 @@ typedef struct {
     coord_t *srp;                      /* test-points */
     coord_t *tp_local[MAX_SR_THREADS]; /* coord object for storing intermediates */
     int *spcount[MAX_SR_THREADS];
+    const double *radii; /* without probe */
     double *r;
     double *r2;
     nb_list *nb;
+    const double *box;                 /* periodic box, NULL if not periodic */
+    double *nb_xyz[MAX_SR_THREADS];    /* positions of the neighbors of the current atom */
+    double *nb_r2[MAX_SR_THREADS];     /* and their squared radii */
+    int max_nn;                        /* largest number of neighbors of any atom */
     double *sasa;
+    /* for probe radius sweeps (n_probes == 0 for regular calculations) */
+    int n_probes;
+    const double *probes;
+    double *nb_key[MAX_SR_THREADS]; /* neighbors sorted by the probe radius needed for contact */
+    int *nb_order[MAX_SR_THREADS];
+    int *n_surface[MAX_SR_THREADS]; /* exposed test points per probe */
 } sr_data;
 
 #if USE_THREADS
@@ -51,7 +64,10 @@ static void *sr_thread(void *arg);
 #endif
 
 static double
-sr_atom_area(int i, const sr_data *sr, int thread_index) __attrib_pure__;
+sr_atom_area(int i, const sr_data *sr, int thread_index);
+
+static void
+sr_atom_area_sweep(int i, const sr_data *sr, int thread_index);
 
 static coord_t *
 test_points(int N)
@@ -96,12 +112,18 @@ void release_sr(sr_data *sr)
 
     freesasa_coord_free(sr->srp);
     freesasa_nb_free(sr->nb);
+    free(sr->atom);
     free(sr->r);
     free(sr->r2);
 
     for (i = 0; i < sr->n_threads; ++i) {
         freesasa_coord_free(sr->tp_local[i]);
         free(sr->spcount[i]);
+        free(sr->nb_key[i]);
+        free(sr->nb_order[i]);
+        free(sr->n_surface[i]);
+        free(sr->nb_xyz[i]);
+        free(sr->nb_r2[i]);
     }
 }
 
@@ -109,6 +131,8 @@ int init_sr(sr_data *sr,
             double *sasa,
             const coord_t *xyz,
             const double *r,
+            const int *target,
+            const double *box,
             double probe_radius,
             int n_points,
             int n_threads)
@@ -127,12 +151,23 @@ int init_sr(sr_data *sr,
     sr->xyz = xyz;
     sr->srp = srp;
     sr->sasa = sasa;
+    sr->radii = r;
+    sr->box = box;
     sr->nb = NULL;
+    sr->atom = NULL;
+    sr->n_calc = n_atoms;
+    sr->n_probes = 0;
+    sr->probes = NULL;
 
     /* should be done before any mallocs (to avoid problems in potential cleanup) */
     for (i = 0; i < n_threads; ++i) {
         sr->tp_local[i] = NULL;
         sr->spcount[i] = NULL;
+        sr->nb_key[i] = NULL;
+        sr->nb_order[i] = NULL;
+        sr->n_surface[i] = NULL;
+        sr->nb_xyz[i] = NULL;
+        sr->nb_r2[i] = NULL;
     }
 
     sr->r = malloc(sizeof(double) * n_atoms);
@@ -140,6 +175,15 @@ int init_sr(sr_data *sr,
 
     if (sr->r == NULL || sr->r2 == NULL) goto cleanup;
 
+    if (target != NULL) {
+        sr->atom = malloc(sizeof(int) * n_atoms);
+        if (sr->atom == NULL) goto cleanup;
+        sr->n_calc = 0;
+        for (i = 0; i < n_atoms; ++i) {
+            if (target[i]) sr->atom[sr->n_calc++] = i;
+        }
+    }
+
     for (i = 0; i < n_atoms; ++i) {
         ri = r[i] + probe_radius;
         sr->r[i] = ri;
@@ -155,8 +199,21 @@ int init_sr(sr_data *sr,
     }
 
     /* calculate distances */
-    sr->nb = freesasa_nb_new(xyz, sr->r);
-    if (sr->nb == NULL) goto cleanup;
+    sr->nb = freesasa_nb_new_subset(xyz, sr->r, target, box);
+    if (sr->nb == NULL) {
+        release_sr(sr);
+        return fail_msg("");
+    }
+
+    sr->max_nn = 1;
+    for (i = 0; i < n_atoms; ++i) {
+        if (sr->nb->nn[i] > sr->max_nn) sr->max_nn = sr->nb->nn[i];
+    }
+    for (i = 0; i < n_threads; ++i) {
+        sr->nb_xyz[i] = malloc(sizeof(double) * 3 * sr->max_nn);
+        sr->nb_r2[i] = malloc(sizeof(double) * sr->max_nn);
+        if (sr->nb_xyz[i] == NULL || sr->nb_r2[i] == NULL) goto cleanup;
+    }
 
     return FREESASA_SUCCESS;
 
@@ -168,9 +225,10 @@ cleanup:
 int freesasa_shrake_rupley(double *sasa,
                            const coord_t *xyz,
                            const double *r,
+                           const int *target,
                            const freesasa_parameters *param)
 {
-    int i, n_atoms, n_threads = param->n_threads, resolution, return_value;
+    int i, k, n_atoms, n_threads = param->n_threads, resolution, return_value;
     double probe_radius = param->probe_radius;
     sr_data sr;
 
@@ -198,9 +256,12 @@ int freesasa_shrake_rupley(double *sasa,
                       n_threads);
     }
 
-    if (init_sr(&sr, sasa, xyz, r, probe_radius, resolution, n_threads))
+    if (init_sr(&sr, sasa, xyz, r, target, freesasa_parameters_box(param),
+                probe_radius, resolution, n_threads))
         return FREESASA_FAIL;
 
+    if (n_threads > sr.n_calc && sr.n_calc > 0) n_threads = sr.n_calc;
+
     /* calculate SASA */
     if (n_threads > 1) {
 #if USE_THREADS
@@ -215,7 +276,8 @@ int freesasa_shrake_rupley(double *sasa,
     }
     if (n_threads == 1) {
         /* don't want the overhead of generating threads if only one is used */
-        for (i = 0; i < n_atoms; ++i) {
+        for (k = 0; k < sr.n_calc; ++k) {
+            i = sr.atom ? sr.atom[k] : k;
             sasa[i] = sr_atom_area(i, &sr, 0);
         }
     }
@@ -223,6 +285,82 @@ int freesasa_shrake_rupley(double *sasa,
     return return_value;
 }
 
+int freesasa_shrake_rupley_sweep(double *sasa,
+                                 const coord_t *xyz,
+                                 const double *r,
+                                 const double *probes,
+                                 int n_probes,
+                                 const freesasa_parameters *param)
+{
+    int i, n_atoms, n_threads, resolution, return_value;
+    double max_probe;
+    sr_data sr;
+
+    assert(sasa);
+    assert(xyz);
+    assert(r);
+    assert(probes);
+    assert(n_probes > 0);
+
+    if (param == NULL) param = &freesasa_default_parameters;
+
+    n_atoms = freesasa_coord_n(xyz);
+    n_threads = param->n_threads;
+    resolution = param->shrake_rupley_n_points;
+    return_value = FREESASA_SUCCESS;
+
+    if (n_threads > MAX_SR_THREADS) {
+        return fail_msg("S&R does not support more than %d threads", MAX_SR_THREADS);
+    }
+    if (resolution <= 0) {
+        return fail_msg("%f test points invalid resolution in S&R, must be > 0\n", resolution);
+    }
+    if (n_atoms == 0) return freesasa_warn("in %s(): empty coordinates", __func__);
+    if (n_threads > n_atoms) n_threads = n_atoms;
+
+    /* the neighbor list for the largest probe contains the neighbors for all the others */
+    max_probe = probes[0];
+    for (i = 1; i < n_probes; ++i) {
+        if (probes[i] > max_probe) max_probe = probes[i];
+    }
+
+    if (init_sr(&sr, sasa, xyz, r, NULL, freesasa_parameters_box(param),
+                max_probe, resolution, n_threads))
+        return FREESASA_FAIL;
+
+    sr.n_probes = n_probes;
+    sr.probes = probes;
+
+    for (i = 0; i < n_threads; ++i) {
+        sr.nb_key[i] = malloc(sizeof(double) * sr.max_nn);
+        sr.nb_order[i] = malloc(sizeof(int) * sr.max_nn);
+        sr.n_surface[i] = malloc(sizeof(int) * n_probes);
+        if (sr.nb_key[i] == NULL || sr.nb_order[i] == NULL || sr.n_surface[i] == NULL) {
+            release_sr(&sr);
+            return mem_fail();
+        }
+    }
+
+    if (n_threads > 1) {
+#if USE_THREADS
+        return_value = sr_do_threads(n_threads, &sr);
+#else
+        return_value = freesasa_warn("in %s(): program compiled for single-threaded use, "
+                                     "but multiple threads were requested, will "
+                                     "proceed in single-threaded mode\n",
+                                     __func__);
+        n_threads = 1;
+#endif
+    }
+    if (n_threads == 1) {
+        for (i = 0; i < n_atoms; ++i) {
+            sr_atom_area_sweep(i, &sr, 0);
+        }
+    }
+    release_sr(&sr);
+    return return_value;
+}
+
 #if USE_THREADS
 static int
 sr_do_threads(int n_threads,
@@ -230,7 +368,7 @@ sr_do_threads(int n_threads,
 {
     pthread_t thread[MAX_SR_THREADS];
     sr_data srt[MAX_SR_THREADS];
-    int thread_block_size = sr->n_atoms / n_threads;
+    int thread_block_size = sr->n_calc / n_threads;
     int res, return_value = FREESASA_SUCCESS;
     int threads_created = 0, t;
 
@@ -239,7 +377,7 @@ sr_do_threads(int n_threads,
         srt[t] = *sr;
         srt[t].i1 = t * thread_block_size;
         if (t == n_threads - 1)
-            srt[t].i2 = sr->n_atoms;
+            srt[t].i2 = sr->n_calc;
         else
             srt[t].i2 = (t + 1) * thread_block_size;
         srt[t].thread_index = t;
@@ -262,17 +400,55 @@ sr_do_threads(int n_threads,
 static void *
 sr_thread(void *arg)
 {
-    int i;
+    int i, k;
     sr_data *sr = ((sr_data *)arg);
 
-    for (i = sr->i1; i < sr->i2; ++i) {
+    for (k = sr->i1; k < sr->i2; ++k) {
+        i = sr->atom ? sr->atom[k] : k;
         /* mutex should not be necessary, writes to non-overlapping regions */
-        sr->sasa[i] = sr_atom_area(i, sr, sr->thread_index);
+        if (sr->n_probes > 0)
+            sr_atom_area_sweep(i, sr, sr->thread_index);
+        else
+            sr->sasa[i] = sr_atom_area(i, sr, sr->thread_index);
     }
     pthread_exit(NULL);
 }
 #endif
 
+/**
+    Copies the positions and squared radii of the neighbors of atom i
+    to contiguous per-thread arrays. In a periodic box the positions
+    are those of the nearest images.
+ */
+static void
+sr_gather_nb(int i,
+             const sr_data *sr,
+             int thread_index)
+{
+    const nb_list *nb = sr->nb;
+    const int nni = nb->nn[i];
+    const int *restrict nbi = nb->nb[i];
+    const double *restrict v = freesasa_coord_all(sr->xyz);
+    const double *restrict vi = v + 3 * i;
+    double *restrict w = sr->nb_xyz[thread_index];
+    double *restrict w_r2 = sr->nb_r2[thread_index];
+    int k, a;
+
+    for (k = 0; k < nni; ++k) {
+        a = nbi[k];
+        if (sr->box) {
+            w[3 * k] = vi[0] + nb->xd[i][k];
+            w[3 * k + 1] = vi[1] + nb->yd[i][k];
+            w[3 * k + 2] = vi[2] + nb->zd[i][k];
+        } else {
+            w[3 * k] = v[3 * a];
+            w[3 * k + 1] = v[3 * a + 1];
+            w[3 * k + 2] = v[3 * a + 2];
+        }
+        w_r2[k] = sr->r2[a];
+    }
+}
+
 static double
 sr_atom_area(int i,
              const sr_data *sr,
@@ -283,17 +459,18 @@ sr_atom_area(int i,
        a certain atom do not overlap with any other atoms */
     int *spcount = sr->spcount[thread_index];
     const int nni = sr->nb->nn[i];
-    const int *restrict nbi = sr->nb->nb[i];
     const double ri = sr->r[i];
-    const double *restrict r2 = sr->r2;
-    const double *restrict v = freesasa_coord_all(sr->xyz);
-    const double *restrict vi = v + 3 * i;
+    const double *restrict w = sr->nb_xyz[thread_index];
+    const double *restrict r2 = sr->nb_r2[thread_index];
+    const double *restrict vi = freesasa_coord_i(sr->xyz, i);
     const double *restrict tp;
-    int n_surface = 0, current_nb, a, j, k;
+    int n_surface = 0, current_nb, j, k;
     double dx, dy, dz;
     /* testpoints for this atom */
     coord_t *restrict tp_coord_ri = sr->tp_local[thread_index];
 
+    sr_gather_nb(i, sr, thread_index);
+
     freesasa_coord_copy(tp_coord_ri, sr->srp);
     freesasa_coord_scale(tp_coord_ri, ri);
     freesasa_coord_translate(tp_coord_ri, vi);
@@ -309,26 +486,24 @@ sr_atom_area(int i,
        organized in patches and not spirals. */
     current_nb = 0;
     for (j = 0; j < n_points; ++j) {
-        /* a is the index of the atom under consideration */
-        a = nbi[current_nb];
-        dx = tp[j * 3] - v[a * 3];
-        dy = tp[j * 3 + 1] - v[a * 3 + 1];
-        dz = tp[j * 3 + 2] - v[a * 3 + 2];
-        if (dx * dx + dy * dy + dz * dz > r2[a]) {
-            k = 0;
-            for (; k < nni; ++k) {
-                a = nbi[k];
-                dx = tp[j * 3] - v[a * 3];
-                dy = tp[j * 3 + 1] - v[a * 3 + 1];
-                dz = tp[j * 3 + 2] - v[a * 3 + 2];
-                if (dx * dx + dy * dy + dz * dz <= r2[a]) {
-                    current_nb = k;
-                    break;
-                }
+        /* start with the neighbor that covered the previous point */
+        if (nni > 0) {
+            dx = tp[j * 3] - w[current_nb * 3];
+            dy = tp[j * 3 + 1] - w[current_nb * 3 + 1];
+            dz = tp[j * 3 + 2] - w[current_nb * 3 + 2];
+            if (dx * dx + dy * dy + dz * dz <= r2[current_nb]) continue;
+        }
+        for (k = 0; k < nni; ++k) {
+            dx = tp[j * 3] - w[k * 3];
+            dy = tp[j * 3 + 1] - w[k * 3 + 1];
+            dz = tp[j * 3 + 2] - w[k * 3 + 2];
+            if (dx * dx + dy * dy + dz * dz <= r2[k]) {
+                current_nb = k;
+                break;
             }
-            /* we have gone through the whole list without overlap */
-            if (k == nni) spcount[j] = 1;
         }
+        /* we have gone through the whole list without overlap */
+        if (k == nni) spcount[j] = 1;
     }
     for (k = 0; k < n_points; ++k) {
         if (spcount[k]) ++n_surface;
@@ -336,3 +511,105 @@ sr_atom_area(int i,
 
     return (4.0 * M_PI * ri * ri * n_surface) / n_points;
 }
+
+/**
+    Calculates the area of atom i for each probe radius in the sweep,
+    stored in sr->sasa[p * n_atoms + i].
+
+    The test point in direction u lies at vi + u (ri + probe), and
+    once it is buried by a neighbor it stays buried for all larger
+    probes (the point moves as fast as the neighbor's surface
+    grows). Each test point is therefore visited once, to find the
+    smallest probe that buries it, and is exposed for all probes
+    smaller than that.
+
+    For neighbor a, with c = vi + u ri - wa, the point is buried when
+    |c + u probe|^2 <= (ra + probe)^2, i.e. for
+
+        probe >= (|c|^2 - ra^2) / (2 (ra - c.u))
+
+    if c.u < ra, and never otherwise. The neighbors are sorted by the
+    smallest probe at which they touch atom i, so the search for a
+    point stops at the first neighbor that can't improve on the best
+    value found so far.
+ */
+static void
+sr_atom_area_sweep(int i,
+                   const sr_data *sr,
+                   int thread_index)
+{
+    const int n_points = sr->n_points, n_atoms = sr->n_atoms, n_probes = sr->n_probes;
+    const int nni = sr->nb->nn[i];
+    const int *restrict nbi = sr->nb->nb[i];
+    const double *restrict radii = sr->radii;
+    const double *restrict probes = sr->probes;
+    const double *restrict vi = freesasa_coord_i(sr->xyz, i);
+    const double *restrict w = sr->nb_xyz[thread_index];
+    const double *restrict u = freesasa_coord_all(sr->srp);
+    const double ri = radii[i];
+    double *restrict key = sr->nb_key[thread_index];
+    int *restrict order = sr->nb_order[thread_index];
+    int *restrict n_surface = sr->n_surface[thread_index];
+    int j, k, m, a, p, current_nb;
+    double dx, dy, dz, d, ra, cu, buried, contact, min_probe, Ri;
+
+    sr_gather_nb(i, sr, thread_index);
+
+    /* insertion sort by d - r_a, atoms i and a are in contact if
+       this is smaller than ri + 2 * probe, order[] indexes the
+       gathered neighbor positions */
+    for (k = 0; k < nni; ++k) {
+        dx = w[3 * k] - vi[0];
+        dy = w[3 * k + 1] - vi[1];
+        dz = w[3 * k + 2] - vi[2];
+        d = sqrt(dx * dx + dy * dy + dz * dz) - radii[nbi[k]];
+        for (m = k; m > 0 && key[m - 1] > d; --m) {
+            key[m] = key[m - 1];
+            order[m] = order[m - 1];
+        }
+        key[m] = d;
+        order[m] = k;
+    }
+
+    min_probe = probes[0];
+    for (p = 0; p < n_probes; ++p) {
+        if (probes[p] < min_probe) min_probe = probes[p];
+        n_surface[p] = 0;
+    }
+
+    /* as in sr_atom_area(), start with the neighbor that buried the
+       previous point, it will often bury this one too */
+    current_nb = 0;
+    for (j = 0; j < n_points; ++j) {
+        buried = HUGE_VAL;
+        for (m = nni > 0 ? -1 : 0; m < nni && buried > min_probe; ++m) {
+            k = m < 0 ? current_nb : m;
+            /* smallest probe for which neighbor k touches atom i */
+            contact = (key[k] - ri) / 2;
+            if (m >= 0 && contact >= buried) break;
+            if (m >= 0 && k == current_nb) continue;
+            a = order[k];
+            ra = radii[nbi[a]];
+            dx = vi[0] + u[j * 3] * ri - w[a * 3];
+            dy = vi[1] + u[j * 3 + 1] * ri - w[a * 3 + 1];
+            dz = vi[2] + u[j * 3 + 2] * ri - w[a * 3 + 2];
+            cu = dx * u[j * 3] + dy * u[j * 3 + 1] + dz * u[j * 3 + 2];
+            if (cu >= ra) continue;
+            d = (dx * dx + dy * dy + dz * dz - ra * ra) / (2 * (ra - cu));
+            /* they have to be in contact for the point to be buried */
+            if (d < contact) d = contact;
+            if (d < buried) {
+                buried = d;
+                current_nb = k;
+            }
+        }
+        for (p = 0; p < n_probes; ++p) {
+            if (probes[p] < buried) ++n_surface[p];
+        }
+    }
+
+    for (p = 0; p < n_probes; ++p) {
+        Ri = ri + probes[p];
+        sr->sasa[p * n_atoms + i] = (4.0 * M_PI * Ri * Ri * n_surface[p]) / n_points;
+    }
+}
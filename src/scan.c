@@ -0,0 +1,288 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if USE_THREADS
+#include <pthread.h>
+#define MAX_SCAN_THREADS 16
+#else
+#define MAX_SCAN_THREADS 1
+#endif
+
+#include "freesasa_internal.h"
+#include "nb.h"
+#include "pdb.h"
+
+/* scan parameters and data for a range of residues (one per thread) */
+typedef struct {
+    const freesasa_structure *structure;
+    const double *xyz;
+    const double *radii;
+    const double *sasa; /* SASA of the unmutated structure */
+    const nb_list *nb;
+    freesasa_parameters parameters;
+    int first_residue, last_residue; /* last_residue not included */
+    double *delta;
+    int return_value;
+} scan_data;
+
+#if USE_THREADS
+static int scan_do_threads(int n_threads, const scan_data *scan, int n_residues);
+static void *scan_thread(void *arg);
+#endif
+
+static int
+is_cb(const char *atom_name)
+{
+    char name[PDB_ATOM_NAME_STRL + 1];
+
+    name[0] = '\0';
+    sscanf(atom_name, "%4s", name);
+
+    return strcmp(name, "CB") == 0;
+}
+
+/**
+    Calculates the change in SASA when the side chain of each residue
+    in the range is truncated at CB.
+
+    The removed atoms are marked in `removed`, the atoms whose SASA
+    changes (those in contact with the removed atoms) are the first
+    atoms in `subset`, followed by the atoms that occlude them. Only
+    the atoms in `subset` are passed to the SASA kernels.
+ */
+static int
+scan_residues(scan_data *scan)
+{
+    const freesasa_structure *structure = scan->structure;
+    const int n_atoms = freesasa_structure_n(structure);
+    const nb_list *nb = scan->nb;
+    freesasa_result *result = NULL;
+    double *sub_xyz = NULL, *sub_r = NULL, delta;
+    int *subset = NULL, *removed = NULL, *in_subset = NULL;
+    int r, i, j, k, first, last, has_cb, n_removed, n_affected, n_sub;
+
+    sub_xyz = malloc(sizeof(double) * 3 * n_atoms);
+    sub_r = malloc(sizeof(double) * n_atoms);
+    subset = malloc(sizeof(int) * n_atoms);
+    removed = malloc(sizeof(int) * n_atoms);
+    in_subset = malloc(sizeof(int) * n_atoms);
+
+    if (!sub_xyz || !sub_r || !subset || !removed || !in_subset) {
+        scan->return_value = mem_fail();
+        goto cleanup;
+    }
+
+    for (i = 0; i < n_atoms; ++i) {
+        removed[i] = in_subset[i] = -1;
+    }
+
+    for (r = scan->first_residue; r < scan->last_residue; ++r) {
+        scan->delta[r] = 0;
+        freesasa_structure_residue_atoms(structure, r, &first, &last);
+
+        /* residues without CB (glycine, nucleotides, ...) are left as they are */
+        has_cb = 0;
+        for (i = first; i <= last; ++i) {
+            if (is_cb(freesasa_structure_atom_name(structure, i))) has_cb = 1;
+        }
+        if (!has_cb) continue;
+
+        delta = 0;
+        n_removed = 0;
+        for (i = first; i <= last; ++i) {
+            const char *name = freesasa_structure_atom_name(structure, i);
+            if (!freesasa_atom_is_backbone(name) && !is_cb(name)) {
+                removed[i] = r;
+                delta -= scan->sasa[i];
+                ++n_removed;
+            }
+        }
+        if (n_removed == 0) continue;
+
+        /* atoms that were in contact with the removed ones */
+        n_affected = 0;
+        for (i = first; i <= last; ++i) {
+            if (removed[i] != r) continue;
+            for (k = 0; k < nb->nn[i]; ++k) {
+                j = nb->nb[i][k];
+                if (removed[j] != r && in_subset[j] != r) {
+                    in_subset[j] = r;
+                    subset[n_affected++] = j;
+                }
+            }
+        }
+
+        if (n_affected > 0) {
+            /* and their remaining neighbors */
+            n_sub = n_affected;
+            for (i = 0; i < n_affected; ++i) {
+                for (k = 0; k < nb->nn[subset[i]]; ++k) {
+                    j = nb->nb[subset[i]][k];
+                    if (removed[j] != r && in_subset[j] != r) {
+                        in_subset[j] = r;
+                        subset[n_sub++] = j;
+                    }
+                }
+            }
+
+            for (i = 0; i < n_sub; ++i) {
+                memcpy(sub_xyz + 3 * i, scan->xyz + 3 * subset[i], sizeof(double) * 3);
+                sub_r[i] = scan->radii[subset[i]];
+            }
+
+            result = freesasa_calc_coord(sub_xyz, sub_r, n_sub, &scan->parameters);
+            if (result == NULL) {
+                scan->return_value = fail_msg("");
+                goto cleanup;
+            }
+            for (i = 0; i < n_affected; ++i) {
+                delta += result->sasa[i] - scan->sasa[subset[i]];
+            }
+            freesasa_result_free(result);
+            result = NULL;
+        }
+
+        scan->delta[r] = delta;
+    }
+
+cleanup:
+    free(sub_xyz);
+    free(sub_r);
+    free(subset);
+    free(removed);
+    free(in_subset);
+
+    return scan->return_value;
+}
+
+int freesasa_alanine_scan(const freesasa_structure *structure,
+                          const freesasa_parameters *parameters,
+                          double *delta)
+{
+    const coord_t *xyz;
+    const double *radii;
+    freesasa_result *result = NULL;
+    double *r_probe = NULL;
+    nb_list *nb = NULL;
+    scan_data scan;
+    int n_atoms, n_residues, n_threads, i, ret;
+
+    assert(structure);
+    assert(delta);
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    n_atoms = freesasa_structure_n(structure);
+    n_residues = freesasa_structure_n_residues(structure);
+    xyz = freesasa_structure_xyz(structure);
+    radii = freesasa_structure_radius(structure);
+
+    if (n_atoms == 0) return freesasa_warn("in %s(): empty structure", __func__);
+
+    n_threads = parameters->n_threads;
+    if (n_threads > MAX_SCAN_THREADS) {
+        return fail_msg("alanine scan does not support more than %d threads", MAX_SCAN_THREADS);
+    }
+    if (n_threads > n_residues) n_threads = n_residues;
+
+    /* SASA and contacts of the unmutated structure are shared by all residues */
+    result = freesasa_calc(xyz, radii, parameters);
+    r_probe = malloc(sizeof(double) * n_atoms);
+    if (result == NULL || r_probe == NULL) {
+        ret = fail_msg("");
+        goto cleanup;
+    }
+    for (i = 0; i < n_atoms; ++i) {
+        r_probe[i] = radii[i] + parameters->probe_radius;
+    }
+    nb = freesasa_nb_new_subset(xyz, r_probe, NULL, freesasa_parameters_box(parameters));
+    if (nb == NULL) {
+        ret = fail_msg("");
+        goto cleanup;
+    }
+
+    scan.structure = structure;
+    scan.xyz = freesasa_coord_all(xyz);
+    scan.radii = radii;
+    scan.sasa = result->sasa;
+    scan.nb = nb;
+    scan.parameters = *parameters;
+    scan.parameters.n_threads = 1;
+    scan.first_residue = 0;
+    scan.last_residue = n_residues;
+    scan.delta = delta;
+    scan.return_value = FREESASA_SUCCESS;
+
+    if (n_threads > 1) {
+#if USE_THREADS
+        ret = scan_do_threads(n_threads, &scan, n_residues);
+        goto cleanup;
+#else
+        freesasa_warn("in %s(): program compiled for single-threaded use, "
+                      "but multiple threads were requested, will "
+                      "proceed in single-threaded mode\n",
+                      __func__);
+#endif
+    }
+
+    ret = scan_residues(&scan);
+
+cleanup:
+    freesasa_result_free(result);
+    freesasa_nb_free(nb);
+    free(r_probe);
+
+    return ret;
+}
+
+#if USE_THREADS
+static int
+scan_do_threads(int n_threads,
+                const scan_data *scan,
+                int n_residues)
+{
+    pthread_t thread[MAX_SCAN_THREADS];
+    scan_data st[MAX_SCAN_THREADS];
+    int block_size = n_residues / n_threads;
+    int res, return_value = FREESASA_SUCCESS;
+    int threads_created = 0, t;
+
+    /* divide residues evenly over threads */
+    for (t = 0; t < n_threads; ++t) {
+        st[t] = *scan;
+        st[t].first_residue = t * block_size;
+        if (t == n_threads - 1)
+            st[t].last_residue = n_residues;
+        else
+            st[t].last_residue = (t + 1) * block_size;
+        res = pthread_create(&thread[t], NULL, scan_thread, (void *)&st[t]);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+            break;
+        }
+        ++threads_created;
+    }
+    for (t = 0; t < threads_created; ++t) {
+        res = pthread_join(thread[t], NULL);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+        }
+        if (st[t].return_value == FREESASA_FAIL) {
+            return_value = FREESASA_FAIL;
+        }
+    }
+    return return_value;
+}
+
+static void *
+scan_thread(void *arg)
+{
+    /* each thread writes to its own range of residues */
+    scan_residues((scan_data *)arg);
+    pthread_exit(NULL);
+}
+#endif /* USE_THREADS */
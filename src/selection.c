@@ -4,7 +4,10 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "freesasa_internal.h"
 #include "pdb.h"
@@ -21,12 +24,21 @@ struct freesasa_selection {
     int n_atoms;
 };
 
+struct freesasa_compiled_selection {
+    expression *expression; /* invalid terms have been removed */
+    char *command;
+    char name[FREESASA_MAX_SELECTION_NAME + 1];
+    int warn; /* if invalid terms were removed */
+};
+
 struct selection {
     const char *name;
-    int *atom;
+    uint64_t *atom; /* one bit per atom */
     int size;
 };
 
+#define SELECTION_WORDS(n) (((n) + 63) / 64)
+
 static const char *
 e_str(expression_type e)
 {
@@ -247,21 +259,21 @@ static struct selection *
 selection_new(int n)
 {
     struct selection *selection = malloc(sizeof(struct selection));
-    int i;
 
     if (selection == NULL) {
         mem_fail();
     } else {
+        selection->name = NULL;
         selection->size = n;
-        selection->atom = malloc(sizeof(int) * n);
+        /* allocate at least one word to avoid malloc(0) */
+        selection->atom = malloc(sizeof(uint64_t) * (SELECTION_WORDS(n) + 1));
 
         if (selection->atom == NULL) {
             free(selection);
             mem_fail();
             selection = NULL;
         } else {
-            for (i = 0; i < n; ++i)
-                selection->atom[i] = 0;
+            memset(selection->atom, 0, sizeof(uint64_t) * SELECTION_WORDS(n));
         }
     }
 
@@ -277,104 +289,176 @@ selection_free(struct selection *selection)
     }
 }
 
-/* Looks for exact match between the atom-name and expr->value */
 static int
-match_name(const freesasa_structure *structure,
-           const char *id,
-           int i)
+selection_has(const struct selection *selection,
+              int i)
 {
-    char atom[PDB_ATOM_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_name(structure, i), "%s", atom);
-    if (strcmp(atom, id) == 0)
-        return 1;
-    return 0;
+    return (selection->atom[i / 64] >> (i % 64)) & 1;
 }
 
-/** Looks for match of strlen(expr->value) first characters of atom-name and expr->value */
+/* The columns of the structure, and buffers shared by the nodes of
+   the expression. Each selector marks the names that it matches in
+   match, and the atoms are then selected in one pass over the
+   column. */
+struct selection_eval {
+    struct structure_columns columns;
+    unsigned char *match;          /* per string, or per chain label */
+    unsigned char *present[E_CHAIN + 1]; /* per string, if it's used in the column */
+    uint64_t *scratch;             /* one bitset per level of and/or */
+    int depth;                     /* first free bitset in scratch */
+};
+
+/* the number of nested and/or, which need a bitset each for their right operand */
 static int
-match_symbol(const freesasa_structure *structure,
-             const char *id,
-             int i)
+expression_depth(const expression *expr)
 {
-    char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    sscanf(freesasa_structure_atom_symbol(structure, i), "%s", symbol);
-    if (strcmp(id, symbol) == 0) {
-        return 1;
-    }
-    return 0;
+    int l, r;
+
+    if (expr == NULL) return 0;
+
+    l = expression_depth(expr->left);
+    r = expression_depth(expr->right);
+    if (l < r) l = r;
+
+    return l + (expr->type == E_AND || expr->type == E_OR);
 }
 
 static int
-match_resn(const freesasa_structure *structure,
-           const char *id,
-           int i)
+selection_eval_init(struct selection_eval *ev,
+                    const freesasa_structure *structure,
+                    const expression *expr,
+                    int size)
 {
-    char resn[PDB_ATOM_RES_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_res_name(structure, i), "%s", resn);
-    if (strcmp(resn, id) == 0)
-        return 1;
-    return 0;
+    int n_match;
+
+    memset(ev, 0, sizeof(struct selection_eval));
+    freesasa_structure_columns(structure, &ev->columns);
+
+    n_match = ev->columns.n_strings > 256 ? ev->columns.n_strings : 256;
+    ev->match = malloc(n_match);
+    ev->scratch = malloc(sizeof(uint64_t) * (SELECTION_WORDS(size) * expression_depth(expr) + 1));
+    if (ev->match == NULL || ev->scratch == NULL) return mem_fail();
+
+    return FREESASA_SUCCESS;
 }
 
-static int
-match_resi(const freesasa_structure *structure,
-           const char *id,
-           int i)
+static void
+selection_eval_free(struct selection_eval *ev)
 {
-    char resi[PDB_ATOM_RES_NUMBER_STRL + 1];
-    sscanf(freesasa_structure_atom_res_number(structure, i), "%s", resi);
-    if (strcmp(resi, id) == 0)
-        return 1;
-    return 0;
+    int i;
+
+    free(ev->match);
+    free(ev->scratch);
+    for (i = 0; i <= E_CHAIN; ++i) {
+        free(ev->present[i]);
+    }
+}
+
+static const int *
+selection_column(const struct selection_eval *ev,
+                 expression_type type)
+{
+    switch (type) {
+    case E_NAME:
+        return ev->columns.atom_name;
+    case E_SYMBOL:
+        return ev->columns.symbol;
+    case E_RESN:
+        return ev->columns.res_name;
+    case E_RESI:
+        return ev->columns.res_number;
+    default:
+        assert(0);
+        return NULL;
+    }
+}
+
+/* Marks the names that are used in the column of type, or the chain
+   labels that are used. Computed once per column. */
+static const unsigned char *
+selection_present(struct selection_eval *ev,
+                  expression_type type)
+{
+    const int *column;
+    unsigned char *present;
+    int i;
+
+    if (ev->present[type] != NULL) return ev->present[type];
+
+    if (type == E_CHAIN) {
+        present = calloc(256, 1);
+        if (present == NULL) {
+            mem_fail();
+            return NULL;
+        }
+        for (i = 0; i < ev->columns.n_atoms; ++i) {
+            present[(unsigned char)ev->columns.chain_label[i]] = 1;
+        }
+    } else {
+        /* allocate at least one element to avoid calloc(0) */
+        present = calloc(ev->columns.n_strings + 1, 1);
+        if (present == NULL) {
+            mem_fail();
+            return NULL;
+        }
+        column = selection_column(ev, type);
+        for (i = 0; i < ev->columns.n_atoms; ++i) {
+            present[column[i]] = 1;
+        }
+    }
+    ev->present[type] = present;
+
+    return present;
 }
 
+/* Compares the first word of a name, i.e. without whitespace, to id */
 static int
-match_chain(const freesasa_structure *structure,
-            const char *id,
-            int i)
+token_eq(const char *name,
+         const char *id)
 {
-    return id[0] == freesasa_structure_atom_chain(structure, i);
+    size_t n;
+
+    while (isspace((unsigned char)*name)) ++name;
+    for (n = 0; name[n] != '\0' && !isspace((unsigned char)name[n]); ++n)
+        ;
+
+    return strlen(id) == n && strncmp(name, id, n) == 0;
 }
 
-static void
+/* Marks the names or chain labels that match id */
+static int
 select_id(expression_type parent_type,
-          struct selection *selection,
-          const freesasa_structure *structure,
+          struct selection_eval *ev,
           const char *id)
 {
-    int count = 0, match, i;
+    const unsigned char *present;
+    int count = 0, i;
 
     assert(id);
 
-    for (i = 0; i < selection->size; ++i) {
-        match = 0;
-        switch (parent_type) {
-        case E_NAME:
-            match = match_name(structure, id, i);
-            break;
-        case E_SYMBOL:
-            match = match_symbol(structure, id, i);
-            break;
-        case E_RESN:
-            match = match_resn(structure, id, i);
-            break;
-        case E_RESI:
-            match = match_resi(structure, id, i);
-            break;
-        case E_CHAIN:
-            match = match_chain(structure, id, i);
-            break;
-        default:
-            assert(0);
-            break;
+    present = selection_present(ev, parent_type);
+    if (present == NULL) return fail_msg("");
+
+    if (parent_type == E_CHAIN) {
+        i = (unsigned char)id[0];
+        ev->match[i] = 1;
+        count = present[i];
+    } else {
+        for (i = 0; i < ev->columns.n_strings; ++i) {
+            if (token_eq(ev->columns.strings[i], id)) {
+                ev->match[i] = 1;
+                count += present[i];
+            }
         }
-        if (match) selection->atom[i] = 1;
-        count += match;
     }
+
     if (count == 0) freesasa_warn("Found no matches to %s '%s', typo?",
                                   e_str(parent_type), id);
+
+    return FREESASA_SUCCESS;
 }
 
+
 static int
 is_valid_id(int parent_type,
             const expression *expr)
@@ -455,16 +539,10 @@ is_valid_id(int parent_type,
 }
 
 static int
-select_range(expression_type range_type,
-             expression_type parent_type,
-             struct selection *selection,
-             const freesasa_structure *structure,
-             const expression *left,
-             const expression *right)
+is_valid_range(expression_type parent_type,
+               const expression *left,
+               const expression *right)
 {
-    int lower, upper, i, j;
-
-    assert(range_type == E_RANGE || range_type == E_RANGE_OPEN_L || range_type == E_RANGE_OPEN_R);
     assert(parent_type == E_RESI || parent_type == E_CHAIN);
 
     if (parent_type == E_RESI) { /* residues have integer numbering */
@@ -481,12 +559,31 @@ select_range(expression_type range_type,
                                  "will be ignored",
                                  e_str(parent_type), left->value, right->value);
     }
+    return FREESASA_SUCCESS;
+}
+
+/* The range should have been checked by is_valid_range() */
+static int
+select_range(expression_type range_type,
+             expression_type parent_type,
+             struct selection_eval *ev,
+             const expression *left,
+             const expression *right)
+{
+    const struct structure_columns *c = &ev->columns;
+    int lower, upper, i, j;
+
+    assert(range_type == E_RANGE || range_type == E_RANGE_OPEN_L || range_type == E_RANGE_OPEN_R);
+    assert(parent_type == E_RESI || parent_type == E_CHAIN);
+
+    if (c->n_atoms == 0) return FREESASA_SUCCESS;
+
     if (range_type == E_RANGE_OPEN_L) {
-        lower = atoi(freesasa_structure_atom_res_number(structure, 0));
+        lower = atoi(c->strings[c->res_number[0]]);
         upper = atoi(right->value);
     } else if (range_type == E_RANGE_OPEN_R) {
         lower = atoi(left->value);
-        upper = atoi(freesasa_structure_atom_res_number(structure, freesasa_structure_n(structure) - 1));
+        upper = atoi(c->strings[c->res_number[c->n_atoms - 1]]);
     } else if (left->type == E_NUMBER) {
         lower = atoi(left->value);
         upper = atoi(right->value);
@@ -494,24 +591,28 @@ select_range(expression_type range_type,
         lower = (int)left->value[0];
         upper = (int)right->value[0];
     }
-    for (i = 0; i < selection->size; ++i) {
-        if (parent_type == E_RESI)
-            j = atoi(freesasa_structure_atom_res_number(structure, i));
-        else
-            j = (int)freesasa_structure_atom_chain(structure, i);
-        if (j >= lower && j <= upper)
-            selection->atom[i] = 1;
+
+    /* residue numbers are compared once per name, chains once per label */
+    if (parent_type == E_RESI) {
+        for (i = 0; i < c->n_strings; ++i) {
+            j = atoi(c->strings[i]);
+            if (j >= lower && j <= upper) ev->match[i] = 1;
+        }
+    } else {
+        for (i = 0; i < 256; ++i) {
+            j = (int)(char)i;
+            if (j >= lower && j <= upper) ev->match[i] = 1;
+        }
     }
+
     return FREESASA_SUCCESS;
 }
 
 static int
 select_list(expression_type parent_type,
-            struct selection *selection,
-            const freesasa_structure *structure,
+            struct selection_eval *ev,
             const expression *expr)
 {
-    int resr, resl;
     expression *left, *right;
 
     if (expr == NULL)
@@ -524,31 +625,25 @@ select_list(expression_type parent_type,
     case E_PLUS:
         if (left == NULL || right == NULL)
             return fail_msg("NULL expression");
-        resl = select_list(parent_type, selection, structure, left);
-        resr = select_list(parent_type, selection, structure, right);
-        if (resl == FREESASA_WARN || resr == FREESASA_WARN)
-            return FREESASA_WARN;
+        if (select_list(parent_type, ev, left) == FREESASA_FAIL ||
+            select_list(parent_type, ev, right) == FREESASA_FAIL)
+            return FREESASA_FAIL;
         break;
     case E_RANGE:
         if (left == NULL || right == NULL)
             return fail_msg("NULL expression");
-        return select_range(E_RANGE, parent_type, selection, structure, left, right);
+        return select_range(E_RANGE, parent_type, ev, left, right);
     case E_RANGE_OPEN_L:
         if (left != NULL || right == NULL)
             return fail_msg("NULL expression");
-        return select_range(E_RANGE_OPEN_L, parent_type, selection, structure, left, right);
+        return select_range(E_RANGE_OPEN_L, parent_type, ev, left, right);
     case E_RANGE_OPEN_R:
         if (left == NULL || right != NULL)
             return fail_msg("NULL expression");
-        return select_range(E_RANGE_OPEN_R, parent_type, selection, structure, left, right);
+        return select_range(E_RANGE_OPEN_R, parent_type, ev, left, right);
     case E_ID:
     case E_NUMBER:
-        if (is_valid_id(parent_type, expr) == FREESASA_SUCCESS)
-            select_id(parent_type, selection, structure, expr->value);
-        else
-            return freesasa_warn("select: %s: '%s' invalid %s",
-                                 e_str(parent_type), expr->value, e_str(expr->type));
-        break;
+        return select_id(parent_type, ev, expr->value);
     default:
         return freesasa_fail("select: parse error (expression: '%s %s')",
                              e_str(parent_type), e_str(expr->type));
@@ -556,6 +651,50 @@ select_list(expression_type parent_type,
     return FREESASA_SUCCESS;
 }
 
+/* Marks the matching names of a selector, and then the atoms that
+   have one of them in one pass over the column. The list should have
+   been checked by compile_list(). */
+static int
+select_column(expression_type parent_type,
+              struct selection_eval *ev,
+              struct selection *selection,
+              const expression *expr)
+{
+    const unsigned char *match = ev->match;
+    const int *column = NULL;
+    const char *chain_label = ev->columns.chain_label;
+    uint64_t word;
+    int ret, n = selection->size, i, j, end;
+
+    if (parent_type == E_CHAIN) {
+        memset(ev->match, 0, 256);
+    } else {
+        memset(ev->match, 0, ev->columns.n_strings);
+        column = selection_column(ev, parent_type);
+    }
+
+    /* the list is empty if all its terms were invalid */
+    ret = expr != NULL ? select_list(parent_type, ev, expr) : FREESASA_SUCCESS;
+    if (ret == FREESASA_FAIL) return ret;
+
+    for (i = 0; i < n; i += 64) {
+        end = n - i < 64 ? n - i : 64;
+        word = 0;
+        if (column != NULL) {
+            for (j = 0; j < end; ++j) {
+                word |= (uint64_t)match[column[i + j]] << j;
+            }
+        } else {
+            for (j = 0; j < end; ++j) {
+                word |= (uint64_t)match[(unsigned char)chain_label[i + j]] << j;
+            }
+        }
+        selection->atom[i / 64] = word;
+    }
+
+    return ret;
+}
+
 static int
 selection_join(struct selection *target,
                const struct selection *s1,
@@ -570,16 +709,16 @@ selection_join(struct selection *target,
     assert(s1->size == s2->size);
     assert(s1->size == target->size);
 
-    n = target->size;
+    n = SELECTION_WORDS(target->size);
 
     switch (type) {
     case E_AND:
         for (i = 0; i < n; ++i)
-            target->atom[i] = s1->atom[i] && s2->atom[i];
+            target->atom[i] = s1->atom[i] & s2->atom[i];
         break;
     case E_OR:
         for (i = 0; i < n; ++i)
-            target->atom[i] = s1->atom[i] || s2->atom[i];
+            target->atom[i] = s1->atom[i] | s2->atom[i];
         break;
     default:
         assert(0);
@@ -591,30 +730,33 @@ selection_join(struct selection *target,
 static int
 selection_not(struct selection *s)
 {
-    int i;
+    int n, i;
 
     if (s == NULL) return fail_msg("NULL selection");
 
-    for (i = 0; i < s->size; ++i) {
-        s->atom[i] = !s->atom[i];
+    n = SELECTION_WORDS(s->size);
+    for (i = 0; i < n; ++i) {
+        s->atom[i] = ~s->atom[i];
+    }
+    /* the bits after the last atom stay zero */
+    if (s->size % 64 != 0) {
+        s->atom[n - 1] &= ((uint64_t)1 << (s->size % 64)) - 1;
     }
 
     return FREESASA_SUCCESS;
 }
 
-/* Called recursively, the selection is built as we cover the expression tree */
+/* Called recursively, the selection is built as we cover the
+   expression tree. The left operand of and/or is evaluated into the
+   selection itself, and the right operand into the next scratch
+   bitset. */
 static int
-select_atoms(struct selection *selection,
-             const expression *expr,
-             const freesasa_structure *structure)
+select_expression(struct selection_eval *ev,
+                  struct selection *selection,
+                  const expression *expr)
 {
-    int warn = 0, err = 0, n, ret;
-    struct selection *sl, *sr;
-
-    assert(selection);
-    assert(structure);
-
-    n = selection->size;
+    int warn = 0, ret;
+    struct selection right;
 
     /* this should only happen if memory allocation failed during parsing */
     if (expr == NULL) return fail_msg("NULL expression");
@@ -623,42 +765,36 @@ select_atoms(struct selection *selection,
     case E_SELECTION:
         assert(expr->value != NULL);
         selection->name = expr->value;
-        return select_atoms(selection, expr->left, structure);
+        return select_expression(ev, selection, expr->left);
         break;
     case E_SYMBOL:
     case E_NAME:
     case E_RESN:
     case E_RESI:
     case E_CHAIN:
-        return select_list(expr->type, selection, structure, expr->left);
+        return select_column(expr->type, ev, selection, expr->left);
         break;
     case E_AND:
     case E_OR: {
-        sl = selection_new(n);
-        sr = selection_new(n);
+        right.name = NULL;
+        right.size = selection->size;
+        right.atom = ev->scratch + SELECTION_WORDS(selection->size) * ev->depth;
 
-        if (sl != NULL && sr != NULL) {
-            if ((ret = select_atoms(sl, expr->left, structure))) {
-                if (ret == FREESASA_WARN) ++warn;
-                if (ret == FREESASA_FAIL) ++err;
-            }
-            if ((ret = select_atoms(sr, expr->right, structure))) {
-                if (ret == FREESASA_WARN) ++warn;
-                if (ret == FREESASA_FAIL) ++err;
-            }
-            selection_join(selection, sl, sr, expr->type);
-        } else {
-            ++err;
-        }
+        ret = select_expression(ev, selection, expr->left);
+        if (ret == FREESASA_FAIL) return fail_msg("error joining selections");
+        if (ret == FREESASA_WARN) ++warn;
 
-        selection_free(sl);
-        selection_free(sr);
+        ++ev->depth;
+        ret = select_expression(ev, &right, expr->right);
+        --ev->depth;
+        if (ret == FREESASA_FAIL) return fail_msg("error joining selections");
+        if (ret == FREESASA_WARN) ++warn;
 
-        if (err) return fail_msg("error joining selections");
+        selection_join(selection, selection, &right, expr->type);
         break;
     }
     case E_NOT: {
-        ret = select_atoms(selection, expr->right, structure);
+        ret = select_expression(ev, selection, expr->right);
         if (ret == FREESASA_WARN) ++warn;
         if (ret == FREESASA_FAIL) return FREESASA_FAIL;
         if (selection_not(selection)) return FREESASA_FAIL;
@@ -677,74 +813,315 @@ select_atoms(struct selection *selection,
 }
 
 static int
-select_area_impl(const char *command,
-                 char *name,
-                 double *area,
-                 const freesasa_structure *structure,
-                 const freesasa_result *result)
+select_atoms(struct selection *selection,
+             const expression *expr,
+             const freesasa_structure *structure)
+{
+    struct selection_eval ev;
+    int ret;
+
+    assert(selection);
+    assert(structure);
+
+    if (selection_eval_init(&ev, structure, expr, selection->size) == FREESASA_SUCCESS) {
+        ret = select_expression(&ev, selection, expr);
+    } else {
+        ret = fail_msg("");
+    }
+    selection_eval_free(&ev);
+
+    return ret;
+}
+
+/* Removes a term that is invalid from its list */
+static void
+remove_term(expression **list)
+{
+    expression_free(*list);
+    *list = NULL;
+}
+
+/* Checks the ids and ranges of a list once, when the selection is
+   compiled. Invalid terms are removed with a warning, and a list
+   where all terms are invalid becomes NULL (selects nothing). */
+static int
+compile_list(expression_type parent_type,
+             expression **list)
 {
-    struct selection *selection = NULL;
-    struct expression *expression = NULL;
+    int resl, resr;
+    expression *expr = *list, *left, *right;
+
+    if (expr == NULL)
+        return fail_msg("NULL expression");
+
+    left = expr->left;
+    right = expr->right;
+
+    switch (expr->type) {
+    case E_PLUS:
+        if (left == NULL || right == NULL)
+            return fail_msg("NULL expression");
+        resl = compile_list(parent_type, &expr->left);
+        resr = compile_list(parent_type, &expr->right);
+        if (resl == FREESASA_FAIL || resr == FREESASA_FAIL)
+            return FREESASA_FAIL;
+        /* replace the sum with the remaining term */
+        if (expr->left == NULL || expr->right == NULL) {
+            *list = expr->left != NULL ? expr->left : expr->right;
+            expr->left = expr->right = NULL;
+            expression_free(expr);
+        }
+        if (resl == FREESASA_WARN || resr == FREESASA_WARN)
+            return FREESASA_WARN;
+        break;
+    case E_RANGE:
+        if (left == NULL || right == NULL)
+            return fail_msg("NULL expression");
+        if (is_valid_range(parent_type, left, right) != FREESASA_SUCCESS) {
+            remove_term(list);
+            return FREESASA_WARN;
+        }
+        break;
+    case E_RANGE_OPEN_L:
+        if (left != NULL || right == NULL)
+            return fail_msg("NULL expression");
+        if (is_valid_range(parent_type, left, right) != FREESASA_SUCCESS) {
+            remove_term(list);
+            return FREESASA_WARN;
+        }
+        break;
+    case E_RANGE_OPEN_R:
+        if (left == NULL || right != NULL)
+            return fail_msg("NULL expression");
+        if (is_valid_range(parent_type, left, right) != FREESASA_SUCCESS) {
+            remove_term(list);
+            return FREESASA_WARN;
+        }
+        break;
+    case E_ID:
+    case E_NUMBER:
+        if (is_valid_id(parent_type, expr) != FREESASA_SUCCESS) {
+            freesasa_warn("select: %s: '%s' invalid %s",
+                          e_str(parent_type), expr->value, e_str(expr->type));
+            remove_term(list);
+            return FREESASA_WARN;
+        }
+        break;
+    default:
+        return freesasa_fail("select: parse error (expression: '%s %s')",
+                             e_str(parent_type), e_str(expr->type));
+    }
+    return FREESASA_SUCCESS;
+}
+
+static int
+compile_expression(expression *expr)
+{
+    int warn = 0, ret;
+
+    if (expr == NULL) return fail_msg("NULL expression");
+
+    switch (expr->type) {
+    case E_SELECTION:
+        assert(expr->value != NULL);
+        return compile_expression(expr->left);
+    case E_SYMBOL:
+    case E_NAME:
+    case E_RESN:
+    case E_RESI:
+    case E_CHAIN:
+        return compile_list(expr->type, &expr->left);
+    case E_AND:
+    case E_OR:
+        ret = compile_expression(expr->left);
+        if (ret == FREESASA_FAIL) return ret;
+        if (ret == FREESASA_WARN) ++warn;
+        ret = compile_expression(expr->right);
+        if (ret == FREESASA_FAIL) return ret;
+        if (ret == FREESASA_WARN) ++warn;
+        break;
+    case E_NOT:
+        ret = compile_expression(expr->right);
+        if (ret == FREESASA_FAIL) return ret;
+        if (ret == FREESASA_WARN) ++warn;
+        break;
+    default:
+        return fail_msg("parser error");
+    }
+    if (warn) return FREESASA_WARN;
+    return FREESASA_SUCCESS;
+}
+
+freesasa_compiled_selection *
+freesasa_selection_compile(const char *command)
+{
+    freesasa_compiled_selection *compiled;
     const int maxlen = FREESASA_MAX_SELECTION_NAME;
-    double sasa = 0;
-    int err = 0, warn = 0, n_atoms = 0, j, len;
+    int ret;
 
-    assert(name);
-    assert(area);
     assert(command);
+
+    compiled = malloc(sizeof(freesasa_compiled_selection));
+    if (compiled == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    compiled->expression = NULL;
+    compiled->command = NULL;
+    compiled->name[0] = '\0';
+    compiled->warn = 0;
+
+    compiled->command = strdup(command);
+    if (compiled->command == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    compiled->expression = get_expression(command);
+    if (compiled->expression == NULL) {
+        fail_msg("problems parsing expression '%s'", command);
+        goto cleanup;
+    }
+
+    ret = compile_expression(compiled->expression);
+    if (ret == FREESASA_FAIL) {
+        fail_msg("problems parsing expression '%s'", command);
+        goto cleanup;
+    }
+    compiled->warn = ret == FREESASA_WARN;
+
+    strncpy(compiled->name, compiled->expression->value, maxlen);
+    compiled->name[maxlen] = '\0';
+
+    return compiled;
+
+cleanup:
+    freesasa_compiled_selection_free(compiled);
+    return NULL;
+}
+
+void freesasa_compiled_selection_free(freesasa_compiled_selection *compiled)
+{
+    if (compiled != NULL) {
+        expression_free(compiled->expression);
+        free(compiled->command);
+        free(compiled);
+    }
+}
+
+const char *
+freesasa_compiled_selection_name(const freesasa_compiled_selection *compiled)
+{
+    assert(compiled);
+    return compiled->name;
+}
+
+const char *
+freesasa_compiled_selection_command(const freesasa_compiled_selection *compiled)
+{
+    assert(compiled);
+    return compiled->command;
+}
+
+/* Selects the atoms of a structure, the return value should be freed
+   with selection_free() */
+static struct selection *
+select_compiled(const freesasa_compiled_selection *compiled,
+                const freesasa_structure *structure)
+{
+    struct selection *selection = selection_new(freesasa_structure_n(structure));
+
+    if (selection == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    if (select_atoms(selection, compiled->expression, structure) == FREESASA_FAIL) {
+        fail_msg("problems applying selection '%s'", compiled->command);
+        selection_free(selection);
+        return NULL;
+    }
+
+    return selection;
+}
+
+freesasa_selection *
+freesasa_selection_apply(const freesasa_compiled_selection *compiled,
+                         const freesasa_structure *structure,
+                         const freesasa_result *result,
+                         int *mask)
+{
+    struct selection *atoms;
+    freesasa_selection *selection = NULL;
+    double area = 0;
+    int n_atoms = 0, i;
+
+    assert(compiled);
     assert(structure);
     assert(result);
     assert(freesasa_structure_n(structure) == result->n_atoms);
 
-    *area = 0;
-    name[0] = '\0';
+    atoms = select_compiled(compiled, structure);
+    if (atoms == NULL) {
+        fail_msg("");
+        return NULL;
+    }
 
-    expression = get_expression(command);
-    selection = selection_new(result->n_atoms);
+    for (i = 0; i < atoms->size; ++i) {
+        if (selection_has(atoms, i)) {
+            ++n_atoms;
+            /* atoms that weren't calculated have SASA NaN, and so
+               does the selection if it includes them */
+            area += result->sasa[i];
+        }
+        if (mask != NULL) mask[i] = selection_has(atoms, i);
+    }
 
+    selection = freesasa_selection_alloc(compiled->name, compiled->command);
     if (selection == NULL) {
-        return fail_msg("");
-    }
-
-    if (expression != NULL && selection != NULL) {
-        switch (select_atoms(selection, expression, structure)) {
-        case FREESASA_FAIL:
-            err = 1;
-            break;
-        case FREESASA_WARN:
-            warn = 1; /* proceed with calculation, print warning later */
-        case FREESASA_SUCCESS: {
-            for (j = 0; j < selection->size; ++j) {
-                ++n_atoms;
-                sasa += selection->atom[j] * result->sasa[j];
-            }
+        fail_msg("");
+    } else {
+        selection->area = area;
+        selection->n_atoms = n_atoms;
+    }
 
-            *area = sasa;
-            len = strlen(selection->name);
-            if (len > maxlen) {
-                strncpy(name, selection->name, maxlen);
-                name[maxlen] = '\0';
-            } else {
-                strncpy(name, selection->name, len);
-                name[len] = '\0';
-            }
+    selection_free(atoms);
 
-            break;
-        }
-        default:
-            assert(0);
+    return selection;
+}
+
+int freesasa_selection_mask(int *mask,
+                            const char *command,
+                            const freesasa_structure *structure)
+{
+    freesasa_compiled_selection *compiled;
+    struct selection *selection = NULL;
+    int n_selected = 0, i;
+
+    assert(mask);
+    assert(command);
+    assert(structure);
+
+    compiled = freesasa_selection_compile(command);
+    if (compiled != NULL) selection = select_compiled(compiled, structure);
+
+    if (selection != NULL) {
+        for (i = 0; i < selection->size; ++i) {
+            mask[i] = selection_has(selection, i);
+            n_selected += mask[i];
         }
-    } else {
-        err = 1;
+        if (compiled->warn)
+            freesasa_warn("in %s(): There were warnings", __func__);
     }
+
     selection_free(selection);
-    expression_free(expression);
+    freesasa_compiled_selection_free(compiled);
 
-    if (err)
+    if (selection == NULL)
         return fail_msg("problems parsing expression '%s'", command);
-    if (warn)
-        return freesasa_warn("in %s(): There were warnings", __func__);
-    return n_atoms;
+
+    return n_selected;
 }
 
 freesasa_selection *
@@ -831,31 +1208,29 @@ freesasa_selection_area(const freesasa_selection *selection)
     return selection->area;
 }
 
+int freesasa_selection_n_atoms(const freesasa_selection *selection)
+{
+    assert(selection);
+    return selection->n_atoms;
+}
+
 freesasa_selection *
 freesasa_selection_new(const char *command,
                        const freesasa_structure *structure,
                        const freesasa_result *result)
 {
-    char name[FREESASA_MAX_SELECTION_NAME];
-    double area;
-    freesasa_selection *selection;
-    int n_atoms;
+    freesasa_compiled_selection *compiled;
+    freesasa_selection *selection = NULL;
 
-    n_atoms = select_area_impl(command, name, &area, structure, result);
+    assert(command);
 
-    if (n_atoms == FREESASA_FAIL) {
-        fail_msg("");
-        return NULL;
+    compiled = freesasa_selection_compile(command);
+    if (compiled != NULL) {
+        selection = freesasa_selection_apply(compiled, structure, result, NULL);
+        freesasa_compiled_selection_free(compiled);
     }
 
-    selection = freesasa_selection_alloc(name, command);
-    if (selection == NULL) {
-        mem_fail();
-        return NULL;
-    }
-
-    selection->area = area;
-    selection->n_atoms = n_atoms;
+    if (selection == NULL) fail_msg("");
 
     return selection;
 }
@@ -866,8 +1241,34 @@ int freesasa_select_area(const char *command,
                          const freesasa_structure *structure,
                          const freesasa_result *result)
 {
-    int ret = select_area_impl(command, name, area, structure, result);
-    if (ret >= 0) return FREESASA_SUCCESS;
+    freesasa_compiled_selection *compiled;
+    freesasa_selection *selection = NULL;
+    int ret = FREESASA_SUCCESS;
+
+    assert(name);
+    assert(area);
+    assert(command);
+
+    *area = 0;
+    name[0] = '\0';
+
+    compiled = freesasa_selection_compile(command);
+    if (compiled != NULL) {
+        selection = freesasa_selection_apply(compiled, structure, result, NULL);
+    }
+
+    if (selection == NULL) {
+        ret = fail_msg("problems parsing expression '%s'", command);
+    } else {
+        *area = selection->area;
+        strcpy(name, selection->name);
+        if (compiled->warn)
+            ret = freesasa_warn("in %s(): There were warnings", __func__);
+    }
+
+    freesasa_selection_free(selection);
+    freesasa_compiled_selection_free(compiled);
+
     return ret;
 }
 
@@ -885,11 +1286,11 @@ int freesasa_selection_parse_error(expression *e,
 
 START_TEST(test_selection)
 {
-    struct selection *s1, *s2, *s3, *s4;
+    struct selection *s1, *s2, *s3;
     static const expression empty_expression = {
         .right = NULL, .left = NULL, .value = NULL, .type = E_SELECTION};
     freesasa_structure *structure = freesasa_structure_new();
-    expression r, l, e, e_symbol;
+    expression r, l, e, e_symbol, r_symbol, l_symbol;
 
     freesasa_structure_add_atom(structure, " CA ", "ALA", "   1", 'A', 0, 0, 0);
     freesasa_structure_add_atom(structure, " O  ", "ALA", "   1", 'A', 10, 10, 10);
@@ -897,9 +1298,8 @@ START_TEST(test_selection)
     s1 = selection_new(freesasa_structure_n(structure));
     s2 = selection_new(freesasa_structure_n(structure));
     s3 = selection_new(freesasa_structure_n(structure));
-    s4 = selection_new(freesasa_structure_n(structure));
 
-    r = l = e = e_symbol = empty_expression;
+    r = l = e = e_symbol = r_symbol = l_symbol = empty_expression;
     e.type = E_PLUS;
     e.right = &r;
     e.left = &l;
@@ -907,30 +1307,30 @@ START_TEST(test_selection)
     r.type = E_ID;
     l.value = "O";
     l.type = E_ID;
-    e_symbol.type = E_SYMBOL;
+    e_symbol.type = r_symbol.type = l_symbol.type = E_SYMBOL;
     e_symbol.left = &e;
+    r_symbol.left = &r;
+    l_symbol.left = &l;
 
     /* select_symbol */
-    select_list(E_SYMBOL, s1, structure, &r);
-    ck_assert_int_eq(s1->atom[0], 1);
-    ck_assert_int_eq(s1->atom[1], 0);
-    select_list(E_SYMBOL, s2, structure, &l);
-    ck_assert_int_eq(s2->atom[0], 0);
-    ck_assert_int_eq(s2->atom[1], 1);
-    select_list(E_SYMBOL, s3, structure, &e);
-    ck_assert_int_eq(s3->atom[0], 1);
-    ck_assert_int_eq(s3->atom[1], 1);
-    select_atoms(s4, &e_symbol, structure);
-    ck_assert_int_eq(s4->atom[0], 1);
-    ck_assert_int_eq(s4->atom[1], 1);
+    select_atoms(s1, &r_symbol, structure);
+    ck_assert_int_eq(selection_has(s1, 0), 1);
+    ck_assert_int_eq(selection_has(s1, 1), 0);
+    select_atoms(s2, &l_symbol, structure);
+    ck_assert_int_eq(selection_has(s2, 0), 0);
+    ck_assert_int_eq(selection_has(s2, 1), 1);
+    select_atoms(s3, &e_symbol, structure);
+    ck_assert_int_eq(selection_has(s3, 0), 1);
+    ck_assert_int_eq(selection_has(s3, 1), 1);
+    ck_assert_int_eq(s3->atom[0], 3);
 
     /* selection_join */
     selection_join(s3, s1, s2, E_AND);
-    ck_assert_int_eq(s3->atom[0], 0);
-    ck_assert_int_eq(s3->atom[1], 0);
+    ck_assert_int_eq(selection_has(s3, 0), 0);
+    ck_assert_int_eq(selection_has(s3, 1), 0);
     selection_join(s3, s1, s2, E_OR);
-    ck_assert_int_eq(s3->atom[0], 1);
-    ck_assert_int_eq(s3->atom[1], 1);
+    ck_assert_int_eq(selection_has(s3, 0), 1);
+    ck_assert_int_eq(selection_has(s3, 1), 1);
     freesasa_set_verbosity(FREESASA_V_SILENT);
     ck_assert_int_eq(selection_join(NULL, s1, s2, E_OR), FREESASA_FAIL);
     ck_assert_int_eq(selection_join(s3, NULL, s1, E_OR), FREESASA_FAIL);
@@ -938,8 +1338,11 @@ START_TEST(test_selection)
 
     /* selection_not */
     ck_assert_int_eq(selection_not(s3), FREESASA_SUCCESS);
-    ck_assert_int_eq(s3->atom[0], 0);
-    ck_assert_int_eq(s3->atom[1], 0);
+    ck_assert_int_eq(selection_has(s3, 0), 0);
+    ck_assert_int_eq(selection_has(s3, 1), 0);
+    /* bits after the last atom are not set */
+    ck_assert_int_eq(selection_not(s3), FREESASA_SUCCESS);
+    ck_assert_int_eq(s3->atom[0], 3);
     ck_assert_int_eq(selection_not(NULL), FREESASA_FAIL);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
 }
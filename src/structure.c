@@ -3,8 +3,18 @@
 #endif
 
 #include <assert.h>
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 
+#if USE_THREADS
+#include <pthread.h>
+#define MAX_PARSE_THREADS 16
+#else
+#define MAX_PARSE_THREADS 1
+#endif
+
 #include "classifier.h"
 #include "coord.h"
 #include "freesasa_internal.h"
@@ -27,33 +37,64 @@
 #define ATOMS_CHUNK 512
 #define RESIDUES_CHUNK 64
 #define CHAINS_CHUNK 64
-
+#define STRINGS_CHUNK 4096
+
+/* number of threads used to parse models and chains, 1 by default
+   since warnings from parallel jobs are printed in no particular
+   order */
+static int parse_threads = 1;
+
+/* reallocates an array to hold n elements, leaves it unchanged on failure */
+#define RESIZE_ARRAY(array, n)                                      \
+    do {                                                            \
+        void *resized_ = realloc((array), sizeof(*(array)) * (n)); \
+        if (resized_ == NULL) return mem_fail();                    \
+        (array) = resized_;                                         \
+    } while (0)
+
+/* An atom before it is added to a structure, the strings are not owned */
 struct atom {
-    char *res_name;
-    char *res_number;
-    char *atom_name;
-    char *symbol;
-    char *line;
-    int res_index;
+    const char *res_name;
+    const char *res_number;
+    const char *atom_name;
+    const char *symbol;
+    const char *line; /* points into the pdb_buffer of the structure */
+    int line_length;
     char chain_label;
-    freesasa_atom_class the_class;
 };
 
-static const struct atom empty_atom = {
-    NULL,                 /* res_name */
-    NULL,                 /* res_number */
-    NULL,                 /* atom_name */
-    NULL,                 /* symbol */
-    NULL,                 /* line */
-    -1,                   /* res_index */
-    '\0',                 /* chain_label */
-    FREESASA_ATOM_UNKNOWN /* the_class */
+/* Memory for interned strings, the strings are never moved */
+struct string_chunk {
+    struct string_chunk *next;
+    size_t used;
+    size_t size;
+};
+
+/* Each name is stored once per structure, and atoms refer to it by
+   index. The strings returned by the accessors stay valid when more
+   atoms are added. */
+struct strings {
+    int n;
+    int n_alloc;
+    const char **str;
+    int *slot; /* hash table of index + 1, 0 if empty */
+    int n_slots;
+    struct string_chunk *chunk;
 };
 
+/* One array per field of the atoms */
 struct atoms {
     int n;
     int n_alloc;
-    struct atom **atom;
+    int *res_name;   /* index in strings */
+    int *res_number; /* index in strings */
+    int *atom_name;  /* index in strings */
+    int *symbol;     /* index in strings */
+    const char **line; /* points into the pdb_buffer of the structure, or NULL */
+    int *line_length;
+    int *res_index;
+    char *chain_label;
+    unsigned char *the_class;
     double *radius;
 };
 
@@ -61,7 +102,14 @@ struct residues {
     int n;
     int n_alloc;
     int *first_atom;
-    freesasa_nodearea **reference_area;
+    int *reference; /* index in references, -1 if none */
+};
+
+/* The distinct reference areas of the residues */
+struct references {
+    int n;
+    int n_alloc;
+    freesasa_nodearea **area;
 };
 
 struct chains {
@@ -71,235 +119,416 @@ struct chains {
     int *first_atom; /* first atom of each chain */
 };
 
+/* The classifier template of the latest residue name */
+struct residue_template {
+    const freesasa_classifier *classifier; /* NULL if no template */
+    const struct classifier_residue *residue;
+    char res_name[PDB_ATOM_RES_NAME_STRL + 1];
+};
+
 struct freesasa_structure {
     struct atoms atoms;
     struct residues residues;
+    struct references references;
     struct chains chains;
+    struct strings strings;
     char *classifier_name;
     coord_t *xyz;
-    int model; /* model number */
+    int model;                     /* model number */
+    struct pdb_buffer *pdb_buffer; /* input file, if read from PDB */
+    /* A view owns its residues, chains and radii. The names,
+       references, classifier name and PDB lines belong to parent,
+       and if shares_atoms is set the other atom arrays and the
+       coordinates point into those of parent. */
+    const freesasa_structure *parent;
+    int shares_atoms;
+    /* A structure loaded from a cache has its coordinates, atom names,
+       classes and chain labels, and its residue and chain arrays in
+       the memory-mapped cache (pdb_buffer). It owns its radii, lines
+       and residue indices. See structure_unmap(). */
+    int is_mapped;
+    int res_offset; /* subtracted from atoms.res_index */
+    struct residue_template template; /* see structure_residue_template() */
 };
 
 static int
 guess_symbol(char *symbol,
              const char *name);
 
-static void
-atom_free(struct atom *a)
+static size_t
+string_hash(const char *str)
 {
-    if (a != NULL) {
-        free(a->res_name);
-        free(a->res_number);
-        free(a->atom_name);
-        free(a->symbol);
-        free(a->line);
-        free(a);
+    size_t h = 2166136261u;
+
+    for (; *str; ++str) {
+        h = (h ^ (unsigned char)*str) * 16777619u;
     }
+
+    return h;
 }
 
-struct atoms
-atoms_init()
+static struct strings
+strings_init(void)
 {
-    struct atoms atoms;
-    atoms.n = 0;
-    atoms.n_alloc = 0;
-    atoms.atom = NULL;
-    atoms.radius = NULL;
-    return atoms;
+    struct strings strings;
+
+    strings.n = 0;
+    strings.n_alloc = 0;
+    strings.str = NULL;
+    strings.slot = NULL;
+    strings.n_slots = 0;
+    strings.chunk = NULL;
+
+    return strings;
 }
 
-/* Allocates memory in chunks, ticks up atoms->n if allocation successful */
-static int
-atoms_alloc(struct atoms *atoms)
+static void
+strings_dealloc(struct strings *strings)
 {
-    int i, new_size;
-    void *aa, *ar;
-
-    assert(atoms);
-    assert(atoms->n <= atoms->n_alloc);
+    struct string_chunk *chunk, *next;
 
-    if (atoms->n == atoms->n_alloc) {
-        new_size = atoms->n_alloc + ATOMS_CHUNK;
-        aa = atoms->atom;
-        ar = atoms->radius;
+    for (chunk = strings->chunk; chunk != NULL; chunk = next) {
+        next = chunk->next;
+        free(chunk);
+    }
+    free(strings->str);
+    free(strings->slot);
+    *strings = strings_init();
+}
 
-        atoms->atom = realloc(atoms->atom, sizeof(struct atom *) * new_size);
-        if (atoms->atom == NULL) {
-            atoms->atom = aa;
-            return mem_fail();
-        }
+/* rebuilds the hash table with room for the strings and one more */
+static int
+strings_rehash(struct strings *strings)
+{
+    int *slot, n_slots = 64, i;
+    size_t j;
 
-        for (i = atoms->n_alloc; i < new_size; ++i) {
-            atoms->atom[i] = NULL;
-        }
+    while (n_slots < 2 * (strings->n + 1)) {
+        n_slots *= 2;
+    }
 
-        atoms->radius = realloc(atoms->radius, sizeof(double) * new_size);
-        if (atoms->radius == NULL) {
-            atoms->radius = ar;
-            return mem_fail();
-        }
+    slot = calloc(n_slots, sizeof(int));
+    if (slot == NULL) return mem_fail();
 
-        atoms->n_alloc = new_size;
+    for (i = 0; i < strings->n; ++i) {
+        j = string_hash(strings->str[i]) & (n_slots - 1);
+        while (slot[j]) j = (j + 1) & (n_slots - 1);
+        slot[j] = i + 1;
     }
-    ++atoms->n;
+
+    free(strings->slot);
+    strings->slot = slot;
+    strings->n_slots = n_slots;
+
     return FREESASA_SUCCESS;
 }
 
-static void
-atoms_dealloc(struct atoms *atoms)
+/* the slot of str in the hash table, or the empty slot where it belongs */
+static size_t
+strings_slot(const struct strings *strings,
+             const char *str)
 {
-    int i;
-    struct atom **atom;
+    size_t j = string_hash(str) & (strings->n_slots - 1);
 
-    if (atoms) {
-        atom = atoms->atom;
-        if (atom) {
-            for (i = 0; i < atoms->n; ++i)
-                if (atom[i]) atom_free(atom[i]);
-            free(atom);
-        }
-        free(atoms->radius);
-        *atoms = atoms_init();
+    while (strings->slot[j] && strcmp(strings->str[strings->slot[j] - 1], str) != 0) {
+        j = (j + 1) & (strings->n_slots - 1);
     }
+
+    return j;
+}
+
+/* the index of str, or -1 if it is not in the table */
+static int
+strings_index(const struct strings *strings,
+              const char *str)
+{
+    if (strings->n_slots == 0) return -1;
+
+    return strings->slot[strings_slot(strings, str)] - 1;
 }
 
-static struct atom *
-atom_new(const char *residue_name,
-         const char *residue_number,
-         const char *atom_name,
-         const char *symbol,
-         char chain_label)
+/* Returns the index of str, copying it into the table if it's new, or FREESASA_FAIL */
+static int
+strings_add(struct strings *strings,
+            const char *str)
 {
-    struct atom *a = malloc(sizeof(struct atom));
-    if (a == NULL) goto memerr;
+    struct string_chunk *chunk;
+    size_t j, length, size;
+    char *copy;
 
-    *a = empty_atom;
+    if (2 * (strings->n + 1) > strings->n_slots &&
+        strings_rehash(strings) == FREESASA_FAIL) {
+        return FREESASA_FAIL;
+    }
 
-    a->line = NULL;
-    a->chain_label = chain_label;
-    a->res_index = -1;
+    j = strings_slot(strings, str);
+    if (strings->slot[j]) return strings->slot[j] - 1;
 
-    a->res_name = strdup(residue_name);
-    a->res_number = strdup(residue_number);
-    a->atom_name = strdup(atom_name);
-    a->symbol = strdup(symbol);
-    a->the_class = FREESASA_ATOM_UNKNOWN;
+    if (strings->n == strings->n_alloc) {
+        RESIZE_ARRAY(strings->str, strings->n_alloc ? 2 * strings->n_alloc : 64);
+        strings->n_alloc = strings->n_alloc ? 2 * strings->n_alloc : 64;
+    }
 
-    if (!a->res_name || !a->res_number || !a->atom_name ||
-        !a->symbol) {
-        goto memerr;
+    length = strlen(str) + 1;
+    chunk = strings->chunk;
+    if (chunk == NULL || chunk->size - chunk->used < length) {
+        size = length > STRINGS_CHUNK ? length : STRINGS_CHUNK;
+        chunk = malloc(sizeof(struct string_chunk) + size);
+        if (chunk == NULL) return mem_fail();
+        chunk->next = strings->chunk;
+        chunk->used = 0;
+        chunk->size = size;
+        strings->chunk = chunk;
     }
+    copy = (char *)(chunk + 1) + chunk->used;
+    memcpy(copy, str, length);
+    chunk->used += length;
 
-    return a;
+    strings->str[strings->n] = copy;
+    strings->slot[j] = ++strings->n;
 
-memerr:
-    mem_fail();
-    atom_free(a);
-    return NULL;
+    return strings->n - 1;
+}
+
+static struct atoms
+atoms_init(void)
+{
+    struct atoms atoms;
+
+    atoms.n = 0;
+    atoms.n_alloc = 0;
+    atoms.res_name = NULL;
+    atoms.res_number = NULL;
+    atoms.atom_name = NULL;
+    atoms.symbol = NULL;
+    atoms.line = NULL;
+    atoms.line_length = NULL;
+    atoms.res_index = NULL;
+    atoms.chain_label = NULL;
+    atoms.the_class = NULL;
+    atoms.radius = NULL;
+
+    return atoms;
 }
 
-static struct atom *
-atom_new_from_line(const char *line,
-                   char *alt_label)
+/* Resizes the arrays to hold n_alloc atoms, n_alloc > 0 */
+static int
+atoms_resize(struct atoms *atoms,
+             int n_alloc)
 {
-    char aname[PDB_ATOM_NAME_STRL + 1], rname[PDB_ATOM_RES_NAME_STRL + 1],
-        rnumber[PDB_ATOM_RES_NUMBER_STRL + 1], symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    int flag;
-    struct atom *a;
+    assert(atoms);
+    assert(n_alloc > 0 && n_alloc >= atoms->n);
+
+    RESIZE_ARRAY(atoms->res_name, n_alloc);
+    RESIZE_ARRAY(atoms->res_number, n_alloc);
+    RESIZE_ARRAY(atoms->atom_name, n_alloc);
+    RESIZE_ARRAY(atoms->symbol, n_alloc);
+    RESIZE_ARRAY(atoms->line, n_alloc);
+    RESIZE_ARRAY(atoms->line_length, n_alloc);
+    RESIZE_ARRAY(atoms->res_index, n_alloc);
+    RESIZE_ARRAY(atoms->chain_label, n_alloc);
+    RESIZE_ARRAY(atoms->the_class, n_alloc);
+    RESIZE_ARRAY(atoms->radius, n_alloc);
+    atoms->n_alloc = n_alloc;
+
+    return FREESASA_SUCCESS;
+}
 
-    assert(line);
+/* Grows the arrays geometrically, ticks up atoms->n if allocation successful */
+static int
+atoms_alloc(struct atoms *atoms)
+{
+    assert(atoms);
+    assert(atoms->n <= atoms->n_alloc);
 
-    if (alt_label) *alt_label = freesasa_pdb_get_alt_coord_label(line);
+    if (atoms->n == atoms->n_alloc &&
+        atoms_resize(atoms, atoms->n_alloc ? 2 * atoms->n_alloc : ATOMS_CHUNK)) {
+        return FREESASA_FAIL;
+    }
+    ++atoms->n;
 
-    freesasa_pdb_get_atom_name(aname, line);
-    freesasa_pdb_get_res_name(rname, line);
-    freesasa_pdb_get_res_number(rnumber, line);
+    return FREESASA_SUCCESS;
+}
 
-    flag = freesasa_pdb_get_symbol(symbol, line);
-    if (flag == FREESASA_FAIL || (symbol[0] == ' ' && symbol[1] == ' ')) {
-        guess_symbol(symbol, aname);
+static void
+atoms_dealloc(struct atoms *atoms)
+{
+    if (atoms) {
+        free(atoms->res_name);
+        free(atoms->res_number);
+        free(atoms->atom_name);
+        free(atoms->symbol);
+        free(atoms->line);
+        free(atoms->line_length);
+        free(atoms->res_index);
+        free(atoms->chain_label);
+        free(atoms->the_class);
+        free(atoms->radius);
+        *atoms = atoms_init();
     }
+}
 
-    a = atom_new(rname, rnumber, aname, symbol, freesasa_pdb_get_chain_label(line));
+/**
+    Fills in an atom from a decoded PDB record, src is the original
+    line in the input buffer, that the atom will point to. The atom
+    refers to the strings of the record.
+ */
+static void
+atom_from_record(struct atom *a,
+                 struct pdb_atom_record *record,
+                 const char *src,
+                 int src_length)
+{
+    assert(a);
+    assert(record);
 
-    if (a != NULL) {
-        a->line = strdup(line);
-        if (a->line == NULL) {
-            mem_fail();
-            atom_free(a);
-            a = NULL;
-        }
+    if (record->has_symbol == FREESASA_FAIL ||
+        (record->symbol[0] == ' ' && record->symbol[1] == ' ')) {
+        guess_symbol(record->symbol, record->atom_name);
     }
 
-    return a;
+    a->res_name = record->res_name;
+    a->res_number = record->res_number;
+    a->atom_name = record->atom_name;
+    a->symbol = record->symbol;
+    a->line = src;
+    a->line_length = src_length;
+    a->chain_label = record->chain_label;
 }
 
 static struct residues
-residues_init()
+residues_init(void)
 {
     struct residues res;
 
     res.n = 0;
     res.n_alloc = 0;
-    res.first_atom = 0;
-    res.reference_area = 0;
+    res.first_atom = NULL;
+    res.reference = NULL;
 
     return res;
 }
 
 static int
-residues_alloc(struct residues *residues)
+residues_resize(struct residues *residues,
+                int n_alloc)
 {
-    int new_size;
-    void *fa, *ra;
-
     assert(residues);
-    assert(residues->n <= residues->n_alloc);
+    assert(n_alloc > 0 && n_alloc >= residues->n);
 
-    if (residues->n == residues->n_alloc) {
-        new_size = residues->n_alloc + RESIDUES_CHUNK;
-        fa = residues->first_atom;
-        ra = residues->reference_area;
+    RESIZE_ARRAY(residues->first_atom, n_alloc);
+    RESIZE_ARRAY(residues->reference, n_alloc);
+    residues->n_alloc = n_alloc;
 
-        residues->first_atom = realloc(residues->first_atom,
-                                       sizeof(int) * new_size);
-        if (residues->first_atom == NULL) {
-            residues->first_atom = fa;
-            return mem_fail();
-        }
+    return FREESASA_SUCCESS;
+}
 
-        residues->reference_area = realloc(residues->reference_area,
-                                           sizeof(freesasa_nodearea *) * new_size);
-        if (residues->reference_area == NULL) {
-            residues->reference_area = ra;
-            return mem_fail();
-        }
+static int
+residues_alloc(struct residues *residues)
+{
+    assert(residues);
+    assert(residues->n <= residues->n_alloc);
 
-        residues->n_alloc = new_size;
+    if (residues->n == residues->n_alloc &&
+        residues_resize(residues, residues->n_alloc ? 2 * residues->n_alloc : RESIDUES_CHUNK)) {
+        return FREESASA_FAIL;
     }
     ++residues->n;
+
     return FREESASA_SUCCESS;
 }
 
 static void
 residues_dealloc(struct residues *residues)
 {
-    int i;
-
     if (residues) {
         free(residues->first_atom);
-        if (residues->reference_area) {
-            for (i = 0; i < residues->n; ++i) {
-                free(residues->reference_area[i]);
-            }
-        }
-        free(residues->reference_area);
+        free(residues->reference);
         *residues = residues_init();
     }
 }
 
+static struct references
+references_init(void)
+{
+    struct references references;
+
+    references.n = 0;
+    references.n_alloc = 0;
+    references.area = NULL;
+
+    return references;
+}
+
+static void
+references_dealloc(struct references *references)
+{
+    int i;
+
+    if (references) {
+        for (i = 0; i < references->n; ++i) {
+            free(references->area[i]);
+        }
+        free(references->area);
+        *references = references_init();
+    }
+}
+
+static int
+reference_eq(const freesasa_nodearea *a,
+             const freesasa_nodearea *b)
+{
+    return (a->name == b->name || (a->name && b->name && strcmp(a->name, b->name) == 0)) &&
+           a->total == b->total && a->main_chain == b->main_chain &&
+           a->side_chain == b->side_chain && a->polar == b->polar &&
+           a->apolar == b->apolar && a->unknown == b->unknown;
+}
+
+/**
+    Returns the index of a copy of the reference in the structure,
+    adding it if there is none, or FREESASA_FAIL. There are only a few
+    residue types, so the residues share the copies, and the names
+    are stored with the other strings of the structure.
+ */
+static int
+structure_add_reference(freesasa_structure *s,
+                        const freesasa_nodearea *reference,
+                        int last)
+{
+    struct references *references = &s->references;
+    freesasa_nodearea *area;
+    int i, name;
+
+    /* consecutive residues often have the same type */
+    if (last >= 0 && reference_eq(references->area[last], reference)) return last;
+
+    for (i = 0; i < references->n; ++i) {
+        if (reference_eq(references->area[i], reference)) return i;
+    }
+
+    if (references->n == references->n_alloc) {
+        RESIZE_ARRAY(references->area, references->n_alloc ? 2 * references->n_alloc : 32);
+        references->n_alloc = references->n_alloc ? 2 * references->n_alloc : 32;
+    }
+
+    area = malloc(sizeof(freesasa_nodearea));
+    if (area == NULL) return mem_fail();
+    *area = *reference;
+    if (reference->name != NULL) {
+        name = strings_add(&s->strings, reference->name);
+        if (name == FREESASA_FAIL) {
+            free(area);
+            return FREESASA_FAIL;
+        }
+        area->name = s->strings.str[name];
+    }
+    references->area[references->n] = area;
+
+    return references->n++;
+}
+
 static struct chains
-chains_init()
+chains_init(void)
 {
     struct chains ch;
 
@@ -363,10 +592,18 @@ freesasa_structure_new(void)
 
     s->atoms = atoms_init();
     s->residues = residues_init();
+    s->references = references_init();
     s->chains = chains_init();
+    s->strings = strings_init();
     s->xyz = freesasa_coord_new();
     s->model = 1;
     s->classifier_name = NULL;
+    s->pdb_buffer = NULL;
+    s->parent = NULL;
+    s->shares_atoms = 0;
+    s->is_mapped = 0;
+    s->res_offset = 0;
+    s->template.classifier = NULL;
 
     if (s->xyz == NULL) goto memerr;
 
@@ -380,11 +617,27 @@ memerr:
 void freesasa_structure_free(freesasa_structure *s)
 {
     if (s != NULL) {
-        atoms_dealloc(&s->atoms);
-        residues_dealloc(&s->residues);
-        chains_dealloc(&s->chains);
+        if (s->shares_atoms) {
+            free(s->atoms.radius);
+        } else if (s->is_mapped) {
+            free(s->atoms.radius);
+            free(s->atoms.line);
+            free(s->atoms.line_length);
+            free(s->atoms.res_index);
+        } else {
+            atoms_dealloc(&s->atoms);
+        }
+        if (!s->is_mapped) {
+            residues_dealloc(&s->residues);
+            chains_dealloc(&s->chains);
+        }
         if (s->xyz != NULL) freesasa_coord_free(s->xyz);
-        free(s->classifier_name);
+        if (s->parent == NULL) {
+            references_dealloc(&s->references);
+            strings_dealloc(&s->strings);
+            free(s->classifier_name);
+            freesasa_pdb_buffer_free(s->pdb_buffer);
+        }
         free(s);
     }
 }
@@ -448,20 +701,20 @@ structure_add_chain(freesasa_structure *s,
 
 static int
 structure_add_residue(freesasa_structure *s,
-                      const freesasa_classifier *classifier,
+                      const freesasa_nodearea *reference,
                       const struct atom *a,
+                      int res_number,
                       int i_latest_atom)
 {
-    int n = s->residues.n + 1;
-    const freesasa_nodearea *reference = NULL;
+    int n = s->residues.n + 1, ref;
 
     /* register a new residue if it's the first atom, or if the
        residue number or chain label of the current atom is different
        from the previous one */
     if (!(s->residues.n == 0 ||
           (i_latest_atom > 0 &&
-           (strcmp(a->res_number, s->atoms.atom[i_latest_atom - 1]->res_number) ||
-            a->chain_label != s->atoms.atom[i_latest_atom - 1]->chain_label)))) {
+           (res_number != s->atoms.res_number[i_latest_atom - 1] ||
+            a->chain_label != s->atoms.chain_label[i_latest_atom - 1])))) {
         return FREESASA_SUCCESS;
     }
 
@@ -470,30 +723,58 @@ structure_add_residue(freesasa_structure *s,
     }
     s->residues.first_atom[n - 1] = i_latest_atom;
 
-    s->residues.reference_area[n - 1] = NULL;
-    reference = freesasa_classifier_residue_reference(classifier, a->res_name);
+    s->residues.reference[n - 1] = -1;
     if (reference != NULL) {
-        s->residues.reference_area[n - 1] = malloc(sizeof(freesasa_nodearea));
-        if (s->residues.reference_area[n - 1] == NULL)
-            return mem_fail();
-        *s->residues.reference_area[n - 1] = *reference;
+        ref = structure_add_reference(s, reference, n > 1 ? s->residues.reference[n - 2] : -1);
+        if (ref == FREESASA_FAIL) return fail_msg("");
+        s->residues.reference[n - 1] = ref;
     }
 
     return FREESASA_SUCCESS;
 }
 
 /**
-    Get the radius of an atom, and fail, warn and/or guess depending
-    on the options.
+    Get the classifier template of the residue of an atom. The residue
+    is only looked up in the classifier when its name differs from
+    that of the previous atom, so that each residue is resolved once
+    and its atoms are looked up in the template.
+ */
+static const struct classifier_residue *
+structure_residue_template(freesasa_structure *s,
+                           const char *res_name,
+                           const freesasa_classifier *classifier)
+{
+    struct residue_template *t = &s->template;
+
+    if (t->classifier == classifier && strcmp(t->res_name, res_name) == 0) {
+        return t->residue;
+    }
+
+    t->residue = freesasa_classifier_template(classifier, res_name);
+    t->classifier = NULL;
+    if (strlen(res_name) <= PDB_ATOM_RES_NAME_STRL) {
+        strcpy(t->res_name, res_name);
+        t->classifier = classifier;
+    }
+
+    return t->residue;
+}
+
+/**
+    Get the radius and class of an atom from the template of its
+    residue, and fail, warn and/or guess the radius depending on the
+    options.
  */
 static int
 structure_check_atom_radius(double *radius,
-                            struct atom *a,
+                            freesasa_atom_class *the_class,
+                            const struct atom *a,
+                            const struct classifier_residue *residue,
                             const freesasa_classifier *classifier,
                             int options)
 {
-    *radius = freesasa_classifier_radius(classifier, a->res_name, a->atom_name);
-    if (*radius < 0) {
+    if (freesasa_classifier_template_lookup(classifier, residue, a->atom_name,
+                                            radius, the_class) == FREESASA_WARN) {
         if (options & FREESASA_HALT_AT_UNKNOWN) {
             return fail_msg("atom '%s %s' unknown",
                             a->res_name, a->atom_name);
@@ -545,22 +826,92 @@ structure_register_classifier(freesasa_structure *structure,
    assigned and the caller is expected to replace it with a correct
    radius later.
 
-   The atom a should be a pointer to a heap address, this will not be cloned.
+   The strings of the atom are copied to the string table of the
+   structure.
  */
+/* Copies the arrays of a structure loaded from a cache out of the
+   cache, so that atoms can be added to it */
+static int
+structure_unmap(freesasa_structure *s)
+{
+    struct atoms atoms = atoms_init();
+    struct residues residues = residues_init();
+    struct chains chains = chains_init();
+    const struct atoms *from = &s->atoms;
+    coord_t *xyz = NULL;
+    int n = from->n, nr = s->residues.n, nc = s->chains.n;
+
+    assert(s->is_mapped);
+
+    if (atoms_resize(&atoms, n + 1) || residues_resize(&residues, nr + 1)) goto cleanup;
+    chains.first_atom = malloc(sizeof(int) * (nc + 1));
+    chains.labels = malloc(nc + 1);
+    xyz = freesasa_coord_clone(s->xyz);
+    if (!chains.first_atom || !chains.labels || !xyz) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    memcpy(atoms.res_name, from->res_name, sizeof(int) * n);
+    memcpy(atoms.res_number, from->res_number, sizeof(int) * n);
+    memcpy(atoms.atom_name, from->atom_name, sizeof(int) * n);
+    memcpy(atoms.symbol, from->symbol, sizeof(int) * n);
+    memcpy(atoms.line, from->line, sizeof(const char *) * n);
+    memcpy(atoms.line_length, from->line_length, sizeof(int) * n);
+    memcpy(atoms.res_index, from->res_index, sizeof(int) * n);
+    memcpy(atoms.chain_label, from->chain_label, n);
+    memcpy(atoms.the_class, from->the_class, n);
+    memcpy(atoms.radius, from->radius, sizeof(double) * n);
+    atoms.n = n;
+    memcpy(residues.first_atom, s->residues.first_atom, sizeof(int) * nr);
+    memcpy(residues.reference, s->residues.reference, sizeof(int) * nr);
+    residues.n = nr;
+    memcpy(chains.first_atom, s->chains.first_atom, sizeof(int) * nc);
+    memcpy(chains.labels, s->chains.labels, nc + 1);
+    chains.n = chains.n_alloc = nc;
+
+    free(s->atoms.radius);
+    free(s->atoms.line);
+    free(s->atoms.line_length);
+    free(s->atoms.res_index);
+    freesasa_coord_free(s->xyz);
+    s->atoms = atoms;
+    s->residues = residues;
+    s->chains = chains;
+    s->xyz = xyz;
+    s->is_mapped = 0;
+
+    return FREESASA_SUCCESS;
+
+cleanup:
+    atoms_dealloc(&atoms);
+    residues_dealloc(&residues);
+    chains_dealloc(&chains);
+    freesasa_coord_free(xyz);
+    return fail_msg("");
+}
+
 static int
 structure_add_atom(freesasa_structure *structure,
-                   struct atom *atom,
+                   const struct atom *atom,
                    double *xyz,
                    const freesasa_classifier *classifier,
                    int options)
 {
-    int na, ret;
+    struct atoms *atoms = &structure->atoms;
+    const struct classifier_residue *residue;
+    const freesasa_nodearea *reference;
+    freesasa_atom_class the_class;
+    int na, ret, res_name, res_number, atom_name, symbol;
     double r;
 
     assert(structure);
     assert(atom);
     assert(xyz);
 
+    if (structure->parent != NULL) return fail_msg("can't add atoms to a structure view");
+    if (structure->is_mapped && structure_unmap(structure)) return fail_msg("");
+
     /* let the stricter option override if both are specified */
     if (options & FREESASA_SKIP_UNKNOWN && options & FREESASA_HALT_AT_UNKNOWN)
         options &= ~FREESASA_SKIP_UNKNOWN;
@@ -570,37 +921,57 @@ structure_add_atom(freesasa_structure *structure,
     }
     structure_register_classifier(structure, classifier);
 
+    residue = structure_residue_template(structure, atom->res_name, classifier);
+    reference = residue != NULL ? &residue->max_area : NULL;
+
     /* calculate radius and check if we should keep the atom (based on options) */
     if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
+        freesasa_classifier_template_lookup(classifier, residue, atom->atom_name,
+                                            &r, &the_class);
         r = 1; /* fix it later */
     } else {
-        ret = structure_check_atom_radius(&r, atom, classifier, options);
+        ret = structure_check_atom_radius(&r, &the_class, atom, residue, classifier, options);
         if (ret == FREESASA_FAIL) return fail_msg("halting at unknown atom");
         if (ret == FREESASA_WARN) return FREESASA_WARN;
     }
     assert(r >= 0);
 
-    /* If it's a keeper, allocate memory */
-    if (atoms_alloc(&structure->atoms) == FREESASA_FAIL)
+    /* If it's a keeper, store the strings and allocate memory */
+    if ((res_name = strings_add(&structure->strings, atom->res_name)) == FREESASA_FAIL ||
+        (res_number = strings_add(&structure->strings, atom->res_number)) == FREESASA_FAIL ||
+        (atom_name = strings_add(&structure->strings, atom->atom_name)) == FREESASA_FAIL ||
+        (symbol = strings_add(&structure->strings, atom->symbol)) == FREESASA_FAIL) {
+        return fail_msg("");
+    }
+
+    if (atoms_alloc(atoms) == FREESASA_FAIL)
         return fail_msg("");
-    na = structure->atoms.n;
+    na = atoms->n;
 
     /* Store coordinates */
-    if (freesasa_coord_append(structure->xyz, xyz, 1) == FREESASA_FAIL)
+    if (freesasa_coord_append(structure->xyz, xyz, 1) == FREESASA_FAIL) {
+        --atoms->n;
         return mem_fail();
+    }
 
     /* Check if this is a new chain and if so add it */
     if (structure_add_chain(structure, atom->chain_label, na - 1) == FREESASA_FAIL)
         return mem_fail();
 
     /* Check if this is a new residue, and if so add it */
-    if (structure_add_residue(structure, classifier, atom, na - 1) == FREESASA_FAIL)
+    if (structure_add_residue(structure, reference, atom, res_number, na - 1) == FREESASA_FAIL)
         return mem_fail();
 
-    atom->the_class = freesasa_classifier_class(classifier, atom->res_name, atom->atom_name);
-    atom->res_index = structure->residues.n - 1;
-    structure->atoms.radius[na - 1] = r;
-    structure->atoms.atom[na - 1] = atom;
+    atoms->res_name[na - 1] = res_name;
+    atoms->res_number[na - 1] = res_number;
+    atoms->atom_name[na - 1] = atom_name;
+    atoms->symbol[na - 1] = symbol;
+    atoms->line[na - 1] = atom->line;
+    atoms->line_length[na - 1] = atom->line_length;
+    atoms->res_index[na - 1] = structure->residues.n - 1;
+    atoms->chain_label[na - 1] = atom->chain_label;
+    atoms->the_class[na - 1] = the_class;
+    atoms->radius[na - 1] = r;
 
     return FREESASA_SUCCESS;
 }
@@ -611,66 +982,73 @@ structure_add_atom(freesasa_structure *structure,
     went wrong.
  */
 static freesasa_structure *
-from_pdb_impl(FILE *pdb_file,
+from_pdb_impl(struct pdb_buffer *buffer,
               struct file_range it,
               const freesasa_classifier *classifier,
               int options)
 {
     char line[PDB_MAX_LINE_STRL];
     char alt, the_alt = ' ';
+    const char *src;
     double v[3], r;
     int ret;
-    struct atom *a = NULL;
+    size_t pos, next, len;
+    struct pdb_atom_record record;
+    struct atom a;
     freesasa_structure *s = freesasa_structure_new();
 
-    assert(pdb_file);
+    assert(buffer);
 
     if (s == NULL) return NULL;
 
-    fseek(pdb_file, it.begin, SEEK_SET);
+    /* the atoms point to their lines in the buffer */
+    s->pdb_buffer = freesasa_pdb_buffer_ref(buffer);
 
-    while (fgets(line, PDB_MAX_LINE_STRL, pdb_file) != NULL && ftell(pdb_file) <= it.end) {
+    for (pos = it.begin; pos < buffer->size; pos = next) {
+        next = freesasa_pdb_buffer_next_line(buffer, pos);
+        if (next > (size_t)it.end) break;
 
-        if (strncmp("ATOM", line, 4) == 0 || ((options & FREESASA_INCLUDE_HETATM) &&
-                                              (strncmp("HETATM", line, 6) == 0))) {
-            if (freesasa_pdb_ishydrogen(line) &&
+        src = buffer->data + pos;
+        len = next - pos;
+
+        /* atom records are decoded in place, without copying the line */
+        if ((len >= 4 && strncmp("ATOM", src, 4) == 0) ||
+            ((options & FREESASA_INCLUDE_HETATM) &&
+             len >= 6 && strncmp("HETATM", src, 6) == 0)) {
+            freesasa_pdb_decode_atom(&record, src, len);
+            if (record.is_hydrogen &&
                 !(options & FREESASA_INCLUDE_HYDROGEN))
                 continue;
 
-            a = atom_new_from_line(line, &alt);
-            if (a == NULL)
-                goto cleanup;
-
+            alt = record.alt_label;
             if ((alt != ' ' && the_alt == ' ') || (alt == ' '))
                 the_alt = alt;
             else if (alt != ' ' && alt != the_alt) {
-                atom_free(a);
-                a = NULL;
                 continue;
             }
 
-            ret = freesasa_pdb_get_coord(v, line);
+            atom_from_record(&a, &record, src, (int)len);
+
+            ret = freesasa_pdb_decode_coord(v, src, len);
             if (ret == FREESASA_FAIL)
                 goto cleanup;
 
-            ret = structure_add_atom(s, a, v, classifier, options);
+            ret = structure_add_atom(s, &a, v, classifier, options);
             if (ret == FREESASA_FAIL) {
                 goto cleanup;
             } else if (ret == FREESASA_WARN) {
-                atom_free(a);
-                a = NULL;
                 continue;
             }
 
             if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
-                ret = freesasa_pdb_get_occupancy(&r, line);
+                ret = freesasa_pdb_decode_occupancy(&r, src, len);
                 if (ret == FREESASA_FAIL)
                     goto cleanup;
                 s->atoms.radius[s->atoms.n - 1] = r;
             }
-        }
-
-        if (!(options & FREESASA_JOIN_MODELS)) {
+        } else if (!(options & FREESASA_JOIN_MODELS) &&
+                   (src[0] == 'M' || src[0] == 'E')) {
+            freesasa_pdb_buffer_get_line(line, buffer, pos, next);
             if (strncmp("MODEL", line, 5) == 0) sscanf(line + 10, "%d", &s->model);
             if (strncmp("ENDMDL", line, 6) == 0) break;
         }
@@ -685,7 +1063,6 @@ from_pdb_impl(FILE *pdb_file,
 
 cleanup:
     fail_msg("");
-    atom_free(a);
     freesasa_structure_free(s);
     return NULL;
 }
@@ -701,7 +1078,7 @@ structure_add_atom_wopt_impl(freesasa_structure *structure,
                              const freesasa_classifier *classifier,
                              int options)
 {
-    struct atom *a;
+    struct atom a;
     char my_symbol[PDB_ATOM_SYMBOL_STRL + 1];
     double v[3] = {x, y, z};
     int ret, warn = 0;
@@ -721,14 +1098,15 @@ structure_add_atom_wopt_impl(freesasa_structure *structure,
         ++warn;
     }
 
-    a = atom_new(residue_name, residue_number, atom_name, my_symbol, chain_label);
-    if (a == NULL) return mem_fail();
+    a.res_name = residue_name;
+    a.res_number = residue_number;
+    a.atom_name = atom_name;
+    a.symbol = my_symbol;
+    a.line = NULL;
+    a.line_length = 0;
+    a.chain_label = chain_label;
 
-    ret = structure_add_atom(structure, a, v, classifier, options);
-
-    if (ret == FREESASA_FAIL ||
-        (ret == FREESASA_WARN && options & FREESASA_SKIP_UNKNOWN))
-        atom_free(a);
+    ret = structure_add_atom(structure, &a, v, classifier, options);
 
     if (!ret && warn) return FREESASA_WARN;
 
@@ -777,120 +1155,1147 @@ int freesasa_structure_add_cif_atom(freesasa_structure *structure,
                                         classifier, options);
 }
 
-freesasa_structure *
-freesasa_structure_from_pdb(FILE *pdb_file,
-                            const freesasa_classifier *classifier,
-                            int options)
+/* Radius, class and symbol of a combination of residue and atom name */
+struct atom_template {
+    int res_name; /* index in strings, -1 if the slot is empty */
+    int atom_name;
+    int symbol;
+    freesasa_atom_class the_class;
+    double radius; /* negative if the atom should be skipped */
+};
+
+struct atom_templates {
+    struct atom_template *slot;
+    int n;
+    int n_slots;
+};
+
+static size_t
+atom_template_hash(int res_name,
+                   int atom_name)
 {
-    assert(pdb_file);
-    return from_pdb_impl(pdb_file, freesasa_whole_file(pdb_file),
-                         classifier, options);
+    return (size_t)res_name * 2654435761u ^ (size_t)atom_name * 40503u;
 }
 
-freesasa_structure **
-freesasa_structure_array(FILE *pdb,
-                         int *n,
-                         const freesasa_classifier *classifier,
-                         int options)
+static int
+atom_templates_resize(struct atom_templates *templates,
+                      int n_slots)
 {
-    struct file_range *models = NULL, *chains = NULL;
-    struct file_range whole_file;
-    int n_models = 0, n_chains = 0, j0, n_new_chains, i, j;
-    freesasa_structure **ss = NULL, **ssb;
+    struct atom_template *slot = malloc(sizeof(struct atom_template) * n_slots), *t;
+    size_t j;
+    int i;
 
-    assert(pdb);
-    assert(n);
+    if (slot == NULL) return mem_fail();
 
-    if (!(options & FREESASA_SEPARATE_MODELS ||
-          options & FREESASA_SEPARATE_CHAINS)) {
-        fail_msg("options need to specify at least one of FREESASA_SEPARATE_CHAINS "
-                 "and FREESASA_SEPARATE_MODELS");
-        return NULL;
+    for (i = 0; i < n_slots; ++i) {
+        slot[i].res_name = -1;
+    }
+    for (i = 0; i < templates->n_slots; ++i) {
+        t = &templates->slot[i];
+        if (t->res_name < 0) continue;
+        j = atom_template_hash(t->res_name, t->atom_name) & (n_slots - 1);
+        while (slot[j].res_name >= 0) j = (j + 1) & (n_slots - 1);
+        slot[j] = *t;
     }
 
-    whole_file = freesasa_whole_file(pdb);
-    n_models = freesasa_pdb_get_models(pdb, &models);
+    free(templates->slot);
+    templates->slot = slot;
+    templates->n_slots = n_slots;
 
-    if (n_models == FREESASA_FAIL) {
-        fail_msg("problems reading PDB-file");
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Finds the template of the names, or classifies them and adds a
+    new template. Radii and classes are only looked up if they are
+    not given by the caller. Returns NULL if halting at unknown atom
+    or if memory allocation fails.
+ */
+static const struct atom_template *
+atom_template(struct atom_templates *templates,
+              freesasa_structure *s,
+              int res_name,
+              int atom_name,
+              int need_radius,
+              int need_class,
+              const freesasa_classifier *classifier,
+              int options)
+{
+    struct atom_template *t;
+    struct atom a;
+    freesasa_atom_class the_class;
+    double radius;
+    char symbol[PDB_ATOM_SYMBOL_STRL + 1], name[PDB_ATOM_NAME_STRL + 1] = {0};
+    size_t j;
+    int ret;
+
+    if (2 * (templates->n + 1) > templates->n_slots &&
+        atom_templates_resize(templates, templates->n_slots ? 2 * templates->n_slots : 64)) {
         return NULL;
     }
-    if (n_models == 0) {
-        models = &whole_file;
-        n_models = 1;
-    }
 
-    /* only keep first model if option not provided */
-    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
+    j = atom_template_hash(res_name, atom_name) & (templates->n_slots - 1);
+    for (t = &templates->slot[j]; t->res_name >= 0; t = &templates->slot[j]) {
+        if (t->res_name == res_name && t->atom_name == atom_name) return t;
+        j = (j + 1) & (templates->n_slots - 1);
+    }
 
-    /* for each model read chains if requested */
-    if (options & FREESASA_SEPARATE_CHAINS) {
-        for (i = 0; i < n_models; ++i) {
-            chains = NULL;
-            n_new_chains = freesasa_pdb_get_chains(pdb, models[i], &chains, options);
+    /* guess_symbol() reads the first four characters */
+    strncpy(name, s->strings.str[atom_name], PDB_ATOM_NAME_STRL);
+    guess_symbol(symbol, name);
+
+    a.res_name = s->strings.str[res_name];
+    a.atom_name = s->strings.str[atom_name];
+    a.symbol = symbol;
+
+    t->radius = 0;
+    if (need_radius) {
+        ret = structure_check_atom_radius(&t->radius, &the_class, &a,
+                                          freesasa_classifier_template(classifier, a.res_name),
+                                          classifier, options);
+        if (ret == FREESASA_FAIL) {
+            fail_msg("halting at unknown atom");
+            return NULL;
+        }
+        if (ret == FREESASA_WARN) t->radius = -1;
+    } else if (need_class) {
+        freesasa_classifier_lookup(classifier, a.res_name, a.atom_name,
+                                   &radius, &the_class, NULL);
+    }
+    t->the_class = need_class ? the_class : FREESASA_ATOM_UNKNOWN;
 
-            if (n_new_chains == FREESASA_FAIL) goto cleanup;
-            if (n_new_chains == 0) {
-                freesasa_warn("in %s(): no chains found (in model %d)", __func__, i + 1);
-                continue;
-            }
+    t->symbol = strings_add(&s->strings, symbol);
+    if (t->symbol == FREESASA_FAIL) {
+        fail_msg("");
+        return NULL;
+    }
+    t->res_name = res_name;
+    t->atom_name = atom_name;
+    ++templates->n;
 
-            ssb = ss;
-            ss = realloc(ss, sizeof(freesasa_structure *) * (n_chains + n_new_chains));
+    return t;
+}
 
-            if (!ss) {
-                ss = ssb;
-                mem_fail();
-                goto cleanup;
-            }
+/* appends the coordinates of atoms first to last - 1 */
+static int
+structure_append_coord(freesasa_structure *s,
+                       const double *xyz,
+                       int first,
+                       int last)
+{
+    if (last > first && freesasa_coord_append(s->xyz, &xyz[3 * first], last - first)) {
+        return fail_msg("");
+    }
+    return FREESASA_SUCCESS;
+}
 
-            j0 = n_chains;
-            n_chains += n_new_chains;
+freesasa_structure *
+freesasa_structure_from_arrays(int n,
+                               const char *const *atom_names,
+                               const char *const *residue_names,
+                               const char *const *residue_numbers,
+                               const char *chain_labels,
+                               const double *xyz,
+                               const double *radii,
+                               const freesasa_atom_class *classes,
+                               const freesasa_classifier *classifier,
+                               int options)
+{
+    freesasa_structure *s = freesasa_structure_new();
+    struct atoms *atoms;
+    struct atom_templates templates = {NULL, 0, 0};
+    const struct atom_template *t;
+    const freesasa_nodearea *reference;
+    int *res_reference = NULL, n_res_reference = 0; /* -2 if not looked up yet */
+    int i, k, first, res_name, res_number, atom_name, ref, last_ref = -1;
+    void *tmp;
 
-            for (j = 0; j < n_new_chains; ++j)
-                ss[j0 + j] = NULL;
+    assert(n >= 0);
+    assert(n == 0 || (atom_names && residue_names && residue_numbers && chain_labels && xyz));
 
-            for (j = 0; j < n_new_chains; ++j) {
-                ss[j0 + j] = from_pdb_impl(pdb, chains[j], classifier, options);
-                if (ss[j0 + j] == NULL) goto cleanup;
-                ss[j0 + j]->model = i + 1;
-            }
+    if (s == NULL) goto cleanup;
+    atoms = &s->atoms;
 
-            free(chains);
+    if (options & FREESASA_SKIP_UNKNOWN && options & FREESASA_HALT_AT_UNKNOWN)
+        options &= ~FREESASA_SKIP_UNKNOWN;
+    if (classifier == NULL) classifier = &freesasa_default_classifier;
+    if (structure_register_classifier(s, classifier) == FREESASA_FAIL) goto cleanup;
+
+    if (atoms_resize(atoms, n > 0 ? n : 1) ||
+        residues_resize(&s->residues, n > 0 ? n : 1)) {
+        goto cleanup;
+    }
+
+    /* the atoms are stored at k, which trails i if atoms are skipped,
+       first is the first atom of the current run of kept atoms */
+    for (i = 0, k = 0, first = 0; i < n; ++i) {
+        if (radii && !(radii[i] >= 0)) {
+            fail_msg("atom %d has invalid radius %f", i, radii[i]);
+            goto cleanup;
         }
-        *n = n_chains;
-    } else {
-        ss = malloc(sizeof(freesasa_structure *) * n_models);
-        if (!ss) {
-            mem_fail();
+
+        if ((res_name = strings_add(&s->strings, residue_names[i])) == FREESASA_FAIL ||
+            (res_number = strings_add(&s->strings, residue_numbers[i])) == FREESASA_FAIL ||
+            (atom_name = strings_add(&s->strings, atom_names[i])) == FREESASA_FAIL) {
             goto cleanup;
         }
 
-        for (i = 0; i < n_models; ++i)
-            ss[i] = NULL;
-        *n = n_models;
+        t = atom_template(&templates, s, res_name, atom_name,
+                          radii == NULL, classes == NULL, classifier, options);
+        if (t == NULL) goto cleanup;
+        if (t->radius < 0) {
+            if (structure_append_coord(s, xyz, first, i)) goto cleanup;
+            first = i + 1;
+            continue;
+        }
+
+        if (k == 0 || chain_labels[i] != atoms->chain_label[k - 1]) {
+            if (structure_add_chain(s, chain_labels[i], k) == FREESASA_FAIL) goto cleanup;
+        }
+
+        if (k == 0 || res_number != atoms->res_number[k - 1] ||
+            chain_labels[i] != atoms->chain_label[k - 1]) {
+            /* the reference of each residue name is looked up once */
+            if (res_name >= n_res_reference) {
+                tmp = realloc(res_reference, sizeof(int) * s->strings.n_alloc);
+                if (tmp == NULL) {
+                    mem_fail();
+                    goto cleanup;
+                }
+                res_reference = tmp;
+                for (; n_res_reference < s->strings.n_alloc; ++n_res_reference) {
+                    res_reference[n_res_reference] = -2;
+                }
+            }
+            if (res_reference[res_name] == -2) {
+                reference = freesasa_classifier_residue_reference(classifier, residue_names[i]);
+                ref = -1;
+                if (reference != NULL) {
+                    ref = structure_add_reference(s, reference, last_ref);
+                    if (ref == FREESASA_FAIL) goto cleanup;
+                    last_ref = ref;
+                }
+                res_reference[res_name] = ref;
+            }
+            s->residues.first_atom[s->residues.n] = k;
+            s->residues.reference[s->residues.n] = res_reference[res_name];
+            ++s->residues.n;
+        }
+
+        atoms->res_name[k] = res_name;
+        atoms->res_number[k] = res_number;
+        atoms->atom_name[k] = atom_name;
+        atoms->symbol[k] = t->symbol;
+        atoms->line[k] = NULL;
+        atoms->line_length[k] = 0;
+        atoms->res_index[k] = s->residues.n - 1;
+        atoms->chain_label[k] = chain_labels[i];
+        atoms->the_class[k] = classes ? classes[i] : t->the_class;
+        atoms->radius[k] = radii ? radii[i] : t->radius;
+        atoms->n = ++k;
+    }
+    if (structure_append_coord(s, xyz, first, n)) goto cleanup;
+
+    free(templates.slot);
+    free(res_reference);
+
+    return s;
+
+cleanup:
+    fail_msg("");
+    free(templates.slot);
+    free(res_reference);
+    freesasa_structure_free(s);
+    return NULL;
+}
 
+freesasa_structure *
+freesasa_structure_from_pdb(FILE *pdb_file,
+                            const freesasa_classifier *classifier,
+                            int options)
+{
+    struct pdb_buffer *buffer;
+    struct file_range whole_file;
+    freesasa_structure *s;
+
+    assert(pdb_file);
+
+    buffer = freesasa_pdb_buffer_new(pdb_file);
+    if (buffer == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    whole_file.begin = 0;
+    whole_file.end = buffer->size;
+    s = from_pdb_impl(buffer, whole_file, classifier, options);
+    freesasa_pdb_buffer_free(buffer);
+
+    return s;
+}
+
+/* a model or chain to be parsed into ss[i] */
+struct parse_job {
+    struct file_range range;
+    int model;
+};
+
+/* parameters and data for a set of jobs (one per thread) */
+typedef struct {
+    struct pdb_buffer *buffer;
+    const struct parse_job *jobs;
+    int n_jobs;
+    int first_job, stride; /* jobs first_job, first_job + stride, ... */
+    const freesasa_classifier *classifier;
+    int options;
+    freesasa_structure **ss;
+    int return_value;
+} parse_data;
+
+static int
+parse_jobs(parse_data *parse)
+{
+    int i;
+
+    for (i = parse->first_job; i < parse->n_jobs; i += parse->stride) {
+        parse->ss[i] = from_pdb_impl(parse->buffer, parse->jobs[i].range,
+                                     parse->classifier, parse->options);
+        if (parse->ss[i] == NULL) {
+            parse->return_value = FREESASA_FAIL;
+            break;
+        }
+        parse->ss[i]->model = parse->jobs[i].model;
+    }
+
+    return parse->return_value;
+}
+
+#if USE_THREADS
+static void *
+parse_thread(void *arg)
+{
+    /* each thread writes to its own elements of ss. Returns instead
+       of calling pthread_exit(), which can fail to unwind after a
+       malloc failure (while reading), unlike the SASA threads. */
+    parse_jobs((parse_data *)arg);
+    return NULL;
+}
+
+static int
+parse_do_threads(int n_threads,
+                 const parse_data *parse)
+{
+    pthread_t thread[MAX_PARSE_THREADS];
+    parse_data pt[MAX_PARSE_THREADS];
+    int res, return_value = FREESASA_SUCCESS;
+    int threads_created = 0, t;
+
+    /* interleave jobs, neighboring models and chains are usually of
+       similar size */
+    for (t = 0; t < n_threads; ++t) {
+        pt[t] = *parse;
+        pt[t].first_job = t;
+        pt[t].stride = n_threads;
+        res = pthread_create(&thread[t], NULL, parse_thread, (void *)&pt[t]);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+            break;
+        }
+        ++threads_created;
+    }
+    for (t = 0; t < threads_created; ++t) {
+        res = pthread_join(thread[t], NULL);
+        if (res) {
+            return_value = fail_msg(freesasa_thread_error(res));
+        }
+        if (pt[t].return_value == FREESASA_FAIL) {
+            return_value = FREESASA_FAIL;
+        }
+    }
+    return return_value;
+}
+#endif /* USE_THREADS */
+
+int freesasa_set_parse_threads(int n)
+{
+    if (n < 1) return fail_msg("number of threads has to be positive");
+    if (n > MAX_PARSE_THREADS) {
+        parse_threads = MAX_PARSE_THREADS;
+        return FREESASA_WARN;
+    }
+    parse_threads = n;
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_get_parse_threads(void)
+{
+    return parse_threads;
+}
+
+/**
+    Creates one structure per model or chain (or both) in an indexed
+    buffer. The models and chains are parsed in parallel, each into
+    its own position in the array.
+ */
+static freesasa_structure **
+structure_array_impl(struct pdb_buffer *buffer,
+                     const struct pdb_index *index,
+                     int *n,
+                     const freesasa_classifier *classifier,
+                     int options)
+{
+    freesasa_structure **ss = NULL;
+    struct parse_job *jobs = NULL;
+    parse_data parse;
+    int n_models, n_jobs, i, j, k, ret;
+
+    n_models = freesasa_pdb_index_n_models(index);
+
+    /* only keep first model if option not provided */
+    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
+
+    if (options & FREESASA_SEPARATE_CHAINS) {
         for (i = 0; i < n_models; ++i) {
-            ss[i] = from_pdb_impl(pdb, models[i], classifier, options);
-            if (ss[i] == NULL) goto cleanup;
-            ss[i]->model = i + 1;
+            if (index->model_chains[i] == index->model_chains[i + 1])
+                freesasa_warn("in %s(): no chains found (in model %d)", __func__, i + 1);
         }
+        n_jobs = index->model_chains[n_models] - index->model_chains[0];
+    } else {
+        n_jobs = n_models;
     }
 
-    if (*n == 0) goto cleanup;
+    *n = 0;
+    if (n_jobs == 0) return NULL;
 
-    if (models != &whole_file) free(models);
+    ss = malloc(sizeof(freesasa_structure *) * n_jobs);
+    jobs = malloc(sizeof(struct parse_job) * n_jobs);
+    if (!ss || !jobs) {
+        free(ss);
+        free(jobs);
+        mem_fail();
+        return NULL;
+    }
+
+    for (i = 0, k = 0; i < n_models; ++i) {
+        if (options & FREESASA_SEPARATE_CHAINS) {
+            for (j = index->model_chains[i]; j < index->model_chains[i + 1]; ++j, ++k) {
+                jobs[k].range = index->chains[j];
+                jobs[k].model = i + 1;
+            }
+        } else {
+            jobs[k].range = index->atoms[i];
+            jobs[k].model = i + 1;
+            ++k;
+        }
+    }
+    for (k = 0; k < n_jobs; ++k)
+        ss[k] = NULL;
+
+    parse.buffer = buffer;
+    parse.jobs = jobs;
+    parse.n_jobs = n_jobs;
+    parse.first_job = 0;
+    parse.stride = 1;
+    parse.classifier = classifier;
+    parse.options = options;
+    parse.ss = ss;
+    parse.return_value = FREESASA_SUCCESS;
+
+#if USE_THREADS
+    if (parse_threads > 1 && n_jobs > 1)
+        ret = parse_do_threads(parse_threads < n_jobs ? parse_threads : n_jobs, &parse);
+    else
+#endif
+        ret = parse_jobs(&parse);
+    if (ret == FREESASA_FAIL) goto cleanup;
+
+    free(jobs);
+    *n = n_jobs;
 
     return ss;
 
 cleanup:
     if (ss)
-        for (i = 0; i < *n; ++i)
-            freesasa_structure_free(ss[i]);
-    if (models != &whole_file) free(models);
-    free(chains);
+        for (k = 0; k < n_jobs; ++k)
+            freesasa_structure_free(ss[k]);
+    free(ss);
+    free(jobs);
+    return NULL;
+}
+
+static int
+structure_array_check_options(int options)
+{
+    if (!(options & FREESASA_SEPARATE_MODELS ||
+          options & FREESASA_SEPARATE_CHAINS)) {
+        return fail_msg("options need to specify at least one of FREESASA_SEPARATE_CHAINS "
+                        "and FREESASA_SEPARATE_MODELS");
+    }
+    return FREESASA_SUCCESS;
+}
+
+freesasa_structure **
+freesasa_structure_array(FILE *pdb,
+                         int *n,
+                         const freesasa_classifier *classifier,
+                         int options)
+{
+    struct pdb_buffer *buffer;
+    struct pdb_index *index;
+    freesasa_structure **ss = NULL;
+
+    assert(pdb);
+    assert(n);
+
+    *n = 0;
+
+    if (structure_array_check_options(options) == FREESASA_FAIL) return NULL;
+
+    buffer = freesasa_pdb_buffer_new(pdb);
+    if (buffer == NULL) {
+        fail_msg("problems reading PDB-file");
+        return NULL;
+    }
+
+    index = freesasa_pdb_index_new(buffer, options);
+    if (index == NULL) {
+        fail_msg("problems reading PDB-file");
+    } else {
+        ss = structure_array_impl(buffer, index, n, classifier, options);
+    }
+
+    freesasa_pdb_index_free(index);
+    freesasa_pdb_buffer_free(buffer);
+
+    return ss;
+}
+
+freesasa_structure **
+freesasa_structure_array_indexed(FILE *pdb,
+                                 const char *index_file,
+                                 int *n,
+                                 const freesasa_classifier *classifier,
+                                 int options)
+{
+    struct pdb_buffer *buffer;
+    struct pdb_index *index = NULL;
+    freesasa_structure **ss = NULL;
+    FILE *f;
+
+    assert(pdb);
+    assert(index_file);
+    assert(n);
+
     *n = 0;
+
+    if (structure_array_check_options(options) == FREESASA_FAIL) return NULL;
+
+    buffer = freesasa_pdb_buffer_new(pdb);
+    if (buffer == NULL) {
+        fail_msg("problems reading PDB-file");
+        return NULL;
+    }
+
+    f = fopen(index_file, "r");
+    if (f) {
+        index = freesasa_pdb_index_read(f, buffer, options);
+        fclose(f);
+    }
+
+    /* missing or out of date */
+    if (index == NULL) {
+        index = freesasa_pdb_index_new(buffer, options);
+        if (index == NULL) {
+            fail_msg("problems reading PDB-file");
+            goto cleanup;
+        }
+        f = fopen(index_file, "w");
+        if (f == NULL || freesasa_pdb_index_write(f, index) == FREESASA_FAIL) {
+            freesasa_warn("in %s(): could not write index file '%s'", __func__, index_file);
+        }
+        if (f) fclose(f);
+    }
+
+    ss = structure_array_impl(buffer, index, n, classifier, options);
+
+cleanup:
+    freesasa_pdb_index_free(index);
+    freesasa_pdb_buffer_free(buffer);
+
+    return ss;
+}
+
+/* The structure cache is a sequence of segments, each a file header
+   followed by n_structures blocks. All numbers are in the byte order
+   of the platform that wrote the file, and sections start at
+   multiples of 8 bytes from the start of the file, so that they can
+   be used directly from a memory-mapped file (after they have been
+   validated). */
+#define CACHE_MAGIC "freesasa-cache"
+#define CACHE_VERSION 2
+#define CACHE_BYTE_ORDER 0x0102030405060708ULL
+#define CACHE_ALIGN(size) (((size) + 7) & ~(size_t)7)
+#define CACHE_NO_REFERENCE -1
+#define CACHE_NO_LINE -1
+#define CACHE_NO_NAME -1
+
+struct cache_file_header {
+    char magic[16];
+    uint64_t version;
+    uint64_t byte_order;
+    uint64_t n_structures;
+};
+
+/* sections of a structure block, in the order they are stored, the
+   atom and residue sections have the layout of the structure arrays */
+enum cache_section {
+    CACHE_XYZ,                /* double[3 * n_atoms] */
+    CACHE_RADIUS,             /* double[n_atoms] */
+    CACHE_ATOM_CLASS,         /* uint8_t[n_atoms] */
+    CACHE_ATOM_NAME,          /* int32_t[n_atoms], index in strings */
+    CACHE_ATOM_SYMBOL,        /* int32_t[n_atoms] */
+    CACHE_ATOM_RES_NAME,      /* int32_t[n_atoms] */
+    CACHE_ATOM_RES_NUMBER,    /* int32_t[n_atoms] */
+    CACHE_ATOM_LINE,          /* uint64_t[n_atoms], offsets in lines */
+    CACHE_ATOM_LINE_LENGTH,   /* int32_t[n_atoms], CACHE_NO_LINE if none */
+    CACHE_ATOM_CHAIN,         /* char[n_atoms] */
+    CACHE_RESIDUE_FIRST_ATOM, /* int32_t[n_residues] */
+    CACHE_RESIDUE_REFERENCE,  /* int32_t[n_residues], index in references or CACHE_NO_REFERENCE */
+    CACHE_REFERENCE_AREA,     /* double[6 * n_references] */
+    CACHE_REFERENCE_NAME,     /* int32_t[n_references], index in strings or CACHE_NO_NAME */
+    CACHE_CHAIN_FIRST_ATOM,   /* int32_t[n_chains] */
+    CACHE_CHAIN_LABELS,       /* char[n_chains + 1] */
+    CACHE_STRINGS,            /* char[strings_size], n_strings NUL-terminated strings */
+    CACHE_LINES,              /* char[lines_size] */
+    CACHE_N_SECTIONS
+};
+
+struct cache_header {
+    uint64_t size; /* of the block, including this header */
+    int64_t model;
+    int64_t n_atoms;
+    int64_t n_residues;
+    int64_t n_chains;
+    int64_t n_references;
+    int64_t n_strings;
+    int64_t classifier_name; /* index in strings, -1 if none */
+    uint64_t strings_size;
+    uint64_t lines_size;
+    uint64_t offset[CACHE_N_SECTIONS]; /* from the start of the block */
+};
+
+/* pads a section of the given size to a multiple of 8 bytes */
+static int
+cache_write_padding(FILE *output,
+                    size_t size)
+{
+    static const char padding[8] = {0};
+    size_t n = CACHE_ALIGN(size) - size;
+
+    if (n > 0 && fwrite(padding, 1, n, output) != n) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+static int
+cache_write_data(FILE *output,
+                 const void *data,
+                 size_t size)
+{
+    if (size > 0 && fwrite(data, 1, size, output) != size) return FREESASA_FAIL;
+
+    return cache_write_padding(output, size);
+}
+
+static int
+cache_write_structure(FILE *output,
+                      const freesasa_structure *s)
+{
+    struct cache_header header;
+    const void *section[CACHE_N_SECTIONS];
+    size_t size[CACHE_N_SECTIONS];
+    const freesasa_nodearea *ref;
+    int n = s->atoms.n, nr = s->residues.n, nc = s->chains.n, n_ref = s->references.n,
+        n_strings = s->strings.n, i, k;
+    int32_t *line_length = NULL, *ref_name = NULL;
+    uint64_t *line = NULL, pos;
+    double *ref_area = NULL;
+    int ret = FREESASA_FAIL;
+
+    /* the index arrays of the structure are stored as they are */
+    assert(sizeof(int) == sizeof(int32_t));
+
+    memset(&header, 0, sizeof(header));
+
+    /* allocate at least one element to avoid malloc(0) */
+    line_length = malloc(sizeof(int32_t) * (n + 1));
+    line = malloc(sizeof(uint64_t) * (n + 1));
+    ref_area = malloc(sizeof(double) * 6 * (n_ref + 1));
+    ref_name = malloc(sizeof(int32_t) * (n_ref + 1));
+    if (!line_length || !line || !ref_area || !ref_name) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    /* the classifier name is stored as the last string, unless it's already there */
+    header.classifier_name = -1;
+    if (s->classifier_name) {
+        header.classifier_name = strings_index(&s->strings, s->classifier_name);
+        if (header.classifier_name < 0) header.classifier_name = n_strings++;
+    }
+    for (i = 0; i < s->strings.n; ++i) {
+        header.strings_size += strlen(s->strings.str[i]) + 1;
+    }
+    if (header.classifier_name == s->strings.n) {
+        header.strings_size += strlen(s->classifier_name) + 1;
+    }
+
+    for (i = 0, pos = 0; i < n; ++i) {
+        line[i] = pos;
+        line_length[i] = s->atoms.line[i] ? s->atoms.line_length[i] : CACHE_NO_LINE;
+        if (s->atoms.line[i]) pos += s->atoms.line_length[i];
+    }
+    header.lines_size = pos;
+
+    for (i = 0; i < n_ref; ++i) {
+        ref = s->references.area[i];
+        ref_name[i] = ref->name ? strings_index(&s->strings, ref->name) : CACHE_NO_NAME;
+        ref_area[6 * i] = ref->total;
+        ref_area[6 * i + 1] = ref->main_chain;
+        ref_area[6 * i + 2] = ref->side_chain;
+        ref_area[6 * i + 3] = ref->polar;
+        ref_area[6 * i + 4] = ref->apolar;
+        ref_area[6 * i + 5] = ref->unknown;
+    }
+
+    section[CACHE_XYZ] = freesasa_coord_all(s->xyz);
+    size[CACHE_XYZ] = sizeof(double) * 3 * n;
+    section[CACHE_RADIUS] = s->atoms.radius;
+    size[CACHE_RADIUS] = sizeof(double) * n;
+    section[CACHE_ATOM_CLASS] = s->atoms.the_class;
+    size[CACHE_ATOM_CLASS] = n;
+    section[CACHE_ATOM_NAME] = s->atoms.atom_name;
+    section[CACHE_ATOM_SYMBOL] = s->atoms.symbol;
+    section[CACHE_ATOM_RES_NAME] = s->atoms.res_name;
+    section[CACHE_ATOM_RES_NUMBER] = s->atoms.res_number;
+    size[CACHE_ATOM_NAME] = size[CACHE_ATOM_SYMBOL] = size[CACHE_ATOM_RES_NAME] =
+        size[CACHE_ATOM_RES_NUMBER] = sizeof(int32_t) * n;
+    section[CACHE_ATOM_LINE] = line;
+    size[CACHE_ATOM_LINE] = sizeof(uint64_t) * n;
+    section[CACHE_ATOM_LINE_LENGTH] = line_length;
+    size[CACHE_ATOM_LINE_LENGTH] = sizeof(int32_t) * n;
+    section[CACHE_ATOM_CHAIN] = s->atoms.chain_label;
+    size[CACHE_ATOM_CHAIN] = n;
+    section[CACHE_RESIDUE_FIRST_ATOM] = s->residues.first_atom;
+    size[CACHE_RESIDUE_FIRST_ATOM] = sizeof(int32_t) * nr;
+    section[CACHE_RESIDUE_REFERENCE] = s->residues.reference;
+    size[CACHE_RESIDUE_REFERENCE] = sizeof(int32_t) * nr;
+    section[CACHE_REFERENCE_AREA] = ref_area;
+    size[CACHE_REFERENCE_AREA] = sizeof(double) * 6 * n_ref;
+    section[CACHE_REFERENCE_NAME] = ref_name;
+    size[CACHE_REFERENCE_NAME] = sizeof(int32_t) * n_ref;
+    section[CACHE_CHAIN_FIRST_ATOM] = s->chains.first_atom;
+    size[CACHE_CHAIN_FIRST_ATOM] = sizeof(int32_t) * nc;
+    section[CACHE_CHAIN_LABELS] = nc > 0 ? s->chains.labels : "";
+    size[CACHE_CHAIN_LABELS] = nc + 1;
+    section[CACHE_STRINGS] = NULL; /* written string by string below */
+    size[CACHE_STRINGS] = header.strings_size;
+    section[CACHE_LINES] = NULL; /* written line by line below */
+    size[CACHE_LINES] = header.lines_size;
+
+    header.model = s->model;
+    header.n_atoms = n;
+    header.n_residues = nr;
+    header.n_chains = nc;
+    header.n_references = n_ref;
+    header.n_strings = n_strings;
+    pos = CACHE_ALIGN(sizeof(header));
+    for (k = 0; k < CACHE_N_SECTIONS; ++k) {
+        header.offset[k] = pos;
+        pos += CACHE_ALIGN(size[k]);
+    }
+    header.size = pos;
+
+    if (cache_write_data(output, &header, sizeof(header))) goto write_error;
+    for (k = 0; k < CACHE_STRINGS; ++k) {
+        if (cache_write_data(output, section[k], size[k])) goto write_error;
+    }
+    for (i = 0; i < s->strings.n; ++i) {
+        if (fwrite(s->strings.str[i], 1, strlen(s->strings.str[i]) + 1, output) !=
+            strlen(s->strings.str[i]) + 1) {
+            goto write_error;
+        }
+    }
+    if (header.classifier_name == s->strings.n &&
+        fwrite(s->classifier_name, 1, strlen(s->classifier_name) + 1, output) !=
+            strlen(s->classifier_name) + 1) {
+        goto write_error;
+    }
+    if (cache_write_padding(output, size[CACHE_STRINGS])) goto write_error;
+    for (i = 0; i < n; ++i) {
+        if (s->atoms.line[i] && s->atoms.line_length[i] > 0 &&
+            fwrite(s->atoms.line[i], 1, s->atoms.line_length[i], output) != (size_t)s->atoms.line_length[i]) {
+            goto write_error;
+        }
+    }
+    if (cache_write_padding(output, size[CACHE_LINES])) goto write_error;
+
+    ret = FREESASA_SUCCESS;
+    goto cleanup;
+
+write_error:
+    fail_msg("could not write structure cache: %s", strerror(errno));
+
+cleanup:
+    free(line_length);
+    free(line);
+    free(ref_area);
+    free(ref_name);
+
+    return ret;
+}
+
+int freesasa_structure_write_cache(FILE *output,
+                                   freesasa_structure *const *structures,
+                                   int n)
+{
+    struct cache_file_header header;
+    int i;
+
+    assert(output);
+    assert(structures || n == 0);
+
+    if (n < 0) return fail_msg("negative number of structures");
+
+    memset(&header, 0, sizeof(header));
+    strcpy(header.magic, CACHE_MAGIC);
+    header.version = CACHE_VERSION;
+    header.byte_order = CACHE_BYTE_ORDER;
+    header.n_structures = n;
+
+    if (cache_write_data(output, &header, sizeof(header))) {
+        return fail_msg("could not write structure cache: %s", strerror(errno));
+    }
+    for (i = 0; i < n; ++i) {
+        if (cache_write_structure(output, structures[i])) return fail_msg("");
+    }
+
+    fflush(output);
+    if (ferror(output)) return fail_msg("could not write structure cache: %s", strerror(errno));
+
+    return FREESASA_SUCCESS;
+}
+
+/* checks that a section with n elements of given size fits in the block */
+static int
+cache_section_fits(const struct cache_header *header,
+                   int section,
+                   int64_t n,
+                   size_t element_size)
+{
+    uint64_t offset = header->offset[section];
+
+    return n >= 0 && offset % 8 == 0 && offset <= header->size &&
+           (uint64_t)n <= (header->size - offset) / element_size;
+}
+
+static int
+cache_check_header(const struct cache_header *h)
+{
+    if (h->n_atoms < 0 || h->n_atoms > INT32_MAX ||
+        h->n_residues < 0 || h->n_residues > h->n_atoms ||
+        h->n_chains < 0 || h->n_chains > h->n_atoms ||
+        h->n_references < 0 || h->n_references > h->n_residues ||
+        h->model < INT32_MIN || h->model > INT32_MAX ||
+        h->n_strings < 0 || (uint64_t)h->n_strings > h->strings_size ||
+        h->strings_size > INT64_MAX ||
+        h->classifier_name < -1 || h->classifier_name >= h->n_strings ||
+        !cache_section_fits(h, CACHE_XYZ, 3 * h->n_atoms, sizeof(double)) ||
+        !cache_section_fits(h, CACHE_RADIUS, h->n_atoms, sizeof(double)) ||
+        !cache_section_fits(h, CACHE_ATOM_CLASS, h->n_atoms, 1) ||
+        !cache_section_fits(h, CACHE_ATOM_NAME, h->n_atoms, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_SYMBOL, h->n_atoms, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_RES_NAME, h->n_atoms, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_RES_NUMBER, h->n_atoms, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_LINE, h->n_atoms, sizeof(uint64_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_LINE_LENGTH, h->n_atoms, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_ATOM_CHAIN, h->n_atoms, 1) ||
+        !cache_section_fits(h, CACHE_RESIDUE_FIRST_ATOM, h->n_residues, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_RESIDUE_REFERENCE, h->n_residues, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_REFERENCE_AREA, 6 * h->n_references, sizeof(double)) ||
+        !cache_section_fits(h, CACHE_REFERENCE_NAME, h->n_references, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_CHAIN_FIRST_ATOM, h->n_chains, sizeof(int32_t)) ||
+        !cache_section_fits(h, CACHE_CHAIN_LABELS, h->n_chains + 1, 1) ||
+        !cache_section_fits(h, CACHE_STRINGS, (int64_t)h->strings_size, 1) ||
+        h->lines_size > INT64_MAX ||
+        !cache_section_fits(h, CACHE_LINES, (int64_t)h->lines_size, 1)) {
+        return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* checks the contents of the sections, so that the accessors can trust them */
+static int
+cache_check_sections(const char *block,
+                     const struct cache_header *h)
+{
+    const unsigned char *atom_class = (const unsigned char *)(block + h->offset[CACHE_ATOM_CLASS]);
+    const int32_t *names,
+        *line_length = (const int32_t *)(block + h->offset[CACHE_ATOM_LINE_LENGTH]),
+        *first_atom = (const int32_t *)(block + h->offset[CACHE_RESIDUE_FIRST_ATOM]),
+        *reference = (const int32_t *)(block + h->offset[CACHE_RESIDUE_REFERENCE]),
+        *ref_name = (const int32_t *)(block + h->offset[CACHE_REFERENCE_NAME]),
+        *chain_first_atom = (const int32_t *)(block + h->offset[CACHE_CHAIN_FIRST_ATOM]);
+    const uint64_t *line = (const uint64_t *)(block + h->offset[CACHE_ATOM_LINE]);
+    const double *xyz = (const double *)(block + h->offset[CACHE_XYZ]),
+                 *radius = (const double *)(block + h->offset[CACHE_RADIUS]);
+    const char *strings = block + h->offset[CACHE_STRINGS],
+               *labels = block + h->offset[CACHE_CHAIN_LABELS];
+    int64_t i, k;
+    int sections[] = {CACHE_ATOM_NAME, CACHE_ATOM_SYMBOL, CACHE_ATOM_RES_NAME, CACHE_ATOM_RES_NUMBER};
+
+    if (h->strings_size > 0 && strings[h->strings_size - 1] != '\0') return FREESASA_FAIL;
+    for (i = 0, k = 0; (uint64_t)i < h->strings_size; ++i) {
+        if (strings[i] == '\0') ++k;
+    }
+    if (k != h->n_strings) return FREESASA_FAIL;
+    if (labels[h->n_chains] != '\0' || (int64_t)strlen(labels) != h->n_chains) return FREESASA_FAIL;
+    if (h->n_atoms > 0 && (h->n_residues == 0 || h->n_chains == 0)) return FREESASA_FAIL;
+
+    for (k = 0; k < 4; ++k) {
+        names = (const int32_t *)(block + h->offset[sections[k]]);
+        for (i = 0; i < h->n_atoms; ++i) {
+            if (names[i] < 0 || names[i] >= h->n_strings) return FREESASA_FAIL;
+        }
+    }
+    for (i = 0; i < h->n_atoms; ++i) {
+        if (!isfinite(xyz[3 * i]) || !isfinite(xyz[3 * i + 1]) || !isfinite(xyz[3 * i + 2]) ||
+            !isfinite(radius[i]) || radius[i] < 0) {
+            return FREESASA_FAIL;
+        }
+        if (atom_class[i] > FREESASA_ATOM_UNKNOWN) return FREESASA_FAIL;
+        if (line_length[i] != CACHE_NO_LINE &&
+            (line_length[i] < 0 || line[i] > h->lines_size ||
+             (uint64_t)line_length[i] > h->lines_size - line[i])) {
+            return FREESASA_FAIL;
+        }
+    }
+    for (i = 0; i < h->n_residues; ++i) {
+        if ((i == 0 && first_atom[i] != 0) ||
+            (i > 0 && first_atom[i] <= first_atom[i - 1]) ||
+            first_atom[i] < 0 || first_atom[i] >= h->n_atoms) {
+            return FREESASA_FAIL;
+        }
+        if (reference[i] < CACHE_NO_REFERENCE || reference[i] >= h->n_references) return FREESASA_FAIL;
+    }
+    for (i = 0; i < h->n_references; ++i) {
+        if (ref_name[i] < CACHE_NO_NAME || ref_name[i] >= h->n_strings) return FREESASA_FAIL;
+    }
+    for (i = 0; i < h->n_chains; ++i) {
+        if (chain_first_atom[i] < 0 || chain_first_atom[i] >= h->n_atoms) return FREESASA_FAIL;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* The strings, PDB lines, coordinates and the atom, residue and chain
+   arrays point into the buffer. Radii (which can be changed), line
+   pointers and residue indices are allocated. The block has to be
+   checked with cache_check_header() and cache_check_sections()
+   first. */
+static freesasa_structure *
+cache_read_structure(struct pdb_buffer *buffer,
+                     const char *block,
+                     const struct cache_header *h)
+{
+    freesasa_structure *s = NULL;
+    const int32_t *line_length = (const int32_t *)(block + h->offset[CACHE_ATOM_LINE_LENGTH]),
+                  *ref_name = (const int32_t *)(block + h->offset[CACHE_REFERENCE_NAME]);
+    const uint64_t *line = (const uint64_t *)(block + h->offset[CACHE_ATOM_LINE]);
+    const double *ref_area = (const double *)(block + h->offset[CACHE_REFERENCE_AREA]);
+    const char *strings = block + h->offset[CACHE_STRINGS],
+               *lines = block + h->offset[CACHE_LINES];
+    int n = (int)h->n_atoms, nr = (int)h->n_residues, nc = (int)h->n_chains,
+        n_ref = (int)h->n_references, n_strings = (int)h->n_strings, i, r = -1;
+    struct atoms *atoms;
+    freesasa_nodearea *area;
+
+    assert(sizeof(int) == sizeof(int32_t));
+
+    s = freesasa_structure_new();
+    if (s == NULL) goto memerr;
+    atoms = &s->atoms;
+
+    s->model = (int)h->model;
+
+    /* allocate at least one element to avoid malloc(0) */
+    s->strings.str = malloc(sizeof(const char *) * (n_strings + 1));
+    if (s->strings.str == NULL) goto memerr;
+    s->strings.n_alloc = n_strings + 1;
+    for (i = 0; i < n_strings; ++i) {
+        s->strings.str[i] = strings;
+        strings += strlen(strings) + 1;
+    }
+    s->strings.n = n_strings;
+    if (strings_rehash(&s->strings)) goto memerr;
+
+    if (h->classifier_name >= 0) {
+        s->classifier_name = strdup(s->strings.str[h->classifier_name]);
+        if (s->classifier_name == NULL) goto memerr;
+    }
+
+    /* the sections have the layout of the arrays */
+    s->is_mapped = 1;
+    freesasa_coord_free(s->xyz);
+    s->xyz = freesasa_coord_new_linked((const double *)(block + h->offset[CACHE_XYZ]), n);
+    if (s->xyz == NULL) goto memerr;
+    atoms->the_class = (unsigned char *)(block + h->offset[CACHE_ATOM_CLASS]);
+    atoms->atom_name = (int *)(block + h->offset[CACHE_ATOM_NAME]);
+    atoms->symbol = (int *)(block + h->offset[CACHE_ATOM_SYMBOL]);
+    atoms->res_name = (int *)(block + h->offset[CACHE_ATOM_RES_NAME]);
+    atoms->res_number = (int *)(block + h->offset[CACHE_ATOM_RES_NUMBER]);
+    atoms->chain_label = (char *)(block + h->offset[CACHE_ATOM_CHAIN]);
+    s->residues.first_atom = (int *)(block + h->offset[CACHE_RESIDUE_FIRST_ATOM]);
+    s->residues.reference = (int *)(block + h->offset[CACHE_RESIDUE_REFERENCE]);
+    s->residues.n = s->residues.n_alloc = nr;
+    s->chains.first_atom = (int *)(block + h->offset[CACHE_CHAIN_FIRST_ATOM]);
+    s->chains.labels = (char *)(block + h->offset[CACHE_CHAIN_LABELS]);
+    s->chains.n = s->chains.n_alloc = nc;
+
+    /* allocate at least one element to avoid malloc(0) */
+    atoms->radius = malloc(sizeof(double) * (n + 1));
+    atoms->line = malloc(sizeof(const char *) * (n + 1));
+    atoms->line_length = malloc(sizeof(int) * (n + 1));
+    atoms->res_index = malloc(sizeof(int) * (n + 1));
+    if (!atoms->radius || !atoms->line || !atoms->line_length || !atoms->res_index) goto memerr;
+    memcpy(atoms->radius, block + h->offset[CACHE_RADIUS], sizeof(double) * n);
+
+    for (i = 0; i < n; ++i) {
+        if (r + 1 < nr && s->residues.first_atom[r + 1] == i) ++r;
+        if (line_length[i] == CACHE_NO_LINE) {
+            atoms->line[i] = NULL;
+            atoms->line_length[i] = 0;
+        } else {
+            atoms->line[i] = lines + line[i];
+            atoms->line_length[i] = line_length[i];
+        }
+        atoms->res_index[i] = r;
+    }
+    atoms->n = atoms->n_alloc = n;
+
+    s->references.area = malloc(sizeof(freesasa_nodearea *) * (n_ref + 1));
+    if (s->references.area == NULL) goto memerr;
+    s->references.n_alloc = n_ref + 1;
+    for (i = 0; i < n_ref; ++i) {
+        area = malloc(sizeof(freesasa_nodearea));
+        if (area == NULL) goto memerr;
+        area->name = ref_name[i] == CACHE_NO_NAME ? NULL : s->strings.str[ref_name[i]];
+        area->total = ref_area[6 * i];
+        area->main_chain = ref_area[6 * i + 1];
+        area->side_chain = ref_area[6 * i + 2];
+        area->polar = ref_area[6 * i + 3];
+        area->apolar = ref_area[6 * i + 4];
+        area->unknown = ref_area[6 * i + 5];
+        s->references.area[s->references.n++] = area;
+    }
+
+    s->pdb_buffer = freesasa_pdb_buffer_ref(buffer);
+
+    return s;
+
+memerr:
+    mem_fail();
+    freesasa_structure_free(s);
+    return NULL;
+}
+
+freesasa_structure **
+freesasa_structure_array_from_cache(FILE *input,
+                                    int *n)
+{
+    struct pdb_buffer *buffer;
+    struct cache_file_header file_header;
+    struct cache_header header;
+    freesasa_structure **ss = NULL, *s;
+    void *tmp;
+    size_t pos = 0;
+    uint64_t k;
+    int n_alloc = 0, i;
+
+    assert(input);
+    assert(n);
+
+    *n = 0;
+
+    buffer = freesasa_pdb_buffer_new(input);
+    if (buffer == NULL) {
+        fail_msg("problems reading structure cache");
+        return NULL;
+    }
+
+    /* segments written by separate calls to freesasa_structure_write_cache() */
+    while (pos < buffer->size) {
+        if (buffer->size - pos < sizeof(file_header)) goto invalid;
+        memcpy(&file_header, buffer->data + pos, sizeof(file_header));
+        if (memcmp(file_header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0) goto invalid;
+        if (file_header.byte_order != CACHE_BYTE_ORDER) {
+            fail_msg("structure cache was written on a platform with different byte order");
+            goto cleanup;
+        }
+        if (file_header.version != CACHE_VERSION) {
+            fail_msg("structure cache has version %lu, expected %d",
+                     (unsigned long)file_header.version, CACHE_VERSION);
+            goto cleanup;
+        }
+        pos += CACHE_ALIGN(sizeof(file_header));
+
+        for (k = 0; k < file_header.n_structures; ++k) {
+            if (buffer->size - pos < sizeof(header)) goto invalid;
+            memcpy(&header, buffer->data + pos, sizeof(header));
+            if (header.size < sizeof(header) || header.size % 8 != 0 ||
+                header.size > buffer->size - pos ||
+                cache_check_header(&header) ||
+                cache_check_sections(buffer->data + pos, &header)) {
+                goto invalid;
+            }
+            s = cache_read_structure(buffer, buffer->data + pos, &header);
+            if (s == NULL) goto cleanup;
+            if (*n == n_alloc) {
+                n_alloc = n_alloc ? 2 * n_alloc : 16;
+                tmp = ss;
+                ss = realloc(ss, sizeof(freesasa_structure *) * n_alloc);
+                if (ss == NULL) {
+                    ss = tmp;
+                    freesasa_structure_free(s);
+                    mem_fail();
+                    goto cleanup;
+                }
+            }
+            ss[(*n)++] = s;
+            pos += header.size;
+        }
+    }
+
+    if (*n == 0) {
+        fail_msg("structure cache has no structures");
+        goto cleanup;
+    }
+
+    freesasa_pdb_buffer_free(buffer);
+
+    return ss;
+
+invalid:
+    fail_msg("input is not a valid structure cache");
+cleanup:
+    for (i = 0; i < *n; ++i) {
+        freesasa_structure_free(ss[i]);
+    }
     free(ss);
+    freesasa_pdb_buffer_free(buffer);
+    *n = 0;
+
     return NULL;
 }
 
@@ -901,7 +2306,8 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
                               int options)
 {
     freesasa_structure *new_s;
-    struct atom *ai;
+    const struct atoms *atoms = &structure->atoms;
+    const char *const *str = structure->strings.str;
     int i, res;
     char c;
     const double *v;
@@ -919,12 +2325,12 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
     new_s->model = structure->model;
 
     for (i = 0; i < structure->atoms.n; ++i) {
-        ai = structure->atoms.atom[i];
-        c = ai->chain_label;
+        c = atoms->chain_label[i];
         if (strchr(chains, c) != NULL) {
             v = freesasa_coord_i(structure->xyz, i);
-            res = structure_add_atom_wopt_impl(new_s, ai->atom_name,
-                                               ai->res_name, ai->res_number, ai->symbol,
+            res = structure_add_atom_wopt_impl(new_s, str[atoms->atom_name[i]],
+                                               str[atoms->res_name[i]], str[atoms->res_number[i]],
+                                               str[atoms->symbol[i]],
                                                c, v[0], v[1], v[2], classifier, options);
             if (res == FREESASA_FAIL) {
                 fail_msg("");
@@ -951,6 +2357,159 @@ cleanup:
     return NULL;
 }
 
+/**
+    Adds the residues and chains of the view s, where atom i of s is
+    atom index[i] of parent, or atom first + i if index is NULL.
+ */
+static int
+structure_view_index(freesasa_structure *s,
+                     const freesasa_structure *parent,
+                     const int *index,
+                     int first)
+{
+    int i, j, res, last_res = -1;
+
+    if (residues_resize(&s->residues, s->atoms.n)) return fail_msg("");
+
+    for (i = 0; i < s->atoms.n; ++i) {
+        j = index ? index[i] : first + i;
+        if (i == 0 || parent->atoms.chain_label[j] != s->atoms.chain_label[i - 1]) {
+            if (structure_add_chain(s, parent->atoms.chain_label[j], i)) return fail_msg("");
+        }
+        res = parent->atoms.res_index[j] - parent->res_offset;
+        if (res != last_res) {
+            s->residues.first_atom[s->residues.n] = i;
+            s->residues.reference[s->residues.n] = parent->residues.reference[res];
+            ++s->residues.n;
+            last_res = res;
+        }
+        if (!s->shares_atoms) s->atoms.res_index[i] = s->residues.n - 1;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Copies atom j of parent to atom i of s */
+static void
+structure_view_copy_atom(freesasa_structure *s,
+                         const freesasa_structure *parent,
+                         int i,
+                         int j)
+{
+    struct atoms *atoms = &s->atoms;
+    const struct atoms *from = &parent->atoms;
+
+    atoms->res_name[i] = from->res_name[j];
+    atoms->res_number[i] = from->res_number[j];
+    atoms->atom_name[i] = from->atom_name[j];
+    atoms->symbol[i] = from->symbol[j];
+    atoms->line[i] = from->line[j];
+    atoms->line_length[i] = from->line_length[j];
+    atoms->chain_label[i] = from->chain_label[j];
+    atoms->the_class[i] = from->the_class[j];
+    atoms->radius[i] = from->radius[j];
+}
+
+freesasa_structure *
+freesasa_structure_chain_view(const freesasa_structure *structure,
+                              const char *chains)
+{
+    freesasa_structure *view = NULL;
+    const struct atoms *from = &structure->atoms;
+    struct atoms *atoms;
+    const double *xyz = freesasa_coord_all(structure->xyz);
+    char selected[256] = {0};
+    int *index = NULL;
+    int i, n = 0, n_runs = 0, first = 0;
+    const char *c;
+
+    assert(structure);
+    assert(chains);
+
+    if (strlen(chains) == 0) return NULL;
+    for (c = chains; *c; ++c) {
+        if (structure->chains.n == 0 || strchr(structure->chains.labels, *c) == NULL) {
+            return NULL;
+        }
+        selected[(unsigned char)*c] = 1;
+    }
+
+    /* chains are normally contiguous, so the selected atoms are
+       usually one run of atoms that can be shared with the parent */
+    for (i = 0; i < from->n; ++i) {
+        if (selected[(unsigned char)from->chain_label[i]]) {
+            if (i == 0 || !selected[(unsigned char)from->chain_label[i - 1]]) {
+                if (n_runs++ == 0) first = i;
+            }
+            ++n;
+        }
+    }
+
+    view = freesasa_structure_new();
+    if (view == NULL) goto cleanup;
+    atoms = &view->atoms;
+
+    view->parent = structure->parent ? structure->parent : structure;
+    view->strings = structure->strings;
+    view->references = structure->references;
+    view->classifier_name = structure->classifier_name;
+    view->pdb_buffer = structure->pdb_buffer;
+    view->model = structure->model;
+
+    if (n_runs == 1) {
+        freesasa_coord_free(view->xyz);
+        view->xyz = freesasa_coord_new_linked(xyz + 3 * first, n);
+        view->shares_atoms = 1;
+        atoms->n = n;
+        atoms->res_name = from->res_name + first;
+        atoms->res_number = from->res_number + first;
+        atoms->atom_name = from->atom_name + first;
+        atoms->symbol = from->symbol + first;
+        atoms->line = from->line + first;
+        atoms->line_length = from->line_length + first;
+        atoms->res_index = from->res_index + first;
+        atoms->chain_label = from->chain_label + first;
+        atoms->the_class = from->the_class + first;
+        atoms->radius = malloc(sizeof(double) * n);
+        if (view->xyz == NULL || atoms->radius == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+        memcpy(atoms->radius, from->radius + first, sizeof(double) * n);
+        view->res_offset = from->res_index[first];
+        if (structure_view_index(view, structure, NULL, first)) goto cleanup;
+    } else {
+        index = malloc(sizeof(int) * n);
+        if (index == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+        for (i = 0, n = 0; i < from->n; ++i) {
+            if (selected[(unsigned char)from->chain_label[i]]) index[n++] = i;
+        }
+        if (atoms_resize(atoms, n)) goto cleanup;
+        for (i = 0, first = 0; i < n; ++i) {
+            structure_view_copy_atom(view, structure, i, index[i]);
+            if (i + 1 == n || index[i + 1] != index[i] + 1) {
+                if (freesasa_coord_append(view->xyz, xyz + 3 * index[first], i + 1 - first)) goto cleanup;
+                first = i + 1;
+            }
+        }
+        atoms->n = n;
+        if (structure_view_index(view, structure, index, 0)) goto cleanup;
+    }
+
+    free(index);
+
+    return view;
+
+cleanup:
+    fail_msg("");
+    free(index);
+    freesasa_structure_free(view);
+    return NULL;
+}
+
 const char *
 freesasa_structure_chain_labels(const freesasa_structure *structure)
 {
@@ -983,7 +2542,7 @@ freesasa_structure_atom_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->atom_name;
+    return structure->strings.str[structure->atoms.atom_name[i]];
 }
 
 const char *
@@ -992,7 +2551,7 @@ freesasa_structure_atom_res_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->res_name;
+    return structure->strings.str[structure->atoms.res_name[i]];
 }
 
 const char *
@@ -1001,7 +2560,7 @@ freesasa_structure_atom_res_number(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->res_number;
+    return structure->strings.str[structure->atoms.res_number[i]];
 }
 
 char freesasa_structure_atom_chain(const freesasa_structure *structure,
@@ -1009,7 +2568,7 @@ char freesasa_structure_atom_chain(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->chain_label;
+    return structure->atoms.chain_label[i];
 }
 const char *
 freesasa_structure_atom_symbol(const freesasa_structure *structure,
@@ -1017,7 +2576,23 @@ freesasa_structure_atom_symbol(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->symbol;
+    return structure->strings.str[structure->atoms.symbol[i]];
+}
+
+void freesasa_structure_columns(const freesasa_structure *structure,
+                                struct structure_columns *columns)
+{
+    assert(structure);
+    assert(columns);
+
+    columns->n_atoms = structure->atoms.n;
+    columns->n_strings = structure->strings.n;
+    columns->strings = structure->strings.str;
+    columns->atom_name = structure->atoms.atom_name;
+    columns->symbol = structure->atoms.symbol;
+    columns->res_name = structure->atoms.res_name;
+    columns->res_number = structure->atoms.res_number;
+    columns->chain_label = structure->atoms.chain_label;
 }
 
 double
@@ -1044,16 +2619,19 @@ freesasa_structure_atom_class(const freesasa_structure *structure,
 {
     assert(structure);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->the_class;
+    return (freesasa_atom_class)structure->atoms.the_class[i];
 }
 
 const char *
 freesasa_structure_atom_pdb_line(const freesasa_structure *structure,
-                                 int i)
+                                 int i,
+                                 int *length)
 {
     assert(structure);
+    assert(length);
     assert(i < structure->atoms.n && i >= 0);
-    return structure->atoms.atom[i]->line;
+    *length = structure->atoms.line_length[i];
+    return structure->atoms.line[i];
 }
 const freesasa_nodearea *
 freesasa_structure_residue_reference(const freesasa_structure *structure,
@@ -1062,7 +2640,9 @@ freesasa_structure_residue_reference(const freesasa_structure *structure,
     assert(structure);
     assert(r_i >= 0 && r_i < structure->residues.n);
 
-    return structure->residues.reference_area[r_i];
+    r_i = structure->residues.reference[r_i];
+
+    return r_i < 0 ? NULL : structure->references.area[r_i];
 }
 int freesasa_structure_residue_atoms(const freesasa_structure *structure,
                                      int r_i,
@@ -1094,7 +2674,7 @@ freesasa_structure_residue_name(const freesasa_structure *structure,
 {
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->res_name;
+    return structure->strings.str[structure->atoms.res_name[structure->residues.first_atom[r_i]]];
 }
 
 const char *
@@ -1103,7 +2683,7 @@ freesasa_structure_residue_number(const freesasa_structure *structure,
 {
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->res_number;
+    return structure->strings.str[structure->atoms.res_number[structure->residues.first_atom[r_i]]];
 }
 
 char freesasa_structure_residue_chain(const freesasa_structure *structure,
@@ -1112,7 +2692,7 @@ char freesasa_structure_residue_chain(const freesasa_structure *structure,
     assert(structure);
     assert(r_i < structure->residues.n && r_i >= 0);
 
-    return structure->atoms.atom[structure->residues.first_atom[r_i]]->chain_label;
+    return structure->atoms.chain_label[structure->residues.first_atom[r_i]];
 }
 
 int freesasa_structure_n_chains(const freesasa_structure *structure)
@@ -1169,8 +2749,8 @@ int freesasa_structure_chain_residues(const freesasa_structure *structure,
     if (freesasa_structure_chain_atoms(structure, chain, &first_atom, &last_atom))
         return fail_msg("");
 
-    *first = structure->atoms.atom[first_atom]->res_index;
-    *last = structure->atoms.atom[last_atom]->res_index;
+    *first = structure->atoms.res_index[first_atom] - structure->res_offset;
+    *last = structure->atoms.res_index[last_atom] - structure->res_offset;
 
     return FREESASA_SUCCESS;
 }
@@ -3,6 +3,7 @@
 #endif
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
@@ -17,6 +18,22 @@ const char *freesasa_name = "freesasa";
 
 static FILE *errlog = NULL;
 
+char *
+freesasa_area_str(char *buf,
+                  double area,
+                  int width,
+                  int precision)
+{
+    assert(buf);
+
+    if (isnan(area))
+        sprintf(buf, "%*s", width, "N/A");
+    else
+        sprintf(buf, "%*.*f", width, precision, area);
+
+    return buf;
+}
+
 struct file_range
 freesasa_whole_file(FILE *file)
 {
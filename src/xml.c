@@ -5,6 +5,7 @@
 #include <errno.h>
 #include <libxml/tree.h>
 #include <libxml/xmlwriter.h>
+#include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -15,38 +16,55 @@
 #define FREESASA_XMLNS "freesasa"
 #endif
 
+/* Only values that are NaN because the absolute area includes atoms
+   that weren't calculated are written as "N/A", relative areas that
+   are undefined for other reasons (such as the side chain of GLY) are
+   printed as before. */
+static const char *
+area2str(char *buf,
+         double area,
+         double abs)
+{
+    if (isnan(abs)) return freesasa_area_str(buf, abs, 0, 3);
+    sprintf(buf, "%.3f", area);
+    return buf;
+}
+
+/* abs is the absolute area that area is derived from, the same as
+   area for absolute areas */
 static xmlNodePtr
 nodearea2xml(const freesasa_nodearea *area,
+             const freesasa_nodearea *abs,
              const char *name)
 {
     xmlNodePtr xml_node = xmlNewNode(NULL, BAD_CAST name);
     char buf[20];
 
-    sprintf(buf, "%.3f", area->total);
+    area2str(buf, area->total, abs->total);
     if (xmlNewProp(xml_node, BAD_CAST "total", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
     }
 
-    sprintf(buf, "%.3f", area->polar);
+    area2str(buf, area->polar, abs->polar);
     if (xmlNewProp(xml_node, BAD_CAST "polar", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
     }
 
-    sprintf(buf, "%.3f", area->apolar);
+    area2str(buf, area->apolar, abs->apolar);
     if (xmlNewProp(xml_node, BAD_CAST "apolar", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
     }
 
-    sprintf(buf, "%.3f", area->main_chain);
+    area2str(buf, area->main_chain, abs->main_chain);
     if (xmlNewProp(xml_node, BAD_CAST "mainChain", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
     }
 
-    sprintf(buf, "%.3f", area->side_chain);
+    area2str(buf, area->side_chain, abs->side_chain);
     if (xmlNewProp(xml_node, BAD_CAST "sideChain", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
@@ -92,7 +110,7 @@ atom2xml(const freesasa_node *node,
         goto cleanup;
     }
 
-    sprintf(buf, "%.3f", area->total);
+    freesasa_area_str(buf, area->total, 0, 3);
     if (xmlNewProp(xml_node, BAD_CAST "area", BAD_CAST buf) == NULL) {
         fail_msg("");
         goto cleanup;
@@ -164,7 +182,7 @@ residue2xml(const freesasa_node *node,
         goto cleanup;
     }
 
-    xml_area = nodearea2xml(abs, "area");
+    xml_area = nodearea2xml(abs, abs, "area");
     if (xml_area == NULL) {
         fail_msg("");
         goto cleanup;
@@ -178,7 +196,7 @@ residue2xml(const freesasa_node *node,
 
     if ((reference != NULL) && !(options & FREESASA_OUTPUT_SKIP_REL)) {
         freesasa_residue_rel_nodearea(&rel, abs, reference);
-        xml_relarea = nodearea2xml(&rel, "relativeArea");
+        xml_relarea = nodearea2xml(&rel, abs, "relativeArea");
         if (xml_relarea == NULL) {
             fail_msg("");
             goto cleanup;
@@ -226,7 +244,7 @@ chain2xml(const freesasa_node *node,
         goto cleanup;
     }
 
-    xml_area = nodearea2xml(freesasa_node_area(node), "area");
+    xml_area = nodearea2xml(freesasa_node_area(node), freesasa_node_area(node), "area");
     if (xml_area == NULL) {
         fail_msg("");
         goto cleanup;
@@ -251,7 +269,7 @@ selection2xml(const freesasa_selection *selection)
     xmlNodePtr xml_selection = xmlNewNode(NULL, BAD_CAST "selection");
     char buf[20];
 
-    sprintf(buf, "%.3f", freesasa_selection_area(selection));
+    freesasa_area_str(buf, freesasa_selection_area(selection), 0, 3);
 
     if (xml_selection == NULL) {
         fail_msg("");
@@ -319,7 +337,7 @@ structure2xml(const freesasa_node *node,
         goto cleanup;
     }
 
-    xml_area = nodearea2xml(freesasa_node_area(node), "area");
+    xml_area = nodearea2xml(freesasa_node_area(node), freesasa_node_area(node), "area");
     if (xml_area == NULL) {
         fail_msg("");
         goto cleanup;
@@ -0,0 +1,200 @@
+#include <check.h>
+#include <freesasa.h>
+#include <freesasa_internal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tools.h"
+
+static freesasa_structure *
+from_file(const char *path,
+          int bcif,
+          int options)
+{
+    FILE *file = fopen(path, "rb");
+    freesasa_structure *structure;
+
+    ck_assert_ptr_ne(file, NULL);
+    if (bcif) {
+        structure = freesasa_structure_from_bcif(file, NULL, options);
+    } else {
+        structure = freesasa_structure_from_pdb(file, NULL, options);
+    }
+    fclose(file);
+
+    return structure;
+}
+
+static void
+compare_structures(const freesasa_structure *s,
+                   const freesasa_structure *t)
+{
+    const double *xyz_s = freesasa_structure_coord_array(s),
+                 *xyz_t = freesasa_structure_coord_array(t);
+    int i, n = freesasa_structure_n(s);
+
+    ck_assert_int_eq(freesasa_structure_n(t), n);
+    ck_assert_int_eq(freesasa_structure_n_residues(t), freesasa_structure_n_residues(s));
+    ck_assert_str_eq(freesasa_structure_chain_labels(t), freesasa_structure_chain_labels(s));
+    ck_assert_int_eq(freesasa_structure_model(t), freesasa_structure_model(s));
+    for (i = 0; i < n; ++i) {
+        ck_assert(xyz_s[3 * i] == xyz_t[3 * i]);
+        ck_assert(xyz_s[3 * i + 1] == xyz_t[3 * i + 1]);
+        ck_assert(xyz_s[3 * i + 2] == xyz_t[3 * i + 2]);
+        ck_assert(freesasa_structure_atom_radius(s, i) == freesasa_structure_atom_radius(t, i));
+        ck_assert_str_eq(freesasa_structure_atom_res_name(s, i), freesasa_structure_atom_res_name(t, i));
+    }
+}
+
+START_TEST(test_bcif_1ubq)
+{
+    freesasa_structure *pdb, *bcif;
+    freesasa_result *r_pdb, *r_bcif;
+    int options[] = {0, FREESASA_INCLUDE_HETATM, FREESASA_INCLUDE_HYDROGEN};
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        pdb = from_file(DATADIR "1ubq.pdb", 0, options[i]);
+        bcif = from_file(DATADIR "1ubq.bcif", 1, options[i]);
+        ck_assert_ptr_ne(pdb, NULL);
+        ck_assert_ptr_ne(bcif, NULL);
+        compare_structures(pdb, bcif);
+
+        r_pdb = freesasa_calc_structure(pdb, NULL);
+        r_bcif = freesasa_calc_structure(bcif, NULL);
+        ck_assert(r_pdb->total == r_bcif->total);
+
+        freesasa_result_free(r_pdb);
+        freesasa_result_free(r_bcif);
+        freesasa_structure_free(pdb);
+        freesasa_structure_free(bcif);
+    }
+}
+END_TEST
+
+START_TEST(test_bcif_2jo4)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *bcif = fopen(DATADIR "2jo4.bcif", "rb");
+    freesasa_structure **ss_pdb, **ss_bcif, *s_pdb, *s_bcif;
+    int options[] = {FREESASA_SEPARATE_MODELS,
+                     FREESASA_SEPARATE_CHAINS,
+                     FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS};
+    int i, j, n_pdb, n_bcif;
+
+    ck_assert_ptr_ne(pdb, NULL);
+    ck_assert_ptr_ne(bcif, NULL);
+
+    for (i = 0; i < 3; ++i) {
+        rewind(pdb);
+        rewind(bcif);
+        ss_pdb = freesasa_structure_array(pdb, &n_pdb, NULL, options[i]);
+        ss_bcif = freesasa_structure_array_bcif(bcif, &n_bcif, NULL, options[i]);
+        ck_assert_ptr_ne(ss_pdb, NULL);
+        ck_assert_ptr_ne(ss_bcif, NULL);
+        ck_assert_int_eq(n_bcif, n_pdb);
+        for (j = 0; j < n_pdb; ++j) {
+            compare_structures(ss_pdb[j], ss_bcif[j]);
+            freesasa_structure_free(ss_pdb[j]);
+            freesasa_structure_free(ss_bcif[j]);
+        }
+        free(ss_pdb);
+        free(ss_bcif);
+    }
+
+    // first model, and all models joined
+    for (i = 0; i < 2; ++i) {
+        s_pdb = from_file(DATADIR "2jo4.pdb", 0, i ? FREESASA_JOIN_MODELS : 0);
+        s_bcif = from_file(DATADIR "2jo4.bcif", 1, i ? FREESASA_JOIN_MODELS : 0);
+        ck_assert_ptr_ne(s_bcif, NULL);
+        ck_assert_int_eq(freesasa_structure_n(s_bcif), freesasa_structure_n(s_pdb));
+        freesasa_structure_free(s_pdb);
+        freesasa_structure_free(s_bcif);
+    }
+
+    fclose(pdb);
+    fclose(bcif);
+}
+END_TEST
+
+START_TEST(test_bcif_errors)
+{
+    FILE *bcif = fopen(DATADIR "1ubq.bcif", "rb"), *tf;
+    char data[4096];
+    int n;
+    size_t size;
+
+    ck_assert_ptr_ne(bcif, NULL);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    ck_assert_ptr_eq(freesasa_structure_array_bcif(bcif, &n, NULL, 0), NULL);
+    ck_assert_int_eq(n, 0);
+
+    // other formats
+    ck_assert_ptr_eq(from_file(DATADIR "1ubq.pdb", 1, 0), NULL);
+    ck_assert_ptr_eq(from_file(DATADIR "1ubq.cif", 1, 0), NULL);
+    ck_assert_ptr_eq(from_file(DATADIR "empty.pdb", 1, 0), NULL);
+
+    // a truncated copy of the file
+    tf = fopen("tmp/truncated.bcif", "w+b");
+    ck_assert_ptr_ne(tf, NULL);
+    size = fread(data, 1, sizeof(data), bcif);
+    ck_assert_int_eq(size, sizeof(data));
+    fwrite(data, 1, size, tf);
+    fflush(tf);
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_structure_from_bcif(tf, NULL, 0), NULL);
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_structure_array_bcif(tf, &n, NULL, FREESASA_SEPARATE_CHAINS), NULL);
+    fclose(tf);
+
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    fclose(bcif);
+}
+END_TEST
+
+START_TEST(test_bcif_memerr)
+{
+    FILE *file = fopen(DATADIR "2jo4.bcif", "rb");
+    void *ptr;
+    int i, n;
+
+    ck_assert_ptr_ne(file, NULL);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    for (i = 1; i < 50; ++i) {
+        rewind(file);
+        set_fail_after(i);
+        ptr = freesasa_structure_from_bcif(file, NULL, 0);
+        set_fail_after(0);
+        ck_assert_ptr_eq(ptr, NULL);
+
+        rewind(file);
+        set_fail_after(i);
+        ptr = freesasa_structure_array_bcif(file, &n, NULL, FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS);
+        set_fail_after(0);
+        ck_assert_ptr_eq(ptr, NULL);
+    }
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    fclose(file);
+}
+END_TEST
+
+extern TCase *test_bcif_static();
+
+Suite *bcif_suite()
+{
+    Suite *s = suite_create("BinaryCIF");
+
+    TCase *tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, test_bcif_1ubq);
+    tcase_add_test(tc_core, test_bcif_2jo4);
+    tcase_add_test(tc_core, test_bcif_errors);
+    tcase_add_test(tc_core, test_bcif_memerr);
+
+    TCase *tc_static = test_bcif_static();
+
+    suite_add_tcase(s, tc_core);
+    suite_add_tcase(s, tc_static);
+
+    return s;
+}
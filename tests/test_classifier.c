@@ -5,6 +5,7 @@
 #include <freesasa_internal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 struct atom {
     const char *a;
@@ -385,6 +386,231 @@ START_TEST(test_user)
 }
 END_TEST
 
+// every atom of the static classifiers and of the corresponding
+// config files is found through the hash tables, which are perfect
+// hashes found in the same way by config2c.pl and classifier.c
+START_TEST(test_lookup)
+{
+    const freesasa_classifier *static_c[] = {&freesasa_protor_classifier,
+                                             &freesasa_naccess_classifier,
+                                             &freesasa_oons_classifier};
+    const char *config[] = {SHAREDIR "protor.config",
+                            SHAREDIR "naccess.config",
+                            SHAREDIR "oons.config"};
+    const struct classifier_residue *res, *file_res;
+    const freesasa_nodearea *reference;
+    freesasa_classifier *file_c;
+    freesasa_atom_class the_class;
+    double radius;
+    char atom_name[20];
+    FILE *f;
+
+    for (int i = 0; i < 3; ++i) {
+        f = fopen(config[i], "r");
+        ck_assert_ptr_ne(f, NULL);
+        file_c = freesasa_classifier_from_file(f);
+        fclose(f);
+        ck_assert_ptr_ne(file_c, NULL);
+        ck_assert_int_eq(file_c->n_residues, static_c[i]->n_residues);
+        ck_assert_ptr_ne(static_c[i]->residue_hash.key, NULL);
+        ck_assert_ptr_ne(file_c->residue_hash.key, NULL);
+        ck_assert_int_eq(file_c->residue_hash.n_slots, static_c[i]->residue_hash.n_slots);
+        ck_assert_int_eq(file_c->residue_hash.seed, static_c[i]->residue_hash.seed);
+
+        for (int j = 0; j < static_c[i]->n_residues; ++j) {
+            res = static_c[i]->residue[j];
+            file_res = file_c->residue[0];
+            for (int k = 0; k < file_c->n_residues; ++k) {
+                if (strcmp(file_c->residue_name[k], res->name) == 0) file_res = file_c->residue[k];
+            }
+            ck_assert_str_eq(file_res->name, res->name);
+            ck_assert_ptr_ne(res->atom_hash.key, NULL);
+            ck_assert_int_ge(res->atom_hash.n_slots, 2 * res->n_atoms);
+            ck_assert_int_eq(file_res->atom_hash.n_slots, res->atom_hash.n_slots);
+            ck_assert_int_eq(file_res->atom_hash.seed, res->atom_hash.seed);
+            for (int k = 0; k < res->n_atoms; ++k) {
+                sprintf(atom_name, " %-3s", res->atom_name[k]);
+                ck_assert_int_eq(freesasa_classifier_lookup(static_c[i], res->name, atom_name,
+                                                            &radius, &the_class, &reference),
+                                 FREESASA_SUCCESS);
+                ck_assert(radius == res->atom_radius[k]);
+                ck_assert_int_eq(the_class, res->atom_class[k]);
+                ck_assert_ptr_eq(reference, &res->max_area);
+
+                ck_assert_int_eq(freesasa_classifier_lookup(file_c, res->name, atom_name,
+                                                            &radius, &the_class, &reference),
+                                 FREESASA_SUCCESS);
+                ck_assert(float_eq(radius, res->atom_radius[k], 1e-10));
+                ck_assert_int_eq(the_class, res->atom_class[k]);
+                ck_assert_ptr_ne(reference, NULL);
+            }
+        }
+        ck_assert_int_eq(freesasa_classifier_lookup(static_c[i], "XYZ", " X  ",
+                                                    &radius, &the_class, &reference),
+                         FREESASA_WARN);
+        ck_assert(radius < 0);
+        ck_assert_int_eq(the_class, FREESASA_ATOM_UNKNOWN);
+        ck_assert_ptr_eq(reference, NULL);
+        freesasa_classifier_free(file_c);
+    }
+
+    // residue ANY
+    ck_assert_int_eq(freesasa_classifier_lookup(&freesasa_naccess_classifier, "XYZ", " CA ",
+                                                &radius, &the_class, &reference),
+                     FREESASA_SUCCESS);
+    ck_assert(radius > 0);
+    ck_assert_ptr_eq(reference, NULL);
+    ck_assert_int_eq(freesasa_classifier_lookup(&freesasa_naccess_classifier, "ALA", "CB",
+                                                &radius, &the_class, NULL),
+                     FREESASA_SUCCESS);
+
+    // names that can't be in the packed tables
+    ck_assert_int_eq(freesasa_classifier_lookup(&freesasa_protor_classifier, "ALA", "",
+                                                &radius, &the_class, NULL),
+                     FREESASA_WARN);
+    ck_assert_int_eq(freesasa_classifier_lookup(&freesasa_protor_classifier, "ALA", " CA  X",
+                                                &radius, &the_class, NULL),
+                     FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_classifier_lookup(&freesasa_protor_classifier, "ALA", "CAXYZ",
+                                                &radius, &the_class, NULL),
+                     FREESASA_WARN);
+
+    // residue templates
+    res = freesasa_classifier_template(&freesasa_naccess_classifier, "ALA");
+    ck_assert_ptr_ne(res, NULL);
+    ck_assert_str_eq(res->name, "ALA");
+    ck_assert_ptr_eq(freesasa_classifier_template(&freesasa_naccess_classifier, "XYZ"), NULL);
+    ck_assert_int_eq(freesasa_classifier_template_lookup(&freesasa_naccess_classifier, res, " CB ",
+                                                         &radius, &the_class),
+                     FREESASA_SUCCESS);
+    ck_assert(float_eq(radius, freesasa_classifier_radius(&freesasa_naccess_classifier, "ALA", " CB "), 1e-10));
+    ck_assert_int_eq(freesasa_classifier_template_lookup(&freesasa_naccess_classifier, NULL, " CA ",
+                                                         &radius, &the_class),
+                     FREESASA_SUCCESS);
+    ck_assert(float_eq(radius, freesasa_classifier_radius(&freesasa_naccess_classifier, "XYZ", " CA "), 1e-10));
+    ck_assert_int_eq(freesasa_classifier_template_lookup(&freesasa_naccess_classifier, res, " X  ",
+                                                         &radius, &the_class),
+                     FREESASA_WARN);
+    ck_assert_int_eq(the_class, FREESASA_ATOM_UNKNOWN);
+}
+END_TEST
+
+static void
+assert_classifiers_equal(const freesasa_classifier *a,
+                         const freesasa_classifier *b)
+{
+    const struct classifier_residue *res;
+    const freesasa_nodearea *ref_a, *ref_b;
+    freesasa_atom_class class_a, class_b;
+    double radius_a, radius_b;
+
+    ck_assert_str_eq(freesasa_classifier_name(b), freesasa_classifier_name(a));
+    ck_assert_int_eq(b->n_residues, a->n_residues);
+    for (int i = 0; i < a->n_residues; ++i) {
+        res = a->residue[i];
+        ck_assert_str_eq(b->residue[i]->name, res->name);
+        ck_assert_int_eq(b->residue[i]->n_atoms, res->n_atoms);
+        for (int j = 0; j < res->n_atoms; ++j) {
+            ck_assert_int_eq(freesasa_classifier_lookup(a, res->name, res->atom_name[j],
+                                                        &radius_a, &class_a, &ref_a),
+                             FREESASA_SUCCESS);
+            ck_assert_int_eq(freesasa_classifier_lookup(b, res->name, res->atom_name[j],
+                                                        &radius_b, &class_b, &ref_b),
+                             FREESASA_SUCCESS);
+            ck_assert(radius_a == radius_b);
+            ck_assert_int_eq(class_a, class_b);
+            ck_assert(ref_a->total == ref_b->total && ref_a->main_chain == ref_b->main_chain &&
+                      ref_a->side_chain == ref_b->side_chain && ref_a->polar == ref_b->polar &&
+                      ref_a->apolar == ref_b->apolar && ref_a->unknown == ref_b->unknown);
+            ck_assert(ref_a->name == ref_b->name || strcmp(ref_a->name, ref_b->name) == 0);
+        }
+    }
+    ck_assert_int_eq(freesasa_classifier_lookup(b, "XYZ", " X  ", &radius_b, &class_b, NULL),
+                     FREESASA_WARN);
+}
+
+static freesasa_classifier *
+binary_copy(const freesasa_classifier *classifier)
+{
+    FILE *tf = tmpfile();
+    freesasa_classifier *copy;
+
+    ck_assert_int_eq(freesasa_classifier_write_binary(tf, classifier), FREESASA_SUCCESS);
+    copy = freesasa_classifier_from_file(tf);
+    fclose(tf);
+    ck_assert_ptr_ne(copy, NULL);
+
+    return copy;
+}
+
+START_TEST(test_binary)
+{
+    const freesasa_classifier *static_c[] = {&freesasa_protor_classifier,
+                                             &freesasa_naccess_classifier,
+                                             &freesasa_oons_classifier};
+    freesasa_classifier *file_c, *copy, *loaded;
+    freesasa_atom_class the_class;
+    double radius;
+    char *data;
+    long size;
+    FILE *f, *tf;
+
+    for (int i = 0; i < 3; ++i) {
+        copy = binary_copy(static_c[i]);
+        assert_classifiers_equal(static_c[i], copy);
+        ck_assert_ptr_ne(copy->residue_hash.key, NULL);
+        freesasa_classifier_free(copy);
+    }
+
+    // a table with a long name isn't perfect
+    f = fopen(SHAREDIR "naccess.config", "r");
+    file_c = freesasa_classifier_from_file(f);
+    fclose(f);
+    ck_assert_ptr_ne(file_c, NULL);
+    ck_assert_int_ge(freesasa_classifier_add_atom(file_c->residue[1], "LONGNAME", 1.5, FREESASA_ATOM_POLAR), 0);
+    ck_assert_ptr_eq(file_c->residue[1]->atom_hash.key, NULL);
+    copy = binary_copy(file_c);
+    assert_classifiers_equal(file_c, copy);
+    ck_assert_ptr_eq(copy->residue[1]->atom_hash.key, NULL);
+    ck_assert_int_eq(freesasa_classifier_lookup(copy, file_c->residue[1]->name, "LONGNAME",
+                                                &radius, &the_class, NULL),
+                     FREESASA_SUCCESS);
+    ck_assert(float_eq(radius, 1.5, 1e-10));
+    freesasa_classifier_free(file_c);
+
+    // truncated, and with corrupted bytes
+    tf = tmpfile();
+    ck_assert_int_eq(freesasa_classifier_write_binary(tf, copy), FREESASA_SUCCESS);
+    freesasa_classifier_free(copy);
+    size = ftell(tf);
+    data = malloc(size);
+    rewind(tf);
+    ck_assert_int_eq(fread(data, 1, size, tf), size);
+    fclose(tf);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    for (long k = 0; k < 200; ++k) {
+        tf = tmpfile();
+        if (k < 100) {
+            fwrite(data, 1, size * k / 100, tf);
+        } else {
+            data[(k - 100) * 8]++;
+            fwrite(data, 1, size, tf);
+            data[(k - 100) * 8]--;
+        }
+        loaded = freesasa_classifier_from_file(tf);
+        if (k < 100) ck_assert_ptr_eq(loaded, NULL);
+        if (loaded) {
+            freesasa_classifier_lookup(loaded, "ALA", " CA ", &radius, &the_class, NULL);
+            freesasa_classifier_free(loaded);
+        }
+        fclose(tf);
+    }
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    free(data);
+}
+END_TEST
+
 START_TEST(test_backbone)
 {
     ck_assert(freesasa_atom_is_backbone("C"));
@@ -475,6 +701,8 @@ Suite *classifier_suite()
     tcase_add_test(tc_core, test_class);
     tcase_add_test(tc_core, test_residue);
     tcase_add_test(tc_core, test_user);
+    tcase_add_test(tc_core, test_lookup);
+    tcase_add_test(tc_core, test_binary);
     tcase_add_test(tc_core, test_backbone);
     tcase_add_test(tc_core, test_memerr);
 
@@ -2,6 +2,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #if HAVE_CONFIG_H
 #include <config.h>
 #endif
@@ -513,6 +514,351 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+START_TEST(test_receptor_poses)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    const double *xyz = freesasa_coord_all(freesasa_structure_xyz(st));
+    const double *r = freesasa_structure_radius(st);
+    const int n = freesasa_structure_n(st), n_rec = 400, n_lig = n - n_rec;
+    const double c = cos(0.3), s = sin(0.3);
+    /* identity, rotation round z-axis, far away */
+    const double poses[36] = {1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+                              c, -s, 0, s, c, 0, 0, 0, 1, 2, -1, 0,
+                              1, 0, 0, 0, 1, 0, 0, 0, 1, 200, 0, 0};
+    double complex_sasa[3], buried[3], *cplx = malloc(sizeof(double) * 3 * n);
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_receptor *receptor;
+    freesasa_result *res, *res_lig;
+    freesasa_algorithm alg[2] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+
+    fclose(pdb);
+    p.n_threads = 2;
+
+    for (int a = 0; a < 2; ++a) {
+        p.alg = alg[a];
+        receptor = freesasa_receptor_new(xyz, r, n_rec, &p);
+        ck_assert_ptr_ne(receptor, NULL);
+        ck_assert_int_eq(freesasa_receptor_score_poses(receptor, xyz + 3 * n_rec, r + n_rec, n_lig,
+                                                       poses, 3, complex_sasa, buried),
+                         FREESASA_SUCCESS);
+
+        /* compare with calculating the full complex for each pose */
+        memcpy(cplx, xyz, sizeof(double) * 3 * n_rec);
+        for (int k = 0; k < 3; ++k) {
+            const double *t = poses + 12 * k;
+            for (int i = n_rec; i < n; ++i) {
+                const double *v = xyz + 3 * i;
+                for (int j = 0; j < 3; ++j) {
+                    cplx[3 * i + j] = t[3 * j] * v[0] + t[3 * j + 1] * v[1] + t[3 * j + 2] * v[2] + t[9 + j];
+                }
+            }
+            res = freesasa_calc_coord(cplx, r, n, &p);
+            res_lig = freesasa_calc_coord(cplx + 3 * n_rec, r + n_rec, n_lig, &p);
+            ck_assert(fabs(complex_sasa[k] - res->total) < 1e-6);
+            ck_assert(fabs(buried[k] - (freesasa_receptor_area(receptor) + res_lig->total - res->total)) < 1e-6);
+            freesasa_result_free(res);
+            freesasa_result_free(res_lig);
+        }
+        ck_assert(buried[0] > 100);
+        ck_assert(fabs(buried[2]) < 1e-10);
+        freesasa_receptor_free(receptor);
+    }
+
+    free(cplx);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+START_TEST(test_alanine_scan)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    const double *xyz = freesasa_coord_all(freesasa_structure_xyz(st));
+    const double *r = freesasa_structure_radius(st);
+    const int n = freesasa_structure_n(st), n_res = freesasa_structure_n_residues(st);
+    double *delta = malloc(sizeof(double) * n_res);
+    double *xyz_mut = malloc(sizeof(double) * 3 * n), *r_mut = malloc(sizeof(double) * n);
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_result *ref, *res;
+    int first, last, n_mut;
+
+    fclose(pdb);
+    p.n_threads = 2;
+    ck_assert_int_eq(freesasa_alanine_scan(st, &p, delta), FREESASA_SUCCESS);
+
+    /* compare with removing the atoms and recalculating everything */
+    ref = freesasa_calc_structure(st, &p);
+    for (int i = 0; i < n_res; ++i) {
+        freesasa_structure_residue_atoms(st, i, &first, &last);
+        if (strcmp(freesasa_structure_residue_name(st, i), "GLY") == 0) {
+            ck_assert(delta[i] == 0);
+            continue;
+        }
+        n_mut = 0;
+        for (int j = 0; j < n; ++j) {
+            const char *name = freesasa_structure_atom_name(st, j);
+            if (j >= first && j <= last &&
+                !freesasa_atom_is_backbone(name) && strcmp(name, " CB ") != 0) continue;
+            memcpy(xyz_mut + 3 * n_mut, xyz + 3 * j, sizeof(double) * 3);
+            r_mut[n_mut++] = r[j];
+        }
+        res = freesasa_calc_coord(xyz_mut, r_mut, n_mut, &p);
+        ck_assert(fabs(ref->total + delta[i] - res->total) < 1e-6);
+        freesasa_result_free(res);
+    }
+    /* the side chain of LYS 6 is exposed, that of ILE 3 buried */
+    ck_assert(delta[5] < -30);
+    ck_assert(delta[2] > 10);
+
+    freesasa_result_free(ref);
+    free(delta);
+    free(xyz_mut);
+    free(r_mut);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+/* Reads a file written to tmp into a string */
+static char *
+read_tmp(FILE *tmp)
+{
+    long size;
+    char *str;
+
+    fflush(tmp);
+    size = ftell(tmp);
+    rewind(tmp);
+    str = malloc(size + 1);
+    ck_assert_int_eq(fread(str, 1, size, tmp), size);
+    str[size] = '\0';
+
+    return str;
+}
+
+START_TEST(test_calc_targets)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *tmp;
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_algorithm alg[2] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    freesasa_result *ref, *res;
+    freesasa_node *tree, *structure, *residue;
+    freesasa_selection *sel;
+    const char *num, *line;
+    char *out;
+    int first, last, n_res;
+    double sum;
+
+    fclose(pdb);
+    freesasa_structure_residue_atoms(st, 9, &first, &last);
+
+    for (int a = 0; a < 2; ++a) {
+        p.alg = alg[a];
+        p.n_threads = 2;
+        ref = freesasa_calc_structure(st, &p);
+        /* residues 10-12 are targets, residue 13 only partially */
+        res = freesasa_calc_targets(st, "pocket, resi 10-12 or (resi 13 and name CA)", &p);
+        ck_assert_ptr_ne(res, NULL);
+
+        sum = 0;
+        for (int i = 0; i < freesasa_structure_n(st); ++i) {
+            num = freesasa_structure_atom_res_number(st, i);
+            if ((atoi(num) >= 10 && atoi(num) <= 12) ||
+                (atoi(num) == 13 && strcmp(freesasa_structure_atom_name(st, i), " CA ") == 0)) {
+                ck_assert(fabs(res->sasa[i] - ref->sasa[i]) < 1e-10);
+                if (atoi(num) <= 12) sum += ref->sasa[i];
+            } else {
+                ck_assert(isnan(res->sasa[i]));
+            }
+        }
+        /* totals that include atoms that weren't calculated are NaN */
+        ck_assert(isnan(res->total));
+
+        tree = freesasa_tree_init(res, st, "test");
+        structure = freesasa_node_children(freesasa_node_children(tree));
+        ck_assert(isnan(freesasa_node_area(structure)->total));
+        ck_assert(isnan(freesasa_node_area(freesasa_node_children(structure))->total));
+        n_res = 0;
+        for (residue = freesasa_node_children(freesasa_node_children(structure));
+             residue != NULL; residue = freesasa_node_next(residue)) {
+            const freesasa_nodearea *area = freesasa_node_area(residue);
+            num = freesasa_node_residue_number(residue);
+            if (atoi(num) >= 10 && atoi(num) <= 12) {
+                ++n_res;
+                ck_assert(!isnan(area->total));
+                ck_assert(!isnan(area->side_chain));
+                ck_assert(!isnan(area->polar));
+            } else {
+                ck_assert(isnan(area->total));
+                ck_assert(isnan(area->main_chain));
+                ck_assert(isnan(area->side_chain));
+                ck_assert(isnan(area->polar));
+                ck_assert(isnan(area->apolar));
+            }
+        }
+        ck_assert_int_eq(n_res, 3);
+
+        /* selections, only areas of fully calculated atoms are numbers */
+        sel = freesasa_selection_new("s, resi 10-12", st, res);
+        ck_assert(fabs(freesasa_selection_area(sel) - sum) < 1e-10);
+        freesasa_selection_free(sel);
+        sel = freesasa_selection_new("s, resi 13", st, res);
+        ck_assert(isnan(freesasa_selection_area(sel)));
+        freesasa_selection_free(sel);
+
+        /* RSA: N/A for the partial residue and the totals */
+        tmp = tmpfile();
+        ck_assert_int_eq(freesasa_tree_export(tmp, tree, FREESASA_RSA), FREESASA_SUCCESS);
+        out = read_tmp(tmp);
+        fclose(tmp);
+        ck_assert_ptr_eq(strstr(out, "nan"), NULL);
+        line = strstr(out, "RES ILE A  13  ");
+        ck_assert_ptr_ne(line, NULL);
+        ck_assert(strncmp(line, "RES ILE A  13      N/A   N/A", 28) == 0);
+        line = strstr(out, "RES THR A  12  ");
+        ck_assert_ptr_ne(line, NULL);
+        ck_assert(strncmp(line + 15, "    N/A", 7) != 0);
+        line = strstr(out, "TOTAL ");
+        ck_assert_ptr_ne(line, NULL);
+        ck_assert(strncmp(line, "TOTAL             N/A", 21) == 0);
+        free(out);
+
+        /* log output */
+        tmp = tmpfile();
+        ck_assert_int_eq(freesasa_tree_export(tmp, tree, FREESASA_LOG | FREESASA_SEQ), FREESASA_SUCCESS);
+        out = read_tmp(tmp);
+        fclose(tmp);
+        ck_assert_ptr_eq(strstr(out, "nan"), NULL);
+        ck_assert_ptr_ne(strstr(out, "Total   :        N/A"), NULL);
+        ck_assert_ptr_ne(strstr(out, "SEQ A   13  ILE :     N/A"), NULL);
+        free(out);
+
+        freesasa_node_free(tree);
+        freesasa_result_free(ref);
+        freesasa_result_free(res);
+    }
+
+    /* everything is a target */
+    res = freesasa_calc_targets(st, "all, resi 1-1000", &p);
+    ref = freesasa_calc_structure(st, &p);
+    ck_assert(fabs(res->total - ref->total) < 1e-10);
+    freesasa_result_free(ref);
+    freesasa_result_free(res);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_calc_targets(st, "pocket, foo 10", &p), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    freesasa_structure_free(st);
+}
+END_TEST
+
+START_TEST(test_probe_sweep)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    const double *xyz = freesasa_coord_all(freesasa_structure_xyz(st));
+    const double *r = freesasa_structure_radius(st);
+    const int n = freesasa_structure_n(st);
+    const double probes[4] = {1.4, 0, 2.0, 0.7}, bad_probe = -1;
+    double *sasa = malloc(sizeof(double) * 4 * n);
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_algorithm alg[2] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    freesasa_result *res;
+
+    fclose(pdb);
+    p.n_threads = 2;
+
+    for (int a = 0; a < 2; ++a) {
+        p.alg = alg[a];
+        ck_assert_int_eq(freesasa_calc_coord_sweep(xyz, r, n, probes, 4, &p, sasa),
+                         FREESASA_SUCCESS);
+        for (int k = 0; k < 4; ++k) {
+            p.probe_radius = probes[k];
+            res = freesasa_calc_coord(xyz, r, n, &p);
+            for (int i = 0; i < n; ++i) {
+                ck_assert(fabs(sasa[k * n + i] - res->sasa[i]) < 1e-10);
+            }
+            freesasa_result_free(res);
+        }
+    }
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_calc_coord_sweep(xyz, r, n, &bad_probe, 1, &p, sasa), FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_calc_coord_sweep(xyz, r, n, probes, 0, &p, sasa), FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    free(sasa);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+START_TEST(test_periodic)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    const double *xyz = freesasa_coord_all(freesasa_structure_xyz(st));
+    const double *r = freesasa_structure_radius(st);
+    const int n = freesasa_structure_n(st), n_cells = 27;
+    double *lattice = malloc(sizeof(double) * 3 * n * n_cells);
+    double *r_lattice = malloc(sizeof(double) * n * n_cells);
+    freesasa_parameters p = freesasa_default_parameters;
+    freesasa_algorithm alg[2] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    freesasa_result *ref, *res;
+    int m;
+
+    fclose(pdb);
+    p.n_threads = 2;
+
+    /* a triclinic box small enough that ubiquitin touches its images */
+    ck_assert_int_eq(freesasa_parameters_set_box(&p, 28, 30, 32, 80, 95, 105), FREESASA_SUCCESS);
+
+    /* the central cell and its neighbors, explicitly, central cell first */
+    m = 0;
+    for (int c = 0; c < n_cells; ++c) {
+        int ia = (c + 13) % 27 % 3 - 1, ib = (c + 13) % 27 / 3 % 3 - 1, ic = (c + 13) % 27 / 9 - 1;
+        for (int i = 0; i < n; ++i, ++m) {
+            for (int k = 0; k < 3; ++k) {
+                lattice[3 * m + k] = xyz[3 * i + k] + ia * p.box[k] + ib * p.box[3 + k] + ic * p.box[6 + k];
+            }
+            r_lattice[m] = r[i];
+        }
+    }
+
+    for (int a = 0; a < 2; ++a) {
+        p.alg = alg[a];
+        res = freesasa_calc_structure(st, &p);
+        ck_assert_ptr_ne(res, NULL);
+
+        /* the lattice contacts bury some of the surface */
+        memset(p.box, 0, sizeof(p.box));
+        ref = freesasa_calc_structure(st, &p);
+        ck_assert(res->total < ref->total - 500);
+        freesasa_result_free(ref);
+
+        ref = freesasa_calc_coord(lattice, r_lattice, n * n_cells, &p);
+        for (int i = 0; i < n; ++i) {
+            ck_assert(fabs(res->sasa[i] - ref->sasa[i]) < 1e-6);
+        }
+        freesasa_result_free(ref);
+        freesasa_result_free(res);
+        freesasa_parameters_set_box(&p, 28, 30, 32, 80, 95, 105);
+    }
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_parameters_set_box(&p, 35, 38, -40, 90, 90, 90), FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_parameters_set_box(&p, 35, 38, 40, 10, 10, 170), FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_parameters_set_box(&p, 15, 38, 40, 90, 90, 90), FREESASA_SUCCESS);
+    ck_assert_ptr_eq(freesasa_calc_structure(st, &p), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    free(lattice);
+    free(r_lattice);
+    freesasa_structure_free(st);
+}
+END_TEST
+
 extern TCase *test_LR_static();
 
 Suite *sasa_suite()
@@ -525,6 +871,11 @@ Suite *sasa_suite()
     tcase_add_test(tc_basic, test_user_classes);
     tcase_add_test(tc_basic, test_write_pdb);
     tcase_add_test(tc_basic, test_memerr);
+    tcase_add_test(tc_basic, test_receptor_poses);
+    tcase_add_test(tc_basic, test_alanine_scan);
+    tcase_add_test(tc_basic, test_calc_targets);
+    tcase_add_test(tc_basic, test_probe_sweep);
+    tcase_add_test(tc_basic, test_periodic);
 
     TCase *tc_lr_basic = tcase_create("Basic L&R");
     tcase_add_checked_fixture(tc_lr_basic, setup_lr_precision, teardown_lr_precision);
@@ -10,6 +10,7 @@ extern Suite *pdb_suite();
 extern Suite *classifier_suite();
 extern Suite *coord_suite();
 extern Suite *structure_suite();
+extern Suite *bcif_suite();
 extern Suite *sasa_suite();
 extern Suite *nb_suite();
 extern Suite *selector_suite();
@@ -31,6 +32,7 @@ int main(int argc, char **argv)
     srunner_add_suite(sr, classifier_suite());
     srunner_add_suite(sr, coord_suite());
     srunner_add_suite(sr, structure_suite());
+    srunner_add_suite(sr, bcif_suite());
     srunner_add_suite(sr, sasa_suite());
     srunner_add_suite(sr, nb_suite());
     srunner_add_suite(sr, selector_suite());
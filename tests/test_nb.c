@@ -1,4 +1,6 @@
 #include <check.h>
+#include <math.h>
+
 #include <freesasa_internal.h>
 #include <nb.h>
 
@@ -43,6 +45,104 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+START_TEST(test_nb_periodic)
+{
+    /* the first two atoms only touch across the box faces */
+    const double vp[9] = {1, 15, 15, 29, 15, 15, 15, 15, 15};
+    const double rp[3] = {2, 2, 2};
+    const double cube[9] = {30, 0, 0, 0, 30, 0, 0, 0, 30};
+    const double tilted[9] = {30, 0, 0, 10, 30, 0, 0, 0, 30};
+    const double small[9] = {10, 0, 0, 0, 30, 0, 0, 0, 30};
+    coord_t *coord = freesasa_coord_new();
+    nb_list *nb;
+
+    freesasa_coord_append(coord, vp, 3);
+
+    nb = freesasa_nb_new_subset(coord, rp, NULL, NULL);
+    ck_assert(freesasa_nb_contact(nb, 0, 1) == 0);
+    freesasa_nb_free(nb);
+
+    nb = freesasa_nb_new_subset(coord, rp, NULL, cube);
+    ck_assert(freesasa_nb_contact(nb, 0, 1));
+    ck_assert(freesasa_nb_contact(nb, 1, 0));
+    ck_assert(freesasa_nb_contact(nb, 0, 2) == 0);
+    ck_assert_int_eq(nb->nn[0], 1);
+    ck_assert(fabs(nb->xd[0][0] + 2) < 1e-10);
+    ck_assert(fabs(nb->yd[0][0]) < 1e-10);
+    ck_assert(fabs(nb->zd[0][0]) < 1e-10);
+    ck_assert(fabs(nb->xyd[0][0] - 2) < 1e-10);
+    ck_assert(fabs(nb->xd[1][0] - 2) < 1e-10);
+    freesasa_nb_free(nb);
+
+    /* the same contact in a triclinic box */
+    nb = freesasa_nb_new_subset(coord, rp, NULL, tilted);
+    ck_assert(freesasa_nb_contact(nb, 0, 1));
+    ck_assert(fabs(nb->xd[0][0] + 2) < 1e-10);
+    freesasa_nb_free(nb);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_nb_new_subset(coord, rp, NULL, small), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    freesasa_coord_free(coord);
+}
+END_TEST
+
+/* the lists of targets are the same as in the full list, in some
+   order, and the other atoms have no lists */
+static void
+check_subset(const coord_t *coord,
+             const double *radii,
+             const int *target,
+             const double *box)
+{
+    nb_list *full = freesasa_nb_new_subset(coord, radii, NULL, box);
+    nb_list *sub = freesasa_nb_new_subset(coord, radii, target, box);
+    int n = freesasa_coord_n(coord), i, k;
+
+    ck_assert_ptr_ne(full, NULL);
+    ck_assert_ptr_ne(sub, NULL);
+    for (i = 0; i < n; ++i) {
+        if (target[i]) {
+            ck_assert_int_eq(sub->nn[i], full->nn[i]);
+            for (k = 0; k < sub->nn[i]; ++k) {
+                ck_assert(freesasa_nb_contact(full, i, sub->nb[i][k]));
+            }
+        } else {
+            ck_assert_int_eq(sub->nn[i], 0);
+        }
+    }
+    freesasa_nb_free(full);
+    freesasa_nb_free(sub);
+}
+
+START_TEST(test_nb_subset)
+{
+    const double box[9] = {40, 0, 0, 0, 40, 0, 0, 0, 40};
+    double xyz[3 * 1000], radii[1000];
+    int target[1000], none[1000], i;
+    coord_t *coord = freesasa_coord_new();
+
+    /* a lattice with a few atoms in each cell */
+    for (i = 0; i < 1000; ++i) {
+        xyz[3 * i] = (i % 10) * 3.7 + 0.1 * (i % 7);
+        xyz[3 * i + 1] = (i / 10 % 10) * 3.7 + 0.1 * (i % 3);
+        xyz[3 * i + 2] = (i / 100) * 3.7 + 0.1 * (i % 5);
+        radii[i] = 2 + 0.1 * (i % 4);
+        /* targets in one corner, and a few scattered ones */
+        target[i] = ((i % 10) < 3 && (i / 10 % 10) < 3 && (i / 100) < 3) || i % 97 == 0;
+        none[i] = 0;
+    }
+    freesasa_coord_append(coord, xyz, 1000);
+
+    check_subset(coord, radii, target, NULL);
+    check_subset(coord, radii, target, box);
+    check_subset(coord, radii, none, NULL);
+
+    freesasa_coord_free(coord);
+}
+END_TEST
+
 extern TCase *test_nb_static();
 
 Suite *nb_suite()
@@ -52,6 +152,8 @@ Suite *nb_suite()
     TCase *tc_nb = tcase_create("Basic");
     tcase_add_test(tc_nb, test_nb);
     tcase_add_test(tc_nb, test_memerr);
+    tcase_add_test(tc_nb, test_nb_periodic);
+    tcase_add_test(tc_nb, test_nb_subset);
 
     TCase *tc_static = test_nb_static();
 
@@ -99,21 +99,95 @@ START_TEST(test_result_node)
 }
 END_TEST
 
+START_TEST(test_arena)
+{
+    FILE *file = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
+    freesasa_result *result = freesasa_calc_structure(structure, NULL);
+    freesasa_selection *selection = freesasa_selection_new("s, resn ala", structure, result);
+    freesasa_arena *arena = freesasa_arena_new();
+    freesasa_node *tree, *tree2, *rn;
+    size_t size;
+    int i;
+
+    ck_assert_ptr_ne(arena, NULL);
+    ck_assert_ptr_ne(selection, NULL);
+    ck_assert_int_eq(freesasa_arena_size(arena), 0);
+
+    for (i = 0; i < 2; ++i) {
+        tree = freesasa_tree_new_arena(arena);
+        tree2 = freesasa_tree_new();
+        ck_assert_ptr_ne(tree, NULL);
+        ck_assert_ptr_ne(tree2, NULL);
+        ck_assert_int_eq(freesasa_tree_add_result(tree, result, structure, "test"), FREESASA_SUCCESS);
+        ck_assert_int_eq(freesasa_tree_add_result(tree2, result, structure, "test2"), FREESASA_SUCCESS);
+        rn = freesasa_node_children(freesasa_node_children(tree));
+        ck_assert_int_eq(freesasa_node_structure_add_selection(rn, selection), FREESASA_SUCCESS);
+        test_tree(rn, result);
+
+        // memory is reused after a reset
+        if (i == 0) {
+            ck_assert(freesasa_arena_size(arena) > 0);
+        } else {
+            ck_assert_int_eq(freesasa_arena_size(arena), size);
+        }
+
+        // the nodes of tree2 are moved to the arena
+        size = freesasa_arena_size(arena);
+        freesasa_tree_join(tree, &tree2);
+        ck_assert(freesasa_arena_size(arena) > size);
+        rn = freesasa_node_next(freesasa_node_children(tree));
+        ck_assert_str_eq(freesasa_node_name(rn), "test2");
+        test_tree(freesasa_node_children(rn), result);
+
+        freesasa_set_verbosity(FREESASA_V_SILENT);
+        ck_assert_int_eq(freesasa_node_free(freesasa_node_children(tree)), FREESASA_FAIL);
+        freesasa_set_verbosity(FREESASA_V_NORMAL);
+        ck_assert_int_eq(freesasa_node_free(tree), FREESASA_SUCCESS);
+
+        size = freesasa_arena_size(arena);
+        freesasa_arena_reset(arena);
+    }
+
+    freesasa_arena_free(arena);
+    freesasa_selection_free(selection);
+    freesasa_structure_free(structure);
+    freesasa_result_free(result);
+    fclose(file);
+}
+END_TEST
+
 START_TEST(test_memerr)
 {
     FILE *file = fopen(DATADIR "1ubq.pdb", "r");
     freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
     freesasa_result *result = freesasa_calc_structure(structure, NULL);
     freesasa_node *rn;
+    int i, ret = FREESASA_FAIL;
     freesasa_set_verbosity(FREESASA_V_SILENT);
     rn = freesasa_tree_new();
-    for (int i = 1; i < 200; ++i) {
-        int ret;
+    // the tree is allocated in a few blocks, each of which can fail
+    for (i = 1; i < 200 && ret == FREESASA_FAIL; ++i) {
         set_fail_after(i);
         ret = freesasa_tree_add_result(rn, result, structure, "test");
         set_fail_after(0);
-        ck_assert_int_eq(ret, FREESASA_FAIL);
     }
+    ck_assert_int_eq(ret, FREESASA_SUCCESS);
+    ck_assert_int_gt(i, 2);
+    // the failed attempts are not part of the tree
+    ck_assert_ptr_eq(freesasa_node_next(freesasa_node_children(rn)), NULL);
+    test_tree(freesasa_node_children(freesasa_node_children(rn)), result);
+    freesasa_node_free(rn);
+
+    for (i = 1; i < 3; ++i) {
+        set_fail_after(i);
+        rn = freesasa_tree_init(result, structure, "test");
+        set_fail_after(0);
+        ck_assert_ptr_eq(rn, NULL);
+    }
+    set_fail_after(1);
+    ck_assert_ptr_eq(freesasa_arena_new(), NULL);
+    set_fail_after(0);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
     freesasa_structure_free(structure);
     freesasa_result_free(result);
@@ -127,6 +201,7 @@ Suite *result_node_suite()
 
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_result_node);
+    tcase_add_test(tc_core, test_arena);
     tcase_add_test(tc_core, test_memerr);
 
     suite_add_tcase(s, tc_core);
@@ -1,3 +1,6 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include <check.h>
 #include <math.h>
 #include <pdb.h>
@@ -193,6 +196,296 @@ START_TEST(test_get_chains)
 }
 END_TEST
 
+START_TEST(test_pdb_buffer)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *pipe;
+    struct pdb_buffer *mapped, *read;
+    struct file_range *models = NULL, *chains = NULL;
+    freesasa_structure *s1, *s2;
+    const char *line1, *line2;
+    int n, length1, length2;
+
+    mapped = freesasa_pdb_buffer_new(pdb);
+    ck_assert_ptr_ne(mapped, NULL);
+    fseek(pdb, 0, SEEK_END);
+    ck_assert_int_eq(mapped->size, ftell(pdb));
+
+    // pipes can't be mapped and are read into memory
+    pipe = popen("cat " DATADIR "2jo4.pdb", "r");
+    read = freesasa_pdb_buffer_new(pipe);
+    pclose(pipe);
+    ck_assert_ptr_ne(read, NULL);
+    ck_assert_int_eq(read->is_mapped, 0);
+    ck_assert_int_eq(read->size, mapped->size);
+    ck_assert(memcmp(read->data, mapped->data, read->size) == 0);
+
+    n = freesasa_pdb_buffer_models(mapped, &models);
+    ck_assert_int_eq(n, 10);
+    ck_assert(strncmp(mapped->data + models[3].begin, "MODEL", 5) == 0);
+    ck_assert(strncmp(mapped->data + models[3].end - 81, "ENDMDL", 6) == 0);
+    ck_assert_int_eq(freesasa_pdb_buffer_chains(mapped, models[3], &chains, 0), 4);
+    free(models);
+    free(chains);
+
+    // structures reference their lines in the buffer
+    freesasa_pdb_buffer_free(read);
+    rewind(pdb);
+    s1 = freesasa_structure_from_pdb(pdb, NULL, 0);
+    pipe = popen("cat " DATADIR "2jo4.pdb", "r");
+    s2 = freesasa_structure_from_pdb(pipe, NULL, 0);
+    pclose(pipe);
+    ck_assert_int_eq(freesasa_structure_n(s1), freesasa_structure_n(s2));
+    line1 = freesasa_structure_atom_pdb_line(s1, 0, &length1);
+    line2 = freesasa_structure_atom_pdb_line(s2, 0, &length2);
+    ck_assert_int_eq(length1, length2);
+    ck_assert(strncmp(line1, "ATOM      7  N   ALA A   2", 26) == 0);
+    ck_assert(memcmp(line1, line2, length1) == 0);
+    ck_assert_int_eq(line1[length1 - 1], '\n');
+
+    freesasa_structure_free(s1);
+    freesasa_structure_free(s2);
+    freesasa_pdb_buffer_free(mapped);
+    fclose(pdb);
+}
+END_TEST
+
+START_TEST(test_pdb_index)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *ubq = fopen(DATADIR "1ubq.pdb", "r"), *tf;
+    struct pdb_buffer *buffer = freesasa_pdb_buffer_new(pdb), *buffer_ubq = freesasa_pdb_buffer_new(ubq);
+    struct pdb_index *index, *index2;
+    struct file_range *models = NULL, *chains = NULL;
+    int i, j, nc;
+
+    ck_assert_ptr_ne(buffer, NULL);
+    ck_assert_ptr_ne(buffer_ubq, NULL);
+
+    // the index should agree with the separate scans
+    index = freesasa_pdb_index_new(buffer, 0);
+    ck_assert_ptr_ne(index, NULL);
+    ck_assert_int_eq(freesasa_pdb_buffer_models(buffer, &models), 10);
+    ck_assert_int_eq(index->n_models, 10);
+    ck_assert_int_eq(index->n_chains, 40);
+    for (i = 0; i < index->n_models; ++i) {
+        ck_assert_int_eq(index->models[i].begin, models[i].begin);
+        ck_assert_int_eq(index->models[i].end, models[i].end);
+        ck_assert(strncmp(buffer->data + index->atoms[i].begin, "HETATM", 6) == 0);
+        nc = freesasa_pdb_buffer_chains(buffer, models[i], &chains, 0);
+        ck_assert_int_eq(index->model_chains[i + 1] - index->model_chains[i], nc);
+        for (j = 0; j < nc; ++j) {
+            const struct file_range *c = &index->chains[index->model_chains[i] + j];
+            if (j > 0) ck_assert_int_eq(c->begin, chains[j].begin);
+            ck_assert_int_le(c->end, chains[j].end);
+        }
+        free(chains);
+    }
+    free(models);
+
+    // without models the whole file is one model
+    index2 = freesasa_pdb_index_new(buffer_ubq, 0);
+    ck_assert_ptr_ne(index2, NULL);
+    ck_assert_int_eq(index2->n_models, 0);
+    ck_assert_int_eq(freesasa_pdb_index_n_models(index2), 1);
+    ck_assert_int_eq(index2->n_chains, 1);
+    ck_assert_int_eq(index2->models[0].end, buffer_ubq->size);
+    freesasa_pdb_index_free(index2);
+
+    // sidecar file
+    tf = fopen("tmp/2jo4.fsidx", "w+");
+    ck_assert_ptr_ne(tf, NULL);
+    ck_assert_int_eq(freesasa_pdb_index_write(tf, index), FREESASA_SUCCESS);
+    rewind(tf);
+    index2 = freesasa_pdb_index_read(tf, buffer, 0);
+    ck_assert_ptr_ne(index2, NULL);
+    ck_assert_int_eq(index2->n_models, index->n_models);
+    ck_assert_int_eq(index2->n_chains, index->n_chains);
+    ck_assert(memcmp(index2->models, index->models, sizeof(struct file_range) * index->n_models) == 0);
+    ck_assert(memcmp(index2->atoms, index->atoms, sizeof(struct file_range) * index->n_models) == 0);
+    ck_assert(memcmp(index2->chains, index->chains, sizeof(struct file_range) * index->n_chains) == 0);
+    ck_assert(memcmp(index2->model_chains, index->model_chains, sizeof(int) * (index->n_models + 1)) == 0);
+    freesasa_pdb_index_free(index2);
+
+    // not valid for other options or other files
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_pdb_index_read(tf, buffer, FREESASA_INCLUDE_HETATM), NULL);
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_pdb_index_read(tf, buffer_ubq, 0), NULL);
+
+    // a rewrite of the same size within the same second
+    ++buffer->mtime_nsec;
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_pdb_index_read(tf, buffer, 0), NULL);
+    --buffer->mtime_nsec;
+    fclose(tf);
+
+    // corrupted counts are rejected before anything is allocated
+    tf = fopen("tmp/2jo4_corrupt.fsidx", "w+");
+    ck_assert_ptr_ne(tf, NULL);
+    fprintf(tf, "freesasa-pdb-index 2\nsize %lu mtime %ld %ld hetatm 0\nmodels %d chains %d\n",
+            (unsigned long)buffer->size, buffer->mtime, buffer->mtime_nsec, 2147483647, 40);
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_pdb_index_read(tf, buffer, 0), NULL);
+    fclose(tf);
+    tf = fopen("tmp/2jo4_corrupt.fsidx", "w+");
+    ck_assert_ptr_ne(tf, NULL);
+    fprintf(tf, "freesasa-pdb-index 2\nsize %lu mtime %ld %ld hetatm 0\nmodels %d chains %lu\n",
+            (unsigned long)buffer->size, buffer->mtime, buffer->mtime_nsec, 10, (unsigned long)buffer->size);
+    rewind(tf);
+    ck_assert_ptr_eq(freesasa_pdb_index_read(tf, buffer, 0), NULL);
+    fclose(tf);
+
+    // unbalanced MODEL/ENDMDL
+    freesasa_pdb_index_free(index);
+    freesasa_pdb_buffer_free(buffer);
+    fclose(pdb);
+    pdb = fopen(DATADIR "model_mismatch.pdb", "r");
+    buffer = freesasa_pdb_buffer_new(pdb);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_pdb_index_new(buffer, 0), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    freesasa_pdb_buffer_free(buffer);
+    freesasa_pdb_buffer_free(buffer_ubq);
+    fclose(pdb);
+    fclose(ubq);
+}
+END_TEST
+
+START_TEST(test_pdb_compressed)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *gz = fopen(DATADIR "1ubq.pdb.gz", "r"), *tf;
+    struct pdb_buffer *buffer = freesasa_pdb_buffer_new(pdb), *buffer_gz;
+#if USE_GZIP
+    freesasa_structure *structure;
+#endif
+    char data[4096];
+    size_t n;
+
+    ck_assert_ptr_ne(buffer, NULL);
+    ck_assert_ptr_ne(gz, NULL);
+
+    // a truncated copy of the file
+    tf = fopen("tmp/truncated.pdb.gz", "w+");
+    ck_assert_ptr_ne(tf, NULL);
+    n = fread(data, 1, sizeof(data), gz);
+    ck_assert_int_eq(n, sizeof(data));
+    fwrite(data, 1, n, tf);
+    fflush(tf);
+
+#if USE_GZIP
+    // decompressed transparently
+    buffer_gz = freesasa_pdb_buffer_new(gz);
+    ck_assert_ptr_ne(buffer_gz, NULL);
+    ck_assert_int_eq(buffer_gz->size, buffer->size);
+    ck_assert(memcmp(buffer_gz->data, buffer->data, buffer->size) == 0);
+    freesasa_pdb_buffer_free(buffer_gz);
+
+    structure = freesasa_structure_from_pdb(gz, NULL, 0);
+    ck_assert_ptr_ne(structure, NULL);
+    ck_assert_int_eq(freesasa_structure_n(structure), 602);
+    freesasa_structure_free(structure);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_pdb_buffer_new(tf), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+#else
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    buffer_gz = freesasa_pdb_buffer_new(gz);
+    ck_assert_ptr_eq(buffer_gz, NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+#endif
+
+    fclose(tf);
+    freesasa_pdb_buffer_free(buffer);
+    fclose(pdb);
+    fclose(gz);
+}
+END_TEST
+
+static void
+check_decode(const char *src, size_t len)
+{
+    char line[PDB_MAX_LINE_STRL], buf[PDB_MAX_LINE_STRL];
+    struct pdb_atom_record record;
+    double xyz[3], xyz2[3], occ, occ2;
+    size_t n;
+    int ret;
+
+    // the getters are compared on the line as copied from a buffer
+    n = len < PDB_MAX_LINE_STRL - 1 ? len : PDB_MAX_LINE_STRL - 1;
+    memcpy(line, src, n);
+    line[n] = '\0';
+
+    freesasa_pdb_decode_atom(&record, src, len);
+    freesasa_pdb_get_atom_name(buf, line);
+    ck_assert_str_eq(record.atom_name, buf);
+    freesasa_pdb_get_res_name(buf, line);
+    ck_assert_str_eq(record.res_name, buf);
+    freesasa_pdb_get_res_number(buf, line);
+    ck_assert_str_eq(record.res_number, buf);
+    ck_assert_int_eq(record.has_symbol, freesasa_pdb_get_symbol(buf, line));
+    ck_assert_str_eq(record.symbol, buf);
+    ck_assert_int_eq(record.chain_label, freesasa_pdb_get_chain_label(line));
+    ck_assert_int_eq(record.alt_label, freesasa_pdb_get_alt_coord_label(line));
+    ck_assert_int_eq(record.is_hydrogen, freesasa_pdb_ishydrogen(line));
+
+    // results have to be identical, not just close
+    ret = freesasa_pdb_get_coord(xyz2, line);
+    ck_assert_int_eq(freesasa_pdb_decode_coord(xyz, src, len), ret);
+    if (ret == FREESASA_SUCCESS) ck_assert(memcmp(xyz, xyz2, sizeof xyz) == 0);
+    ret = freesasa_pdb_get_occupancy(&occ2, line);
+    ck_assert_int_eq(freesasa_pdb_decode_occupancy(&occ, src, len), ret);
+    if (ret == FREESASA_SUCCESS) ck_assert(memcmp(&occ, &occ2, sizeof occ) == 0);
+}
+
+START_TEST(test_pdb_decode)
+{
+    const char *files[] = {DATADIR "2jo4.pdb", DATADIR "1ubq.pdb", DATADIR "1d3z.pdb"};
+    const char *lines[] = {
+        "ATOM      1  N   MET A   1      27.340  24.430   2.614",
+        "ATOM      1  N   MET A   1      27.340  24.430   2.61",
+        "ATOM      1  N  ",
+        "ATOM      1  H1  MET A   1      27.340  24.430   2.614  1.00  9.67",
+        "ATOM      1 1H   MET A   1      27.340  24.430   2.614  1.00  9.67",
+        "ATOM      1  N   MET A   1      +27.34  24.430  2.614e0-1.00  9.67           N",
+        "ATOM      1  N   MET A   1     -27.340-124.430-112.614  1.00  9.67           N\n",
+        "ATOM      1  N   MET A   1         -.5      .5     5.   .3333  9.67           N\r\n",
+        "ATOM      1  N   MET A   1           .       -       +  1.00  9.67           N",
+        "ATOM      1  N   MET A   1      0.1000  0.3000  0.7000 99999999.67           N",
+        "ATOM      1  N   MET A   1      27.340  24.430   2.614 16777216 9.67          N",
+        "HETATM    1  N   MET A   1      27.340  24.430   2.614 .33333339.67           N",
+        "ATOM      1  N   MET A   1      27.340  24.430   2.614  1.00  9.67           N  "
+        "lines longer than the maximum line length are cut at the same place as when copying",
+    };
+    struct pdb_buffer *buffer;
+    size_t pos, next;
+    FILE *pdb;
+    size_t i;
+
+    for (i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+        pdb = fopen(files[i], "r");
+        ck_assert_ptr_ne(pdb, NULL);
+        buffer = freesasa_pdb_buffer_new(pdb);
+        ck_assert_ptr_ne(buffer, NULL);
+        for (pos = 0; pos < buffer->size; pos = next) {
+            next = freesasa_pdb_buffer_next_line(buffer, pos);
+            if (next - pos >= 6 && (strncmp(buffer->data + pos, "ATOM", 4) == 0 ||
+                                    strncmp(buffer->data + pos, "HETATM", 6) == 0)) {
+                check_decode(buffer->data + pos, next - pos);
+            }
+        }
+        freesasa_pdb_buffer_free(buffer);
+        fclose(pdb);
+    }
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    for (i = 0; i < sizeof(lines) / sizeof(lines[0]); ++i) {
+        check_decode(lines[i], strlen(lines[i]));
+    }
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
 extern TCase *test_pdb_static();
 
 Suite *pdb_suite()
@@ -203,6 +496,10 @@ Suite *pdb_suite()
     tcase_add_test(tc_core, test_pdb_lines);
     tcase_add_test(tc_core, test_get_models);
     tcase_add_test(tc_core, test_get_chains);
+    tcase_add_test(tc_core, test_pdb_buffer);
+    tcase_add_test(tc_core, test_pdb_compressed);
+    tcase_add_test(tc_core, test_pdb_index);
+    tcase_add_test(tc_core, test_pdb_decode);
 
     TCase *tc_static = test_pdb_static();
 
@@ -357,6 +357,71 @@ START_TEST(test_syntax_error)
 }
 END_TEST
 
+START_TEST(test_compiled)
+{
+    const char *commands[] = {"c1, resn ala",
+                              "c2, chain A-B AND NOT chain A",
+                              "c3, resi \\-2-1 OR symbol SE",
+                              "c4, name CA+ABCDE"};
+    const int *sel[] = {resn_A, chain_B, NULL, name_CA};
+    freesasa_compiled_selection *compiled;
+    freesasa_selection *s1, *s2;
+    freesasa_structure *view;
+    freesasa_result *view_result;
+    int mask[N], n_selected, i, j;
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    for (i = 0; i < 4; ++i) {
+        compiled = freesasa_selection_compile(commands[i]);
+        ck_assert_ptr_ne(compiled, NULL);
+        ck_assert_str_eq(freesasa_compiled_selection_command(compiled), commands[i]);
+
+        s1 = freesasa_selection_apply(compiled, structure, result, mask);
+        s2 = freesasa_selection_new(commands[i], structure, result);
+        ck_assert_ptr_ne(s1, NULL);
+        ck_assert_ptr_ne(s2, NULL);
+        ck_assert_str_eq(freesasa_selection_name(s1), freesasa_compiled_selection_name(compiled));
+        ck_assert_str_eq(freesasa_selection_name(s1), freesasa_selection_name(s2));
+        ck_assert_str_eq(freesasa_selection_command(s1), commands[i]);
+        ck_assert(float_eq(freesasa_selection_area(s1), freesasa_selection_area(s2), 1e-10));
+        ck_assert_int_eq(freesasa_selection_n_atoms(s1), freesasa_selection_n_atoms(s2));
+
+        n_selected = 0;
+        for (j = 0; j < N; ++j) {
+            if (sel[i] != NULL) ck_assert_int_eq(mask[j], sel[i][j]);
+            n_selected += mask[j];
+        }
+        ck_assert_int_eq(freesasa_selection_n_atoms(s1), n_selected);
+        ck_assert(float_eq(freesasa_selection_area(s1), addup(mask, result), 1e-10));
+        freesasa_selection_free(s1);
+        freesasa_selection_free(s2);
+
+        /* the same compiled selection applied to another structure */
+        view = freesasa_structure_chain_view(structure, "B");
+        view_result = freesasa_calc_structure(view, NULL);
+        s1 = freesasa_selection_apply(compiled, view, view_result, NULL);
+        s2 = freesasa_selection_new(commands[i], view, view_result);
+        ck_assert(float_eq(freesasa_selection_area(s1), freesasa_selection_area(s2), 1e-10));
+        ck_assert_int_eq(freesasa_selection_n_atoms(s1), freesasa_selection_n_atoms(s2));
+        freesasa_selection_free(s1);
+        freesasa_selection_free(s2);
+        freesasa_result_free(view_result);
+        freesasa_structure_free(view);
+
+        freesasa_compiled_selection_free(compiled);
+    }
+
+    /* the invalid name is left out, the rest of the list is used */
+    ck_assert_int_eq(freesasa_select_area("c4, name CA+ABCDE", selection_name[0], value, structure, result),
+                     FREESASA_WARN);
+    ck_assert(float_eq(value[0], addup(name_CA, result), 1e-10));
+
+    ck_assert_ptr_eq(freesasa_selection_compile("c1, resn ala+"), NULL);
+    ck_assert_ptr_eq(freesasa_selection_compile(""), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
 // check that some complex constructs don't cause errors, but no checks for valid selection
 START_TEST(test_complex_syntax)
 {
@@ -459,6 +524,7 @@ Suite *selector_suite()
     tcase_add_test(tc_core, test_resn);
     tcase_add_test(tc_core, test_resi);
     tcase_add_test(tc_core, test_chain);
+    tcase_add_test(tc_core, test_compiled);
     tcase_add_test(tc_core, test_memerr);
 
     TCase *tc_static = test_selection_static();
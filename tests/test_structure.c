@@ -116,6 +116,142 @@ START_TEST(test_add_atom)
     freesasa_set_verbosity(FREESASA_V_NORMAL);
 
     freesasa_structure_free(s);
+
+    // the residue template follows residue name and classifier
+    const freesasa_classifier *classifiers[] = {&freesasa_protor_classifier, &freesasa_naccess_classifier,
+                                                &freesasa_naccess_classifier, &freesasa_protor_classifier};
+    const char *res_names[] = {"ALA", "ALA", "ARG", "ARG"};
+    const char *atom_names[] = {" CB ", " CB ", " NE ", " NE "};
+    s = freesasa_structure_new();
+    for (int i = 0; i < 4; ++i) {
+        ck_assert_int_eq(freesasa_structure_add_atom_wopt(s, atom_names[i], res_names[i], "   1", 'A', 0, 0, 0,
+                                                          classifiers[i], 0),
+                         FREESASA_SUCCESS);
+        ck_assert(float_eq(freesasa_structure_atom_radius(s, i),
+                           freesasa_classifier_radius(classifiers[i], res_names[i], atom_names[i]), 1e-10));
+    }
+    ck_assert(freesasa_structure_atom_radius(s, 0) != freesasa_structure_atom_radius(s, 1));
+    freesasa_structure_free(s);
+}
+END_TEST
+
+START_TEST(test_from_arrays)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *ref, *s;
+    const char **atom_names, **res_names, **res_numbers;
+    char *chains;
+    double *radii;
+    freesasa_atom_class *classes;
+    int i, j, n, first, last;
+
+    ck_assert_ptr_ne(pdb, NULL);
+    ref = freesasa_structure_from_pdb(pdb, NULL, FREESASA_INCLUDE_HETATM);
+    fclose(pdb);
+    ck_assert_ptr_ne(ref, NULL);
+
+    n = freesasa_structure_n(ref);
+    atom_names = malloc(sizeof(char *) * n);
+    res_names = malloc(sizeof(char *) * n);
+    res_numbers = malloc(sizeof(char *) * n);
+    chains = malloc(n);
+    radii = malloc(sizeof(double) * n);
+    classes = malloc(sizeof(freesasa_atom_class) * n);
+    for (i = 0; i < n; ++i) {
+        atom_names[i] = freesasa_structure_atom_name(ref, i);
+        res_names[i] = freesasa_structure_atom_res_name(ref, i);
+        res_numbers[i] = freesasa_structure_atom_res_number(ref, i);
+        chains[i] = freesasa_structure_atom_chain(ref, i);
+        radii[i] = 2.0;
+        classes[i] = FREESASA_ATOM_POLAR;
+    }
+
+    // classified as when read from the PDB file
+    s = freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                       freesasa_structure_coord_array(ref), NULL, NULL, NULL, 0);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_int_eq(freesasa_structure_n(s), n);
+    ck_assert_int_eq(freesasa_structure_n_residues(s), freesasa_structure_n_residues(ref));
+    ck_assert_str_eq(freesasa_structure_chain_labels(s), freesasa_structure_chain_labels(ref));
+    for (i = 0; i < n; ++i) {
+        ck_assert_str_eq(freesasa_structure_atom_name(s, i), atom_names[i]);
+        ck_assert_str_eq(freesasa_structure_atom_res_number(s, i), res_numbers[i]);
+        ck_assert_str_eq(freesasa_structure_atom_symbol(s, i), freesasa_structure_atom_symbol(ref, i));
+        ck_assert(freesasa_structure_atom_radius(s, i) == freesasa_structure_atom_radius(ref, i));
+        ck_assert_int_eq(freesasa_structure_atom_class(s, i), freesasa_structure_atom_class(ref, i));
+        ck_assert(freesasa_structure_coord_array(s)[3 * i] == freesasa_structure_coord_array(ref)[3 * i]);
+    }
+    for (i = 0; i < freesasa_structure_n_residues(s); ++i) {
+        ck_assert_int_eq(freesasa_structure_residue_atoms(s, i, &first, &last), FREESASA_SUCCESS);
+        ck_assert_int_eq(freesasa_structure_residue_atoms(ref, i, &j, &last), FREESASA_SUCCESS);
+        ck_assert_int_eq(first, j);
+        ck_assert_int_eq(freesasa_structure_residue_reference(s, i) == NULL,
+                         freesasa_structure_residue_reference(ref, i) == NULL);
+    }
+    freesasa_structure_free(s);
+
+    // radii and classes given
+    s = freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                       freesasa_structure_coord_array(ref), radii, classes, NULL, 0);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_int_eq(freesasa_structure_n(s), n);
+    for (i = 0; i < n; ++i) {
+        ck_assert(freesasa_structure_atom_radius(s, i) == 2.0);
+        ck_assert_int_eq(freesasa_structure_atom_class(s, i), FREESASA_ATOM_POLAR);
+    }
+    freesasa_structure_free(s);
+
+    // unknown atoms, the first one is skipped
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    atom_names[0] = "XXXX";
+    s = freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                       freesasa_structure_coord_array(ref), NULL, NULL, NULL,
+                                       FREESASA_SKIP_UNKNOWN);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_int_eq(freesasa_structure_n(s), n - 1);
+    ck_assert_str_eq(freesasa_structure_atom_name(s, 0), atom_names[1]);
+    ck_assert(freesasa_structure_coord_array(s)[0] == freesasa_structure_coord_array(ref)[3]);
+    freesasa_structure_free(s);
+
+    ck_assert_ptr_eq(freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                                    freesasa_structure_coord_array(ref), NULL, NULL, NULL,
+                                                    FREESASA_HALT_AT_UNKNOWN),
+                     NULL);
+
+    // given radii override the classifier
+    s = freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                       freesasa_structure_coord_array(ref), radii, NULL, NULL,
+                                       FREESASA_HALT_AT_UNKNOWN);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_int_eq(freesasa_structure_n(s), n);
+    freesasa_structure_free(s);
+
+    radii[n - 1] = -1;
+    ck_assert_ptr_eq(freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                                    freesasa_structure_coord_array(ref), radii, NULL, NULL, 0),
+                     NULL);
+
+    for (i = 1; i < 20; ++i) {
+        set_fail_after(i);
+        s = freesasa_structure_from_arrays(n, atom_names, res_names, res_numbers, chains,
+                                           freesasa_structure_coord_array(ref), NULL, NULL, NULL, 0);
+        set_fail_after(0);
+        ck_assert_ptr_eq(s, NULL);
+    }
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    s = freesasa_structure_from_arrays(0, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 0);
+    ck_assert_ptr_ne(s, NULL);
+    ck_assert_int_eq(freesasa_structure_n(s), 0);
+    freesasa_structure_free(s);
+
+    free(atom_names);
+    free(res_names);
+    free(res_numbers);
+    free(chains);
+    free(radii);
+    free(classes);
+    freesasa_structure_free(ref);
 }
 END_TEST
 
@@ -302,6 +438,285 @@ START_TEST(test_structure_array_nmr)
 }
 END_TEST
 
+START_TEST(test_structure_array_threads)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r");
+    const int options = FREESASA_SEPARATE_CHAINS | FREESASA_SEPARATE_MODELS | FREESASA_INCLUDE_HETATM;
+    int default_threads = freesasa_get_parse_threads();
+    freesasa_structure **ss, **ss2;
+    int n, n2, i;
+
+    // parallel parsing is opt-in
+    ck_assert_int_eq(default_threads, 1);
+
+    ck_assert_int_eq(freesasa_set_parse_threads(0), FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_get_parse_threads(), default_threads);
+
+    ck_assert_int_eq(freesasa_set_parse_threads(1), FREESASA_SUCCESS);
+    ss = freesasa_structure_array(pdb, &n, NULL, options);
+    ck_assert_ptr_ne(ss, NULL);
+    ck_assert_int_eq(n, 40);
+
+    // the order is the same with several threads
+    freesasa_set_parse_threads(7);
+    ss2 = freesasa_structure_array(pdb, &n2, NULL, options);
+    ck_assert_ptr_ne(ss2, NULL);
+    ck_assert_int_eq(n2, n);
+    for (i = 0; i < n; ++i) {
+        ck_assert_int_eq(freesasa_structure_n(ss2[i]), freesasa_structure_n(ss[i]));
+        ck_assert_int_eq(freesasa_structure_model(ss2[i]), freesasa_structure_model(ss[i]));
+        ck_assert_str_eq(freesasa_structure_chain_labels(ss2[i]),
+                         freesasa_structure_chain_labels(ss[i]));
+        ck_assert(memcmp(freesasa_structure_coord_array(ss2[i]),
+                         freesasa_structure_coord_array(ss[i]),
+                         sizeof(double) * 3 * freesasa_structure_n(ss[i])) == 0);
+        freesasa_structure_free(ss[i]);
+        freesasa_structure_free(ss2[i]);
+    }
+    free(ss);
+    free(ss2);
+
+    ck_assert_int_eq(freesasa_set_parse_threads(1000), FREESASA_WARN);
+    ck_assert_int_le(freesasa_get_parse_threads(), 16);
+
+    freesasa_set_parse_threads(default_threads);
+    fclose(pdb);
+}
+END_TEST
+
+START_TEST(test_structure_array_indexed)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *idx;
+    const char *index_file = "tmp/2jo4_array.fsidx";
+    const int options = FREESASA_SEPARATE_CHAINS | FREESASA_SEPARATE_MODELS;
+    freesasa_structure **ss, **ss2;
+    int n, n2, pass, i;
+
+    remove(index_file);
+    ss = freesasa_structure_array(pdb, &n, NULL, options);
+    ck_assert_ptr_ne(ss, NULL);
+    ck_assert_int_eq(n, 40);
+
+    // first pass writes the index, the second reads it
+    for (pass = 0; pass < 2; ++pass) {
+        ss2 = freesasa_structure_array_indexed(pdb, index_file, &n2, NULL, options);
+        ck_assert_ptr_ne(ss2, NULL);
+        ck_assert_int_eq(n2, n);
+        for (i = 0; i < n; ++i) {
+            ck_assert_int_eq(freesasa_structure_n(ss2[i]), freesasa_structure_n(ss[i]));
+            ck_assert_int_eq(freesasa_structure_model(ss2[i]), freesasa_structure_model(ss[i]));
+            ck_assert_str_eq(freesasa_structure_chain_labels(ss2[i]),
+                             freesasa_structure_chain_labels(ss[i]));
+            freesasa_structure_free(ss2[i]);
+        }
+        free(ss2);
+        idx = fopen(index_file, "r");
+        ck_assert_ptr_ne(idx, NULL);
+        fclose(idx);
+    }
+
+    for (i = 0; i < n; ++i)
+        freesasa_structure_free(ss[i]);
+    free(ss);
+    fclose(pdb);
+}
+END_TEST
+
+static void
+assert_cached_equal(const freesasa_structure *s,
+                    const freesasa_structure *t)
+{
+    const freesasa_nodearea *ref_s, *ref_t;
+    const char *line_s, *line_t;
+    int i, n = freesasa_structure_n(s), len_s, len_t, first_s, last_s, first_t, last_t;
+
+    ck_assert_int_eq(freesasa_structure_n(t), n);
+    ck_assert_int_eq(freesasa_structure_n_residues(t), freesasa_structure_n_residues(s));
+    ck_assert_int_eq(freesasa_structure_n_chains(t), freesasa_structure_n_chains(s));
+    ck_assert_int_eq(freesasa_structure_model(t), freesasa_structure_model(s));
+    ck_assert_str_eq(freesasa_structure_chain_labels(t), freesasa_structure_chain_labels(s));
+    ck_assert_str_eq(freesasa_structure_classifier_name(t), freesasa_structure_classifier_name(s));
+    ck_assert(memcmp(freesasa_structure_coord_array(t), freesasa_structure_coord_array(s),
+                     sizeof(double) * 3 * n) == 0);
+    ck_assert(memcmp(freesasa_structure_radius(t), freesasa_structure_radius(s),
+                     sizeof(double) * n) == 0);
+
+    for (i = 0; i < n; ++i) {
+        ck_assert_str_eq(freesasa_structure_atom_name(t, i), freesasa_structure_atom_name(s, i));
+        ck_assert_str_eq(freesasa_structure_atom_res_name(t, i), freesasa_structure_atom_res_name(s, i));
+        ck_assert_str_eq(freesasa_structure_atom_res_number(t, i), freesasa_structure_atom_res_number(s, i));
+        ck_assert_str_eq(freesasa_structure_atom_symbol(t, i), freesasa_structure_atom_symbol(s, i));
+        ck_assert_int_eq(freesasa_structure_atom_chain(t, i), freesasa_structure_atom_chain(s, i));
+        ck_assert_int_eq(freesasa_structure_atom_class(t, i), freesasa_structure_atom_class(s, i));
+        line_s = freesasa_structure_atom_pdb_line(s, i, &len_s);
+        line_t = freesasa_structure_atom_pdb_line(t, i, &len_t);
+        ck_assert_int_eq(line_t == NULL, line_s == NULL);
+        if (line_s) {
+            ck_assert_int_eq(len_t, len_s);
+            ck_assert(memcmp(line_t, line_s, len_s) == 0);
+        }
+    }
+
+    for (i = 0; i < freesasa_structure_n_residues(s); ++i) {
+        freesasa_structure_residue_atoms(s, i, &first_s, &last_s);
+        freesasa_structure_residue_atoms(t, i, &first_t, &last_t);
+        ck_assert_int_eq(first_t, first_s);
+        ck_assert_int_eq(last_t, last_s);
+        ref_s = freesasa_structure_residue_reference(s, i);
+        ref_t = freesasa_structure_residue_reference(t, i);
+        ck_assert_int_eq(ref_t == NULL, ref_s == NULL);
+        if (ref_s) {
+            ck_assert(ref_t->name == ref_s->name || strcmp(ref_t->name, ref_s->name) == 0);
+            ck_assert(ref_t->total == ref_s->total && ref_t->side_chain == ref_s->side_chain &&
+                      ref_t->main_chain == ref_s->main_chain && ref_t->polar == ref_s->polar &&
+                      ref_t->apolar == ref_s->apolar && ref_t->unknown == ref_s->unknown);
+        }
+    }
+}
+
+START_TEST(test_structure_cache)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *cache;
+    const char *cache_file = "tmp/structures.fscache";
+    freesasa_structure *s, **ss, **loaded;
+    freesasa_result *r, *r2;
+    int n, n_loaded, i;
+
+    s = freesasa_structure_from_pdb(pdb, NULL, FREESASA_INCLUDE_HETATM);
+    ck_assert_ptr_ne(s, NULL);
+    fclose(pdb);
+
+    pdb = fopen(DATADIR "2jo4.pdb", "r");
+    ss = freesasa_structure_array(pdb, &n, NULL, FREESASA_SEPARATE_CHAINS | FREESASA_SEPARATE_MODELS);
+    ck_assert_ptr_ne(ss, NULL);
+    fclose(pdb);
+
+    // two segments in the same file
+    cache = fopen(cache_file, "wb");
+    ck_assert_ptr_ne(cache, NULL);
+    ck_assert_int_eq(freesasa_structure_write_cache(cache, &s, 1), FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_structure_write_cache(cache, ss, n), FREESASA_SUCCESS);
+    fclose(cache);
+
+    cache = fopen(cache_file, "rb");
+    loaded = freesasa_structure_array_from_cache(cache, &n_loaded);
+    fclose(cache);
+    ck_assert_ptr_ne(loaded, NULL);
+    ck_assert_int_eq(n_loaded, n + 1);
+
+    assert_cached_equal(s, loaded[0]);
+    for (i = 0; i < n; ++i) {
+        assert_cached_equal(ss[i], loaded[i + 1]);
+    }
+
+    r = freesasa_calc_structure(s, NULL);
+    r2 = freesasa_calc_structure(loaded[0], NULL);
+    ck_assert(r->total == r2->total);
+    freesasa_result_free(r);
+    freesasa_result_free(r2);
+
+    // cached structures can be extended
+    ck_assert_int_eq(freesasa_structure_add_atom(loaded[0], " CA ", "ALA", "  77 ", 'A', 1, 2, 3),
+                     FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_structure_n(loaded[0]), freesasa_structure_n(s) + 1);
+    ck_assert_int_eq(freesasa_structure_n_residues(loaded[0]), freesasa_structure_n_residues(s) + 1);
+
+    freesasa_structure_free(s);
+    for (i = 0; i < n; ++i) {
+        freesasa_structure_free(ss[i]);
+    }
+    free(ss);
+    // the buffer is shared, free in a different order than it was read
+    for (i = n_loaded - 1; i >= 0; --i) {
+        freesasa_structure_free(loaded[i]);
+    }
+    free(loaded);
+
+    // structures without PDB lines or references
+    s = freesasa_structure_new();
+    ck_assert_int_eq(freesasa_structure_add_atom(s, " XX ", "XXX", "   1 ", 'B', 1, 2, 3), FREESASA_SUCCESS);
+    cache = fopen(cache_file, "w+b");
+    ck_assert_int_eq(freesasa_structure_write_cache(cache, &s, 1), FREESASA_SUCCESS);
+    rewind(cache);
+    loaded = freesasa_structure_array_from_cache(cache, &n_loaded);
+    fclose(cache);
+    ck_assert_ptr_ne(loaded, NULL);
+    ck_assert_int_eq(n_loaded, 1);
+    assert_cached_equal(s, loaded[0]);
+    freesasa_structure_free(s);
+    freesasa_structure_free(loaded[0]);
+    free(loaded);
+}
+END_TEST
+
+START_TEST(test_structure_cache_err)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *cache, *tf;
+    freesasa_structure *s = freesasa_structure_from_pdb(pdb, NULL, 0), **loaded;
+    char *data;
+    long size, k;
+    int n, i;
+
+    ck_assert_ptr_ne(s, NULL);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    rewind(pdb);
+    ck_assert_ptr_eq(freesasa_structure_array_from_cache(pdb, &n), NULL);
+    ck_assert_int_eq(n, 0);
+    fclose(pdb);
+
+    cache = tmpfile();
+    ck_assert_int_eq(freesasa_structure_write_cache(cache, &s, 0), FREESASA_SUCCESS);
+    rewind(cache);
+    ck_assert_ptr_eq(freesasa_structure_array_from_cache(cache, &n), NULL);
+    fclose(cache);
+
+    cache = tmpfile();
+    ck_assert_int_eq(freesasa_structure_write_cache(cache, &s, 1), FREESASA_SUCCESS);
+    size = ftell(cache);
+    data = malloc(size);
+    rewind(cache);
+    ck_assert_int_eq(fread(data, 1, size, cache), size);
+    fclose(cache);
+
+    // truncated, and with corrupted bytes in the headers and tables
+    for (k = 0; k < 200; ++k) {
+        tf = tmpfile();
+        if (k < 100) {
+            fwrite(data, 1, size * k / 100, tf);
+        } else {
+            data[(k - 100) * 8]++;
+            fwrite(data, 1, size, tf);
+            data[(k - 100) * 8]--;
+        }
+        rewind(tf);
+        loaded = freesasa_structure_array_from_cache(tf, &n);
+        if (k < 100) ck_assert_ptr_eq(loaded, NULL);
+        for (i = 0; i < n; ++i) {
+            freesasa_structure_free(loaded[i]);
+        }
+        free(loaded);
+        fclose(tf);
+    }
+
+    // memory allocation failures
+    tf = tmpfile();
+    fwrite(data, 1, size, tf);
+    for (i = 1; i < 15; ++i) {
+        rewind(tf);
+        set_fail_after(i);
+        loaded = freesasa_structure_array_from_cache(tf, &n);
+        set_fail_after(0);
+        ck_assert_ptr_eq(loaded, NULL);
+    }
+    fclose(tf);
+
+    free(data);
+    freesasa_structure_free(s);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
 START_TEST(test_structure_array_chains_models)
 {
     FILE *pdb;
@@ -411,6 +826,102 @@ START_TEST(test_get_chains)
 }
 END_TEST
 
+START_TEST(test_chain_view)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *err;
+    freesasa_structure *s = freesasa_structure_from_pdb(pdb, NULL, 0), *copy, *view, *view2;
+    freesasa_result *r_copy, *r_view;
+    const char *groups[] = {"A", "D", "AB", "BC", "AC", "DA"};
+    int i, j, first, last;
+
+    fclose(pdb);
+    ck_assert_ptr_ne(s, NULL);
+
+    // the same structures as with freesasa_structure_get_chains()
+    for (i = 0; i < sizeof(groups) / sizeof(groups[0]); ++i) {
+        copy = freesasa_structure_get_chains(s, groups[i], NULL, 0);
+        view = freesasa_structure_chain_view(s, groups[i]);
+        ck_assert_ptr_ne(copy, NULL);
+        ck_assert_ptr_ne(view, NULL);
+        ck_assert_int_eq(freesasa_structure_n(view), freesasa_structure_n(copy));
+        ck_assert_int_eq(freesasa_structure_n_residues(view), freesasa_structure_n_residues(copy));
+        ck_assert_str_eq(freesasa_structure_chain_labels(view), freesasa_structure_chain_labels(copy));
+        for (j = 0; j < freesasa_structure_n(view); ++j) {
+            ck_assert_str_eq(freesasa_structure_atom_name(view, j), freesasa_structure_atom_name(copy, j));
+            ck_assert_str_eq(freesasa_structure_atom_res_number(view, j), freesasa_structure_atom_res_number(copy, j));
+            ck_assert_int_eq(freesasa_structure_atom_chain(view, j), freesasa_structure_atom_chain(copy, j));
+            ck_assert(freesasa_structure_atom_radius(view, j) == freesasa_structure_atom_radius(copy, j));
+        }
+        for (j = 0; j < freesasa_structure_n_residues(view); ++j) {
+            ck_assert_int_eq(freesasa_structure_residue_atoms(view, j, &first, &last), FREESASA_SUCCESS);
+            ck_assert_str_eq(freesasa_structure_residue_name(view, j), freesasa_structure_residue_name(copy, j));
+            ck_assert_ptr_ne(freesasa_structure_residue_reference(view, j), NULL);
+        }
+        for (j = 0; groups[i][j]; ++j) {
+            int first_copy, last_copy;
+            ck_assert_int_eq(freesasa_structure_chain_residues(view, groups[i][j], &first, &last), FREESASA_SUCCESS);
+            ck_assert_int_eq(freesasa_structure_chain_residues(copy, groups[i][j], &first_copy, &last_copy), FREESASA_SUCCESS);
+            ck_assert_int_eq(first, first_copy);
+            ck_assert_int_eq(last, last_copy);
+        }
+
+        r_copy = freesasa_calc_structure(copy, NULL);
+        r_view = freesasa_calc_structure(view, NULL);
+        ck_assert(r_copy->total == r_view->total);
+        freesasa_result_free(r_copy);
+        freesasa_result_free(r_view);
+
+        freesasa_structure_free(copy);
+        freesasa_structure_free(view);
+    }
+
+    // a view of a view
+    view = freesasa_structure_chain_view(s, "BCD");
+    view2 = freesasa_structure_chain_view(view, "C");
+    ck_assert_ptr_ne(view2, NULL);
+    ck_assert_int_eq(freesasa_structure_n(view2), 129);
+    ck_assert_str_eq(freesasa_structure_chain_labels(view2), "C");
+    ck_assert(freesasa_structure_coord_array(view2)[0] == freesasa_structure_coord_array(s)[3 * 2 * 129]);
+    ck_assert_int_eq(freesasa_structure_chain_residues(view2, 'C', &first, &last), FREESASA_SUCCESS);
+    ck_assert_int_eq(first, 0);
+    ck_assert_int_eq(last, freesasa_structure_n_residues(view2) - 1);
+
+    // radii are not shared
+    freesasa_structure_atom_set_radius(view2, 0, 10);
+    ck_assert(freesasa_structure_atom_radius(view2, 0) == 10);
+    ck_assert(freesasa_structure_atom_radius(view, 129) != 10);
+    freesasa_structure_free(view2);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_structure_add_atom(view, " CA ", "ALA", "   1", 'E', 0, 0, 0), FREESASA_FAIL);
+    ck_assert_ptr_eq(freesasa_structure_chain_view(s, ""), NULL);
+    ck_assert_ptr_eq(freesasa_structure_chain_view(s, "E"), NULL);
+    ck_assert_ptr_eq(freesasa_structure_chain_view(s, "AE"), NULL);
+    for (i = 1; i < 5; ++i) {
+        set_fail_after(i);
+        view2 = freesasa_structure_chain_view(s, "AC");
+        set_fail_after(0);
+        ck_assert_ptr_eq(view2, NULL);
+        set_fail_after(i);
+        view2 = freesasa_structure_chain_view(s, "B");
+        set_fail_after(0);
+        ck_assert_ptr_eq(view2, NULL);
+    }
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    /* missing chains are not an error */
+    err = tmpfile();
+    freesasa_set_err_out(err);
+    ck_assert_ptr_eq(freesasa_structure_chain_view(s, "E"), NULL);
+    freesasa_set_err_out(stderr);
+    ck_assert_int_eq(ftell(err), 0);
+    fclose(err);
+
+    freesasa_structure_free(view);
+    freesasa_structure_free(s);
+}
+END_TEST
+
 START_TEST(test_occupancy)
 {
     FILE *pdb = fopen(DATADIR "1ubq.occ.pdb", "r");
@@ -472,6 +983,7 @@ Suite *structure_suite()
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_structure_api);
     tcase_add_test(tc_core, test_add_atom);
+    tcase_add_test(tc_core, test_from_arrays);
     tcase_add_test(tc_core, test_memerr);
 
     TCase *tc_pdb = tcase_create("PDB");
@@ -479,6 +991,7 @@ Suite *structure_suite()
     tcase_add_test(tc_pdb, test_hydrogen);
     tcase_add_test(tc_pdb, test_hetatm);
     tcase_add_test(tc_pdb, test_get_chains);
+    tcase_add_test(tc_pdb, test_chain_view);
     tcase_add_test(tc_pdb, test_occupancy);
 
     TCase *tc_array = tcase_create("Array");
@@ -486,6 +999,10 @@ Suite *structure_suite()
     tcase_add_test(tc_pdb, test_structure_array_one_chain);
     tcase_add_test(tc_pdb, test_structure_array_nmr);
     tcase_add_test(tc_pdb, test_structure_array_chains_models);
+    tcase_add_test(tc_pdb, test_structure_array_indexed);
+    tcase_add_test(tc_pdb, test_structure_array_threads);
+    tcase_add_test(tc_pdb, test_structure_cache);
+    tcase_add_test(tc_pdb, test_structure_cache_err);
 
     TCase *tc_1ubq = tcase_create("1UBQ");
     tcase_add_checked_fixture(tc_1ubq, setup_1ubq, teardown_1ubq);
@@ -5,6 +5,7 @@
 #include <freesasa_internal.h>
 #include <libxml/tree.h>
 #include <libxml/xmlwriter.h>
+#include <string.h>
 
 #define fail_counter(err)                        \
     if (fail_after > 0) {                        \
@@ -168,6 +169,49 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+static char *
+xml_str(freesasa_node *root)
+{
+    FILE *tmp = tmpfile();
+    long size;
+    char *str;
+
+    ck_assert_int_eq(freesasa_write_xml(tmp, root, FREESASA_OUTPUT_RESIDUE), FREESASA_SUCCESS);
+    size = ftell(tmp);
+    rewind(tmp);
+    str = malloc(size + 1);
+    ck_assert_int_eq(fread(str, 1, size, tmp), size);
+    str[size] = '\0';
+    fclose(tmp);
+
+    return str;
+}
+
+START_TEST(test_area_format)
+{
+    freesasa_result *res;
+    freesasa_node *tree2;
+    char *out;
+
+    // undefined relative areas (GLY side chain) are unchanged
+    out = xml_str(tree);
+    ck_assert_ptr_eq(strstr(out, "N/A"), NULL);
+    ck_assert_ptr_ne(strstr(out, "nan\""), NULL);
+    free(out);
+
+    // areas that include atoms that weren't calculated are N/A
+    res = freesasa_calc_targets(ubq, "pocket, resi 10-12", NULL);
+    ck_assert_ptr_ne(res, NULL);
+    tree2 = freesasa_tree_init(res, ubq, "test");
+    out = xml_str(tree2);
+    ck_assert_ptr_ne(strstr(out, "<area total=\"N/A\" polar=\"N/A\""), NULL);
+    ck_assert_ptr_ne(strstr(out, "<relativeArea total=\"N/A\""), NULL);
+    free(out);
+    freesasa_node_free(tree2);
+    freesasa_result_free(res);
+}
+END_TEST
+
 Suite *xml_suite()
 {
     Suite *s = suite_create("XML");
@@ -175,6 +219,7 @@ Suite *xml_suite()
     tcase_add_checked_fixture(tc_core, setup, teardown);
     tcase_add_test(tc_core, test_libxmlerr);
     tcase_add_test(tc_core, test_memerr);
+    tcase_add_test(tc_core, test_area_format);
 
     suite_add_tcase(s, tc_core);
 